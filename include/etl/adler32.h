@@ -0,0 +1,127 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ADLER32_INCLUDED
+#define ETL_ADLER32_INCLUDED
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+
+#include "private/checksum_simd.h"
+
+#include <stdint.h>
+
+///\defgroup adler32 Adler-32 checksum calculation
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// Adler-32 policy.
+  /// The two sums are held as (s2 << 16) | s1, which is also the checksum.
+  //***************************************************************************
+  struct adler32_policy
+  {
+    typedef uint32_t value_type;
+
+    static ETL_CONSTANT uint32_t Modulus = 65521UL;
+
+    value_type initial() const
+    {
+      return 1U;
+    }
+
+    value_type add(value_type sums, uint8_t value) const
+    {
+      uint32_t s1 = (sums & 0xFFFFUL) + value;
+      uint32_t s2 = sums >> 16U;
+
+      s1 = (s1 >= Modulus) ? s1 - Modulus : s1;
+      s2 += s1;
+      s2 = (s2 >= Modulus) ? s2 - Modulus : s2;
+
+      return (s2 << 16U) | s1;
+    }
+
+    value_type final(value_type sums) const
+    {
+      return sums;
+    }
+
+#if ETL_USING_SIMD_CHECKSUM
+    value_type add_range(value_type sums, const uint8_t* begin, const uint8_t* end) const
+    {
+      uint64_t s1 = sums & 0xFFFFUL;
+      uint64_t s2 = sums >> 16U;
+
+      begin = etl::private_checksum_simd::add_words<1U>(s1, s2, begin, end, Modulus);
+      sums  = static_cast<value_type>((s2 << 16U) | s1);
+
+      while (begin != end)
+      {
+        sums = add(sums, *begin);
+        ++begin;
+      }
+
+      return sums;
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// Adler-32 checksum.
+  //*************************************************************************
+  class adler32 : public etl::frame_check_sequence<etl::adler32_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    adler32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    adler32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+} // namespace etl
+
+#endif
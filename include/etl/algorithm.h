@@ -47,9 +47,11 @@ SOFTWARE.
 #include "invoke.h"
 #include "iterator.h"
 #include "largest.h"
+#include "nullptr.h"
 #include "ranges.h"
 #include "type_traits.h"
 #include "utility.h"
+#include "private/algorithm_simd.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -88,6 +90,18 @@ namespace etl
   template <typename TIterator>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last);
 
+  template <typename TIterator>
+  void pdq_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void pdq_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TBufferIterator>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last);
+
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare);
+
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
 
@@ -329,7 +343,7 @@ namespace etl
   template <typename TIterator1, typename TIterator2>
   ETL_CONSTEXPR14 TIterator2 move(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
-    return copy(sb, se, db);
+    return etl::copy(sb, se, db);
   }
 #endif
 
@@ -391,35 +405,167 @@ namespace etl
     }
   }
 
-  //***************************************************************************
-  // lower_bound
-  //***************************************************************************
-  template <typename TIterator, typename TValue, typename TCompare>
-  ETL_NODISCARD ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  namespace private_algorithm
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    //*************************************************************************
+    /// Arithmetic keys in contiguous memory are searched without branching on
+    /// the result of the comparisons.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_branchless_search
+      : etl::integral_constant<bool, etl::is_pointer<TIterator>::value && etl::is_arithmetic<typename etl::iterator_traits<TIterator>::value_type>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// lower_bound, with a branch on each comparison.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare& compare, etl::false_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t count = etl::distance(first, last);
+
+      while (count > 0)
+      {
+        TIterator    itr  = first;
+        difference_t step = count / 2;
+
+        etl::advance(itr, step);
+
+        if (compare(*itr, value))
+        {
+          first = ++itr;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
 
-    difference_t count = etl::distance(first, last);
+    //*************************************************************************
+    /// Prefetches both of the elements that the next step of a branchless
+    /// search may compare, as the comparison that picks between them is not
+    /// speculated past. Without it, large ranges are slower than with a
+    /// predicted branch.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 void prefetch_next_halves(const T* first, size_t half, size_t count)
+    {
+#if ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t next_half = (count - half) / 2U;
+
+        ETL_PREFETCH(first + next_half);
+        ETL_PREFETCH(first + half + next_half);
+      }
+#else
+      (void)first;
+      (void)half;
+      (void)count;
+#endif
+    }
 
-    while (count > 0)
+    //*************************************************************************
+    /// lower_bound, without branching on the comparisons.
+    /// The range is halved on every step whatever the result of the
+    /// comparison, so the compiler can select the next base with a
+    /// conditional move. The loop always runs log2(N) times, which is better
+    /// than a mispredicted branch on every step.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare& compare, etl::true_type)
     {
-      TIterator    itr  = first;
-      difference_t step = count / 2;
+      size_t count = size_t(last - first);
 
-      etl::advance(itr, step);
+      if (count == 0U)
+      {
+        return first;
+      }
 
-      if (compare(*itr, value))
+      while (count > 1U)
       {
-        first = ++itr;
-        count -= step + 1;
+        const size_t half = count / 2U;
+
+        private_algorithm::prefetch_next_halves(first, half, count);
+        first = compare(first[half], value) ? first + half : first;
+        count -= half;
       }
-      else
+
+      return compare(*first, value) ? first + 1 : first;
+    }
+
+    //*************************************************************************
+    /// upper_bound, with a branch on each comparison.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound(TIterator first, TIterator last, const TValue& value, TCompare& compare, etl::false_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t count = etl::distance(first, last);
+
+      while (count > 0)
       {
-        count = step;
+        TIterator    itr  = first;
+        difference_t step = count / 2;
+
+        etl::advance(itr, step);
+
+        if (!compare(value, *itr))
+        {
+          first = ++itr;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
       }
+
+      return first;
     }
 
-    return first;
+    //*************************************************************************
+    /// upper_bound, without branching on the comparisons.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound(TIterator first, TIterator last, const TValue& value, TCompare& compare, etl::true_type)
+    {
+      size_t count = size_t(last - first);
+
+      if (count == 0U)
+      {
+        return first;
+      }
+
+      while (count > 1U)
+      {
+        const size_t half = count / 2U;
+
+        private_algorithm::prefetch_next_halves(first, half, count);
+        first = compare(value, first[half]) ? first : first + half;
+        count -= half;
+      }
+
+      return compare(value, *first) ? first : first + 1;
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  // lower_bound
+  // Arithmetic keys in contiguous memory use a branchless binary search.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    return private_algorithm::lower_bound(first, last, value, compare, private_algorithm::is_branchless_search<TIterator>());
   }
 
   template <typename TIterator, typename TValue>
@@ -432,33 +578,12 @@ namespace etl
 
   //***************************************************************************
   // upper_bound
+  // Arithmetic keys in contiguous memory use a branchless binary search.
   //***************************************************************************
   template <typename TIterator, typename TValue, typename TCompare>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
-
-    difference_t count = etl::distance(first, last);
-
-    while (count > 0)
-    {
-      TIterator    itr  = first;
-      difference_t step = count / 2;
-
-      etl::advance(itr, step);
-
-      if (!compare(value, *itr))
-      {
-        first = ++itr;
-        count -= step + 1;
-      }
-      else
-      {
-        count = step;
-      }
-    }
-
-    return first;
+    return private_algorithm::upper_bound(first, last, value, compare, private_algorithm::is_branchless_search<TIterator>());
   }
 
   template <typename TIterator, typename TValue>
@@ -531,6 +656,18 @@ namespace etl
   template <typename TIterator, typename T>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator find(TIterator first, TIterator last, const T& value)
   {
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_find_vectorisable<TIterator, T> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::find(first, last, value, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     while (first != last)
     {
       if (*first == value)
@@ -592,6 +729,18 @@ namespace etl
   template <typename TIterator, typename T>
   ETL_NODISCARD ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
   {
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_find_vectorisable<TIterator, T> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::count(first, last, value, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     typename iterator_traits<TIterator>::difference_type n = 0;
 
     while (first != last)
@@ -668,6 +817,18 @@ namespace etl
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD ETL_CONSTEXPR14 bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_equal_vectorisable<TIterator1, TIterator2> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::equal(first1, last1, first2, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     while (first1 != last1)
     {
       if (*first1 != *first2)
@@ -704,6 +865,18 @@ namespace etl
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD ETL_CONSTEXPR14 bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
   {
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_equal_vectorisable<TIterator1, TIterator2> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::equal(first1, last1, first2, last2, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     while ((first1 != last1) && (first2 != last2))
     {
       if (*first1 != *first2)
@@ -1075,113 +1248,393 @@ namespace etl
   }
 
   //***************************************************************************
-  /// partial_sort
-  ///\ingroup algorithm
-  ///< a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR14 void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  namespace private_algorithm
   {
-    if (first == middle)
-    {
-      return;
-    }
-
-    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    using ETL_OR_STD::swap;
 
-    etl::make_heap(first, middle, compare);
+    enum
+    {
+      Select_Insertion_Sort_Threshold = 16,  ///< Ranges below this size are insertion sorted.
+      Select_Ninther_Threshold        = 128  ///< Ranges above this size use a pseudomedian of nine as the pivot.
+    };
 
-    for (TIterator i = middle; i != last; ++i)
+    //*********************************************************
+    /// Returns the median of *a, *b and *c.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      TIterator
+      median_of_three(TIterator a, TIterator b, TIterator c, TCompare& compare)
     {
-      if (compare(*i, *first))
+      if (compare(*a, *b))
       {
-        value_t value = ETL_MOVE(*i);
-        *i            = ETL_MOVE(*first);
+        if (compare(*b, *c))
+        {
+          return b;
+        }
 
-        private_heap::adjust_heap(first, difference_t(0), difference_t(middle - first), ETL_MOVE(value), compare);
+        return compare(*a, *c) ? c : a;
+      }
+
+      if (compare(*a, *c))
+      {
+        return a;
       }
+
+      return compare(*b, *c) ? c : b;
     }
 
-    etl::sort_heap(first, middle, compare);
-  }
+    //*********************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equivalent to the pivot stop both scans, so a range with
+    /// many equal elements is still split near the middle.
+    /// The pivot is the median of a sample of the range, so another element
+    /// of the range is not less than it. That stops the first forward scan,
+    /// and the pivot itself stops the backward scans, so the scans do not
+    /// need bounds checks.
+    ///\return The position of the pivot.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      TIterator
+      select_partition(TIterator first, TIterator last, TCompare& compare)
+    {
+      TIterator i = first;
+      TIterator j = last;
 
-  //***************************************************************************
-  /// partial_sort
-  ///\ingroup algorithm
-  ///< a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
-  //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR14 void partial_sort(TIterator first, TIterator middle, TIterator last)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+      while (true)
+      {
+        while (compare(*++i, *first)) {}
+        while (compare(*first, *--j)) {}
 
-    etl::partial_sort(first, middle, last, compare());
-  }
+        if (i >= j)
+        {
+          break;
+        }
 
-  //***************************************************************************
-  /// partial_sort_copy
-  ///\ingroup algorithm
-  ///< a
-  ///< href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
-  //***************************************************************************
-  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
-  ETL_CONSTEXPR14 TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first,
-                                                    TRandomAccessIterator d_last, TCompare compare)
-  {
-    typedef typename etl::iterator_traits<TRandomAccessIterator>::value_type      value_t;
-    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
+        swap(*i, *j);
+      }
 
-    TRandomAccessIterator result = d_first;
+      swap(*first, *j);
 
-    // Fill the destination range
-    while ((first != last) && (result != d_last))
-    {
-      *result = *first;
-      ++result;
-      ++first;
+      return j;
     }
 
-    if (result == d_first)
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      void
+      median_of_medians_select(TIterator first, TIterator nth, TIterator last, TCompare& compare);
+
+    //*********************************************************
+    /// Moves a pivot to *first that is guaranteed to have at least 30% of
+    /// [first, last) on each side. The medians of groups of five are
+    /// gathered at the front and their median is selected.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      void
+      median_of_medians_pivot(TIterator first, TIterator last, TCompare& compare)
     {
-      return result;
-    }
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
 
-    // Build a max-heap over the destination range
-    etl::make_heap(d_first, result, compare);
+      const difference_type n_groups = (last - first) / 5;
 
-    // Process remaining input elements
-    for (TInputIterator i = first; i != last; ++i)
-    {
-      if (compare(*i, *d_first))
+      for (difference_type group = 0; group < n_groups; ++group)
       {
-        value_t value = *i;
-        private_heap::adjust_heap(d_first, difference_t(0), difference_t(result - d_first), ETL_MOVE(value), compare);
+        TIterator group_first = first + (group * 5);
+
+        etl::insertion_sort(group_first, group_first + 5, compare);
+        swap(*(first + group), *(group_first + 2));
       }
+
+      median_of_medians_select(first, first + (n_groups / 2), first + n_groups, compare);
+
+      swap(*first, *(first + (n_groups / 2)));
     }
 
-    etl::sort_heap(d_first, result, compare);
+    //*********************************************************
+    /// Selects the nth element using only median of medians pivots.
+    /// O(N) in the worst case, but slower than introselect on most inputs.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      void
+      median_of_medians_select(TIterator first, TIterator nth, TIterator last, TCompare& compare)
+    {
+      while ((last - first) > Select_Insertion_Sort_Threshold)
+      {
+        median_of_medians_pivot(first, last, compare);
 
-    return result;
-  }
+        TIterator pivot = select_partition(first, last, compare);
 
-  //***************************************************************************
-  /// partial_sort_copy
-  ///\ingroup algorithm
-  ///< a
-  ///< href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
-  //***************************************************************************
-  template <typename TInputIterator, typename TRandomAccessIterator>
-  ETL_CONSTEXPR14 TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first,
-                                                    TRandomAccessIterator d_last)
-  {
-    typedef etl::less< typename etl::iterator_traits<TRandomAccessIterator>::value_type> compare;
+        if (pivot == nth)
+        {
+          return;
+        }
+        else if (nth < pivot)
+        {
+          last = pivot;
+        }
+        else
+        {
+          first = pivot + 1;
+        }
+      }
 
-    return etl::partial_sort_copy(first, last, d_first, d_last, compare());
-  }
+      etl::insertion_sort(first, last, compare);
+    }
 
-  //***************************************************************************
-  // Search
+    //*********************************************************
+    /// Introselect.
+    /// Quickselect with a median of three or pseudomedian of nine pivot.
+    /// After log2(N) partitions that leave more than 7/8 of the range to
+    /// search, it switches to median of medians pivots, so it is O(N) in the
+    /// worst case.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    constexpr
+#endif
+      void
+      introselect(TIterator first, TIterator nth, TIterator last, TCompare& compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      int bad_allowed = 0;
+
+      for (difference_type size = last - first; size > 1; size /= 2)
+      {
+        ++bad_allowed;
+      }
+
+      while ((last - first) > Select_Insertion_Sort_Threshold)
+      {
+        if (bad_allowed == 0)
+        {
+          median_of_medians_select(first, nth, last, compare);
+          return;
+        }
+
+        const difference_type size   = last - first;
+        TIterator             middle = first + (size / 2);
+        TIterator             pivot  = middle;
+
+        if (size > Select_Ninther_Threshold)
+        {
+          const difference_type eighth = size / 8;
+
+          pivot = median_of_three(median_of_three(first, first + eighth, first + (2 * eighth), compare),
+                                  median_of_three(middle - eighth, middle, middle + eighth, compare),
+                                  median_of_three(last - 1 - (2 * eighth), last - 1 - eighth, last - 1, compare), compare);
+        }
+        else
+        {
+          pivot = median_of_three(first, middle, last - 1, compare);
+        }
+
+        swap(*first, *pivot);
+
+        pivot = select_partition(first, last, compare);
+
+        if (pivot == nth)
+        {
+          return;
+        }
+        else if (nth < pivot)
+        {
+          last = pivot;
+        }
+        else
+        {
+          first = pivot + 1;
+        }
+
+        if ((last - first) > (size - (size / 8)))
+        {
+          --bad_allowed;
+        }
+      }
+
+      etl::insertion_sort(first, last, compare);
+    }
+  } // namespace private_algorithm
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Returns true if etl::pdq_sort may be used.
+    /// It is not constexpr, so constant expressions must use heap sort.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline bool is_pdq_sort_usable()
+    {
+#if ETL_NOT_USING_CPP14 || ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      return !etl::is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    //*************************************************************************
+    /// Returns true if [first, middle) should be sorted by selecting the
+    /// element at middle - 1 and sorting the elements before it, rather than
+    /// by streaming the range through a heap.
+    /// The heap is faster while middle - first is less than about 1/32nd of
+    /// the range.
+    //*************************************************************************
+    template <typename TDistance>
+    ETL_CONSTEXPR14 bool is_select_then_sort_faster(TDistance sorted_size, TDistance size)
+    {
+      return (sorted_size > TDistance(Select_Insertion_Sort_Threshold)) && (sorted_size > (size / 32)) && is_pdq_sort_usable();
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  /// partial_sort
+  /// When [first, middle) is a large part of the range, the element at
+  /// middle - 1 is found with introselect, and those before it are sorted.
+  /// Otherwise the range is streamed through a heap of middle - first elements.
+  ///\ingroup algorithm
+  ///< a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    if (first == middle)
+    {
+      return;
+    }
+
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if (private_algorithm::is_select_then_sort_faster(difference_t(middle - first), difference_t(last - first)))
+    {
+      private_algorithm::introselect(first, middle - 1, last, compare);
+      etl::pdq_sort(first, middle - 1, compare);
+      return;
+    }
+
+    etl::make_heap(first, middle, compare);
+
+    for (TIterator i = middle; i != last; ++i)
+    {
+      if (compare(*i, *first))
+      {
+        value_t value = ETL_MOVE(*i);
+        *i            = ETL_MOVE(*first);
+
+        private_heap::adjust_heap(first, difference_t(0), difference_t(middle - first), ETL_MOVE(value), compare);
+      }
+    }
+
+    etl::sort_heap(first, middle, compare);
+  }
+
+  //***************************************************************************
+  /// partial_sort
+  ///\ingroup algorithm
+  ///< a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::partial_sort(first, middle, last, compare());
+  }
+
+  //***************************************************************************
+  /// partial_sort_copy
+  /// Streams the input through a heap that holds no more than the
+  /// destination range, so the input may be a single pass range.
+  ///\ingroup algorithm
+  ///< a
+  ///< href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  ETL_CONSTEXPR14 TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first,
+                                                    TRandomAccessIterator d_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
+
+    TRandomAccessIterator result = d_first;
+
+    // Fill the destination range
+    while ((first != last) && (result != d_last))
+    {
+      *result = *first;
+      ++result;
+      ++first;
+    }
+
+    if (result == d_first)
+    {
+      return result;
+    }
+
+    if (private_algorithm::is_pdq_sort_usable())
+    {
+      if (first == last)
+      {
+        // All of the input fitted.
+        etl::pdq_sort(d_first, result, compare);
+        return result;
+      }
+    }
+
+    // Build a max-heap over the destination range
+    etl::make_heap(d_first, result, compare);
+
+    // Process remaining input elements
+    for (TInputIterator i = first; i != last; ++i)
+    {
+      if (compare(*i, *d_first))
+      {
+        value_t value = *i;
+        private_heap::adjust_heap(d_first, difference_t(0), difference_t(result - d_first), ETL_MOVE(value), compare);
+      }
+    }
+
+    if (private_algorithm::is_pdq_sort_usable())
+    {
+      etl::pdq_sort(d_first, result, compare);
+    }
+    else
+    {
+      etl::sort_heap(d_first, result, compare);
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// partial_sort_copy
+  ///\ingroup algorithm
+  ///< a
+  ///< href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  ETL_CONSTEXPR14 TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first,
+                                                    TRandomAccessIterator d_last)
+  {
+    typedef etl::less< typename etl::iterator_traits<TRandomAccessIterator>::value_type> compare;
+
+    return etl::partial_sort_copy(first, last, d_first, d_last, compare());
+  }
+
+  //***************************************************************************
+  // Search
   //***************************************************************************
   template <typename TIterator1, typename TIterator2, typename TCompare>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator1 search(TIterator1 first, TIterator1 last, TIterator2 search_first, TIterator2 search_last, TCompare compare)
@@ -1499,6 +1952,18 @@ namespace etl
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_minmax_vectorisable<TIterator> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::min_or_max_element(begin, end, true, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     return etl::min_element(begin, end, etl::less<value_t>());
   }
 
@@ -1540,6 +2005,18 @@ namespace etl
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_minmax_vectorisable<TIterator> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        return private_algorithm_simd::min_or_max_element(begin, end, false, etl::integral_constant<bool, vectorisable::value>());
+      }
+    }
+#endif
+
     return etl::max_element(begin, end, etl::less<value_t>());
   }
 
@@ -1587,6 +2064,23 @@ namespace etl
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_minmax_vectorisable<TIterator> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        TIterator minimum = begin;
+        TIterator maximum = begin;
+
+        private_algorithm_simd::minmax_element(begin, end, minimum, maximum, etl::integral_constant<bool, vectorisable::value>());
+
+        return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
+      }
+    }
+#endif
+
     return etl::minmax_element(begin, end, etl::less<value_t>());
   }
 
@@ -2195,7 +2689,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    etl::pdq_sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -2205,19 +2699,23 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::pdq_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// A merge sort with in-place rotation merges. O(N log^2 N).
+  /// Pass a scratch buffer to the four or five parameter overload for O(N log N).
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    etl::stable_sort(first, last, static_cast<value_type*>(ETL_NULLPTR), static_cast<value_type*>(ETL_NULLPTR), compare);
   }
 
   //***************************************************************************
@@ -2228,7 +2726,7 @@ namespace etl
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -2544,87 +3042,770 @@ namespace etl
   }
 
   //***************************************************************************
-  /// inplace_merge
-  /// Merges two consecutive sorted ranges [first, middle) and [middle, last)
-  /// into one sorted range [first, last) in-place.
-  /// Uses an iterative rotate-based algorithm that requires no additional
-  /// memory, no recursion and no explicit stack, making it safe for deeply
-  /// embedded targets with constrained stack sizes.
-  /// Complexity: O(N log N) comparisons, O(N log N) element moves.
-  /// see https://en.cppreference.com/w/cpp/algorithm/inplace_merge
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TBidirectionalIterator, typename TCompare>
-  void inplace_merge(TBidirectionalIterator first, TBidirectionalIterator middle, TBidirectionalIterator last, TCompare compare)
+  namespace private_algorithm
   {
-    typedef typename etl::iterator_traits<TBidirectionalIterator>::difference_type difference_type;
-
-    difference_type len1 = etl::distance(first, middle);
-    difference_type len2 = etl::distance(middle, last);
+    //*************************************************************************
+    /// The set operations gallop through the larger range when it is at least
+    /// this many times the size of the smaller one.
+    //*************************************************************************
+    template <typename TDistance>
+    ETL_CONSTEXPR14 bool is_gallop_faster(TDistance smaller, TDistance larger)
+    {
+      return smaller < (larger / 16);
+    }
 
-    while ((len1 != 0) && (len2 != 0))
+    //*************************************************************************
+    /// Finds the first element that is not less than the value, searching
+    /// from the start of the range in steps of 1, 2, 4, 8... before a binary
+    /// search of the last step. The cost depends on the distance to the
+    /// result rather than the size of the range.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator gallop_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare& compare)
     {
-      // Find where the first element of the right half belongs in the left
-      // half. All elements in [first, cut1) are <= *middle, so they are already
-      // in place.
-      TBidirectionalIterator cut1   = etl::upper_bound(first, middle, *middle, compare);
-      difference_type        prefix = etl::distance(first, cut1);
-      len1 -= prefix;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
 
-      // If the entire left half is <= *middle, we are done.
-      if (len1 == 0)
+      const difference_type size = last - first;
+
+      if ((size == 0) || !compare(*first, value))
       {
-        return;
+        return first;
       }
 
-      // Advance first past the already-placed prefix.
-      first = cut1;
-
-      // Find where the first element of the (remaining) left half belongs in
-      // the right half.  All elements in [middle, cut2) are < *first, so they
-      // need to be moved before *first.
-      TBidirectionalIterator cut2 = etl::lower_bound(middle, last, *first, compare);
-      difference_type        run  = etl::distance(middle, cut2);
-      len2 -= run;
+      // first[low] is less than the value.
+      difference_type low  = 0;
+      difference_type high = 1;
 
-      // Rotate the block [first, middle, cut2) so that [middle, cut2) moves
-      // before [first, middle).  After the rotate the elements from
-      // [middle, cut2) (length = run) now occupy [first, first + run) and
-      // are in their final position.
-      etl::rotate(first, middle, cut2);
+      while ((high < size) && compare(first[high], value))
+      {
+        low  = high;
+        high = (2 * high) + 1;
+      }
 
-      // Advance past the block we just placed.
-      etl::advance(first, run);
-      middle = cut2;
+      return etl::lower_bound(first + low + 1, first + ((high < size) ? high : size), value, compare);
     }
-  }
 
-  //***************************************************************************
-  /// inplace_merge
-  /// Merges two consecutive sorted ranges [first, middle) and [middle, last)
-  /// into one sorted range [first, last) in-place.
-  /// Uses operator< for comparison.
-  /// see https://en.cppreference.com/w/cpp/algorithm/inplace_merge
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TBidirectionalIterator>
-  void inplace_merge(TBidirectionalIterator first, TBidirectionalIterator middle, TBidirectionalIterator last)
-  {
-    typedef etl::less< typename etl::iterator_traits<TBidirectionalIterator>::value_type> compare;
+    //*************************************************************************
+    /// set_intersection, one element at a time.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_intersection_linear(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                            TCompare& compare)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (compare(*first1, *first2))
+        {
+          ++first1;
+        }
+        else
+        {
+          if (!compare(*first2, *first1))
+          {
+            *d_first = *first1;
+            ++d_first;
+            ++first1;
+          }
 
-    etl::inplace_merge(first, middle, last, compare());
-  }
-} // namespace etl
+          ++first2;
+        }
+      }
 
-//*****************************************************************************
-// ETL extensions to the STL algorithms.
-//*****************************************************************************
+      return d_first;
+    }
+
+    //*************************************************************************
+    /// set_intersection, galloping through the larger range.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_intersection_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                            TCompare& compare)
+    {
+      if ((last1 - first1) <= (last2 - first2))
+      {
+        for (; (first1 != last1) && (first2 != last2); ++first1)
+        {
+          first2 = gallop_lower_bound(first2, last2, *first1, compare);
+
+          if ((first2 != last2) && !compare(*first1, *first2))
+          {
+            *d_first = *first1;
+            ++d_first;
+            ++first2;
+          }
+        }
+      }
+      else
+      {
+        for (; (first1 != last1) && (first2 != last2); ++first2)
+        {
+          first1 = gallop_lower_bound(first1, last1, *first2, compare);
+
+          if ((first1 != last1) && !compare(*first2, *first1))
+          {
+            *d_first = *first1;
+            ++d_first;
+            ++first1;
+          }
+        }
+      }
+
+      return d_first;
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                     TCompare& compare, etl::true_type /*random access*/)
+    {
+      const size_t size1 = size_t(last1 - first1);
+      const size_t size2 = size_t(last2 - first2);
+
+      if (is_gallop_faster(size1, size2) || is_gallop_faster(size2, size1))
+      {
+        return set_intersection_gallop(first1, last1, first2, last2, d_first, compare);
+      }
+
+      return set_intersection_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                     TCompare& compare, etl::false_type /*random access*/)
+    {
+      return set_intersection_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    /// set_union, one element at a time.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_union_linear(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                     TCompare& compare)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (compare(*first2, *first1))
+        {
+          *d_first = *first2;
+          ++first2;
+        }
+        else
+        {
+          if (!compare(*first1, *first2))
+          {
+            ++first2;
+          }
+
+          *d_first = *first1;
+          ++first1;
+        }
+
+        ++d_first;
+      }
+
+      d_first = etl::copy(first1, last1, d_first);
+
+      return etl::copy(first2, last2, d_first);
+    }
+
+    //*************************************************************************
+    /// set_union, galloping through the larger range and copying the blocks
+    /// between the elements of the smaller.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_union_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                     TCompare& compare)
+    {
+      if ((last1 - first1) <= (last2 - first2))
+      {
+        for (; first1 != last1; ++first1)
+        {
+          TIterator2 block_end = gallop_lower_bound(first2, last2, *first1, compare);
+
+          d_first = etl::copy(first2, block_end, d_first);
+          first2  = block_end;
+
+          if ((first2 != last2) && !compare(*first1, *first2))
+          {
+            ++first2;
+          }
+
+          *d_first = *first1;
+          ++d_first;
+        }
+      }
+      else
+      {
+        for (; first2 != last2; ++first2)
+        {
+          TIterator1 block_end = gallop_lower_bound(first1, last1, *first2, compare);
+
+          d_first = etl::copy(first1, block_end, d_first);
+          first1  = block_end;
+
+          if ((first1 != last1) && !compare(*first2, *first1))
+          {
+            *d_first = *first1;
+            ++first1;
+          }
+          else
+          {
+            *d_first = *first2;
+          }
+
+          ++d_first;
+        }
+      }
+
+      d_first = etl::copy(first1, last1, d_first);
+
+      return etl::copy(first2, last2, d_first);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_union(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                              TCompare& compare, etl::true_type /*random access*/)
+    {
+      const size_t size1 = size_t(last1 - first1);
+      const size_t size2 = size_t(last2 - first2);
+
+      if (is_gallop_faster(size1, size2) || is_gallop_faster(size2, size1))
+      {
+        return set_union_gallop(first1, last1, first2, last2, d_first, compare);
+      }
+
+      return set_union_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_union(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                              TCompare& compare, etl::false_type /*random access*/)
+    {
+      return set_union_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    /// set_difference, one element at a time.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_difference_linear(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                          TCompare& compare)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (compare(*first1, *first2))
+        {
+          *d_first = *first1;
+          ++d_first;
+          ++first1;
+        }
+        else
+        {
+          if (!compare(*first2, *first1))
+          {
+            ++first1;
+          }
+
+          ++first2;
+        }
+      }
+
+      return etl::copy(first1, last1, d_first);
+    }
+
+    //*************************************************************************
+    /// set_difference, galloping through the larger range.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_difference_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                          TCompare& compare)
+    {
+      if ((last1 - first1) <= (last2 - first2))
+      {
+        for (; (first1 != last1) && (first2 != last2); ++first1)
+        {
+          first2 = gallop_lower_bound(first2, last2, *first1, compare);
+
+          if ((first2 != last2) && !compare(*first1, *first2))
+          {
+            ++first2;
+          }
+          else
+          {
+            *d_first = *first1;
+            ++d_first;
+          }
+        }
+      }
+      else
+      {
+        for (; (first1 != last1) && (first2 != last2); ++first2)
+        {
+          TIterator1 block_end = gallop_lower_bound(first1, last1, *first2, compare);
+
+          d_first = etl::copy(first1, block_end, d_first);
+          first1  = block_end;
+
+          if ((first1 != last1) && !compare(*first2, *first1))
+          {
+            ++first1;
+          }
+        }
+      }
+
+      return etl::copy(first1, last1, d_first);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_difference(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                   TCompare& compare, etl::true_type /*random access*/)
+    {
+      const size_t size1 = size_t(last1 - first1);
+      const size_t size2 = size_t(last2 - first2);
+
+      if (is_gallop_faster(size1, size2) || is_gallop_faster(size2, size1))
+      {
+        return set_difference_gallop(first1, last1, first2, last2, d_first, compare);
+      }
+
+      return set_difference_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator set_difference(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                   TCompare& compare, etl::false_type /*random access*/)
+    {
+      return set_difference_linear(first1, last1, first2, last2, d_first, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_random_access_pair
+      : etl::integral_constant<bool, etl::is_random_access_iterator<TIterator1>::value && etl::is_random_access_iterator<TIterator2>::value>
+    {
+    };
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  /// set_intersection
+  /// Copies the elements of the sorted range [first1, last1) that are also
+  /// in the sorted range [first2, last2).
+  /// When both ranges are random access and one is much larger than the
+  /// other, the larger is searched by galloping, so the complexity is
+  /// O(n log(m / n)) comparisons for sizes n < m.
+  /// see https://en.cppreference.com/w/cpp/algorithm/set_intersection
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                                   TOutputIterator d_first, TCompare compare)
+  {
+    return private_algorithm::set_intersection(first1, last1, first2, last2, d_first, compare,
+                                               private_algorithm::is_random_access_pair<TInputIterator1, TInputIterator2>());
+  }
+
+  //***************************************************************************
+  /// set_intersection
+  /// Uses operator< for comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                                   TOutputIterator d_first)
+  {
+    typedef etl::less<typename etl::iterator_traits<TInputIterator1>::value_type> compare;
+
+    return etl::set_intersection(first1, last1, first2, last2, d_first, compare());
+  }
+
+  //***************************************************************************
+  /// set_intersection
+  /// For ranges that are sorted and free of equivalent elements.
+  /// Pointers to 32 bit integers are intersected four elements against four
+  /// at a time with SIMD, when ETL_USING_SIMD_ALGORITHMS is enabled.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection(etl::sorted_unique_t, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2,
+                                                   TInputIterator2 last2, TOutputIterator d_first)
+  {
+#if ETL_USING_SIMD_ALGORITHMS
+    typedef private_algorithm_simd::is_intersect_vectorisable<TInputIterator1, TInputIterator2> vectorisable;
+
+    if ETL_IF_CONSTEXPR (vectorisable::value)
+    {
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t size1 = size_t(etl::distance(first1, last1));
+        const size_t size2 = size_t(etl::distance(first2, last2));
+
+        if (!private_algorithm::is_gallop_faster(size1, size2) && !private_algorithm::is_gallop_faster(size2, size1))
+        {
+          return private_algorithm_simd::set_intersection(first1, last1, first2, last2, d_first, etl::integral_constant<bool, vectorisable::value>());
+        }
+      }
+    }
+#endif
+
+    return etl::set_intersection(first1, last1, first2, last2, d_first);
+  }
+
+  //***************************************************************************
+  /// set_intersection
+  /// For ranges that are sorted and free of equivalent elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection(etl::sorted_unique_t, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2,
+                                                   TInputIterator2 last2, TOutputIterator d_first, TCompare compare)
+  {
+    return etl::set_intersection(first1, last1, first2, last2, d_first, compare);
+  }
+
+  //***************************************************************************
+  /// set_union
+  /// Copies the elements that are in either of the sorted ranges.
+  /// When both ranges are random access and one is much larger than the
+  /// other, the blocks of the larger between the elements of the smaller are
+  /// found by galloping and copied.
+  /// see https://en.cppreference.com/w/cpp/algorithm/set_union
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_union(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                            TOutputIterator d_first, TCompare compare)
+  {
+    return private_algorithm::set_union(first1, last1, first2, last2, d_first, compare,
+                                        private_algorithm::is_random_access_pair<TInputIterator1, TInputIterator2>());
+  }
+
+  //***************************************************************************
+  /// set_union
+  /// Uses operator< for comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_union(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                            TOutputIterator d_first)
+  {
+    typedef etl::less<typename etl::iterator_traits<TInputIterator1>::value_type> compare;
+
+    return etl::set_union(first1, last1, first2, last2, d_first, compare());
+  }
+
+  //***************************************************************************
+  /// set_difference
+  /// Copies the elements of the sorted range [first1, last1) that are not in
+  /// the sorted range [first2, last2).
+  /// When both ranges are random access and one is much larger than the
+  /// other, the larger is searched by galloping.
+  /// see https://en.cppreference.com/w/cpp/algorithm/set_difference
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_difference(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                                 TOutputIterator d_first, TCompare compare)
+  {
+    return private_algorithm::set_difference(first1, last1, first2, last2, d_first, compare,
+                                             private_algorithm::is_random_access_pair<TInputIterator1, TInputIterator2>());
+  }
+
+  //***************************************************************************
+  /// set_difference
+  /// Uses operator< for comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_difference(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                                 TOutputIterator d_first)
+  {
+    typedef etl::less<typename etl::iterator_traits<TInputIterator1>::value_type> compare;
+
+    return etl::set_difference(first1, last1, first2, last2, d_first, compare());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Merges [first, middle) and [middle, last) without a buffer.
+    /// Splits the larger half at its midpoint, rotates the matching block of
+    /// the other half across it and repeats for the two merges that remain.
+    /// The smaller of the two is recursed into and the larger is looped on,
+    /// so the recursion depth never exceeds log2(len1 + len2).
+    //*************************************************************************
+    template <typename TBidirectionalIterator, typename TDistance, typename TCompare>
+    void inplace_merge_without_buffer(TBidirectionalIterator first, TBidirectionalIterator middle, TBidirectionalIterator last, TDistance len1,
+                                      TDistance len2, TCompare compare)
+    {
+      while ((len1 != 0) && (len2 != 0))
+      {
+        if ((len1 + len2) == 2)
+        {
+          if (compare(*middle, *first))
+          {
+            etl::iter_swap(first, middle);
+          }
+
+          return;
+        }
+
+        TBidirectionalIterator cut1 = first;
+        TBidirectionalIterator cut2 = middle;
+        TDistance              n1;
+        TDistance              n2;
+
+        if (len1 > len2)
+        {
+          n1 = len1 / 2;
+          etl::advance(cut1, n1);
+          cut2 = etl::lower_bound(middle, last, *cut1, compare);
+          n2   = etl::distance(middle, cut2);
+        }
+        else
+        {
+          n2 = len2 / 2;
+          etl::advance(cut2, n2);
+          cut1 = etl::upper_bound(first, middle, *cut2, compare);
+          n1   = etl::distance(first, cut1);
+        }
+
+        // [cut1, middle) and [middle, cut2) swap places.
+        TBidirectionalIterator new_middle = cut1;
+        etl::advance(new_middle, n2);
+        etl::rotate(cut1, middle, cut2);
+
+        if ((n1 + n2) < ((len1 - n1) + (len2 - n2)))
+        {
+          inplace_merge_without_buffer(first, cut1, new_middle, n1, n2, compare);
+          first  = new_middle;
+          middle = cut2;
+          len1  -= n1;
+          len2  -= n2;
+        }
+        else
+        {
+          inplace_merge_without_buffer(new_middle, cut2, last, len1 - n1, len2 - n2, compare);
+          last   = new_middle;
+          middle = cut1;
+          len1   = n1;
+          len2   = n2;
+        }
+      }
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  /// inplace_merge
+  /// Merges two consecutive sorted ranges [first, middle) and [middle, last)
+  /// into one sorted range [first, last) in-place.
+  /// Uses a rotation based divide and conquer merge that requires no
+  /// additional memory. The recursion depth is bounded by log2(N), so the
+  /// stack use stays small and predictable on deeply embedded targets.
+  /// The merge is stable.
+  /// Complexity: O(N log N) comparisons, O(N log N) element moves.
+  /// Ranges that are already in order are detected with one comparison.
+  /// see https://en.cppreference.com/w/cpp/algorithm/inplace_merge
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TBidirectionalIterator, typename TCompare>
+  void inplace_merge(TBidirectionalIterator first, TBidirectionalIterator middle, TBidirectionalIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TBidirectionalIterator>::difference_type difference_type;
+
+    if ((first == middle) || (middle == last))
+    {
+      return;
+    }
+
+    TBidirectionalIterator last1 = middle;
+    --last1;
+
+    // Already in order?
+    if (!compare(*middle, *last1))
+    {
+      return;
+    }
+
+    difference_type len1 = etl::distance(first, middle);
+    difference_type len2 = etl::distance(middle, last);
+
+    private_algorithm::inplace_merge_without_buffer(first, middle, last, len1, len2, compare);
+  }
+
+  //***************************************************************************
+  /// inplace_merge
+  /// Merges two consecutive sorted ranges [first, middle) and [middle, last)
+  /// into one sorted range [first, last) in-place.
+  /// Uses operator< for comparison.
+  /// see https://en.cppreference.com/w/cpp/algorithm/inplace_merge
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TBidirectionalIterator>
+  void inplace_merge(TBidirectionalIterator first, TBidirectionalIterator middle, TBidirectionalIterator last)
+  {
+    typedef etl::less< typename etl::iterator_traits<TBidirectionalIterator>::value_type> compare;
+
+    etl::inplace_merge(first, middle, last, compare());
+  }
+} // namespace etl
+
+//*****************************************************************************
+// ETL extensions to the STL algorithms.
+//*****************************************************************************
 namespace etl
 {
   //***************************************************************************
-  /// copy_s
+  /// copy_s
+  /// A safer form of copy where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14
+    typename etl::enable_if< etl::is_random_iterator<TInputIterator>::value && etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+    copy_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  {
+    typedef typename iterator_traits<TInputIterator>::difference_type  s_size_type;
+    typedef typename iterator_traits<TOutputIterator>::difference_type d_size_type;
+
+#if ETL_USING_CPP11
+    typedef typename etl::common_type<s_size_type, d_size_type>::type min_size_type;
+#else
+    typedef typename etl::largest_type<s_size_type, d_size_type>::type min_size_type;
+#endif
+
+    s_size_type   s_size   = etl::distance(i_begin, i_end);
+    d_size_type   d_size   = etl::distance(o_begin, o_end);
+    min_size_type min_size = etl::min<min_size_type>(s_size, d_size);
+
+    return etl::copy(i_begin, i_begin + min_size, o_begin);
+  }
+
+  //***************************************************************************
+  /// copy
   /// A safer form of copy where the smallest of the two ranges is used.
   /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14 typename etl::enable_if< !etl::is_random_iterator<TInputIterator>::value || !etl::is_random_iterator<TOutputIterator>::value,
+                                     TOutputIterator>::type
+    copy_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TSize, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator copy_n_s(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TOutputIterator o_end)
+  {
+    while ((n-- > 0) && (o_begin != o_end))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TSize1, typename TOutputIterator, typename TSize2>
+  ETL_CONSTEXPR14 TOutputIterator copy_n_s(TInputIterator i_begin, TSize1 n1, TOutputIterator o_begin, TSize2 n2)
+  {
+    while ((n1-- > 0) && (n2-- > 0))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_if
+  /// A safer form of copy_if where it terminates when the first end iterator is
+  /// reached. There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator copy_if_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end,
+                                      TUnaryPredicate predicate)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = *i_begin;
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n_if
+  /// Combination of copy_n and copy_if.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator copy_n_if(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = *i_begin;
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
   /// Specialisation for random access iterators.
   ///\param i_begin Beginning of the input range.
   ///\param i_end   End of the input range.
@@ -2635,62 +3816,226 @@ namespace etl
   template <typename TInputIterator, typename TOutputIterator>
   ETL_CONSTEXPR14
     typename etl::enable_if< etl::is_random_iterator<TInputIterator>::value && etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-    copy_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+    move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
   {
-    typedef typename iterator_traits<TInputIterator>::difference_type  s_size_type;
-    typedef typename iterator_traits<TOutputIterator>::difference_type d_size_type;
+    using s_size_type   = typename iterator_traits<TInputIterator>::difference_type;
+    using d_size_type   = typename iterator_traits<TOutputIterator>::difference_type;
+    using min_size_type = typename etl::common_type<s_size_type, d_size_type>::type;
 
-#if ETL_USING_CPP11
-    typedef typename etl::common_type<s_size_type, d_size_type>::type min_size_type;
+    s_size_type   s_size   = etl::distance(i_begin, i_end);
+    d_size_type   d_size   = etl::distance(o_begin, o_end);
+    min_size_type min_size = etl::min<min_size_type>(s_size, d_size);
+
+    return etl::move(i_begin, i_begin + min_size, o_begin);
+  }
+
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14 typename etl::enable_if< !etl::is_random_iterator<TInputIterator>::value || !etl::is_random_iterator<TOutputIterator>::value,
+                                     TOutputIterator>::type
+    move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin = etl::move(*i_begin);
+      ++i_begin;
+      ++o_begin;
+    }
+
+    return o_begin;
+  }
 #else
-    typedef typename etl::largest_type<s_size_type, d_size_type>::type min_size_type;
+  //***************************************************************************
+  /// move_s
+  /// C++03
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  {
+    // Move not supported. Defer to copy.
+    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+  }
 #endif
 
-    s_size_type   s_size   = etl::distance(i_begin, i_end);
-    d_size_type   d_size   = etl::distance(o_begin, o_end);
-    min_size_type min_size = etl::min<min_size_type>(s_size, d_size);
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not
+  /// found.
+  //***************************************************************************
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator binary_find(TIterator begin, TIterator end, const TValue& value)
+  {
+    TIterator it = etl::lower_bound(begin, end, value);
+
+    if ((it == end) || (*it != value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not
+  /// found.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TBinaryPredicate, typename TBinaryEquality>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator binary_find(TIterator begin, TIterator end, const TValue& value, TBinaryPredicate predicate, TBinaryEquality equality)
+  {
+    TIterator it = etl::lower_bound(begin, end, value, predicate);
+
+    if ((it == end) || !equality(*it, value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryFunction, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TUnaryFunction for_each_if(TIterator begin, const TIterator end, TUnaryFunction function, TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
+
+    return function;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but for 'n' iterations.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TSize, typename TUnaryFunction>
+  ETL_CONSTEXPR14 TIterator for_each_n(TIterator begin, TSize n, TUnaryFunction function)
+  {
+    while (n-- > 0)
+    {
+      function(*begin);
+      ++begin;
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function,
+  /// for 'n' iterations
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TSize, typename TUnaryFunction, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TIterator for_each_n_if(TIterator begin, TSize n, TUnaryFunction function, TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
 
-    return etl::copy(i_begin, i_begin + min_size, o_begin);
+    return begin;
   }
 
   //***************************************************************************
-  /// copy
-  /// A safer form of copy where the smallest of the two ranges is used.
+  /// A safer form of std::transform where the transform returns when the first
+  /// range end is reached.
   /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  ETL_CONSTEXPR14 typename etl::enable_if< !etl::is_random_iterator<TInputIterator>::value || !etl::is_random_iterator<TOutputIterator>::value,
-                                     TOutputIterator>::type
-    copy_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  ETL_CONSTEXPR14 TOutputIterator transform_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end,
+                                        TUnaryFunction function)
   {
     while ((i_begin != i_end) && (o_begin != o_end))
     {
-      *o_begin = *i_begin;
-      ++o_begin;
+      *o_begin = function(*i_begin);
       ++i_begin;
+      ++o_begin;
     }
 
     return o_begin;
   }
 
   //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
+  /// Transform 'n' items.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TSize, typename TOutputIterator>
-  ETL_CONSTEXPR14 TOutputIterator copy_n_s(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TOutputIterator o_end)
+  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryFunction>
+  ETL_CONSTEXPR14 void transform_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryFunction function)
   {
-    while ((n-- > 0) && (o_begin != o_end))
+    TInputIterator i_end(i_begin);
+    etl::advance(i_end, n);
+
+    etl::transform(i_begin, i_end, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Transform 'n' items from two ranges.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TSize, typename TOutputIterator, typename TBinaryFunction>
+  ETL_CONSTEXPR14 void transform_n(TInputIterator1 i_begin1, TInputIterator2 i_begin2, TSize n, TOutputIterator o_begin, TBinaryFunction function)
+  {
+    TInputIterator1 i_end1(i_begin1);
+    etl::advance(i_end1, n);
+
+    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Like std::transform but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator transform_if(TInputIterator i_begin, const TInputIterator i_end, TOutputIterator o_begin, TUnaryFunction function,
+                                         TUnaryPredicate predicate)
+  {
+    while (i_begin != i_end)
     {
-      *o_begin = *i_begin;
-      ++o_begin;
+      if (predicate(*i_begin))
+      {
+        *o_begin = function(*i_begin);
+        ++o_begin;
+      }
+
       ++i_begin;
     }
 
@@ -2698,38 +4043,41 @@ namespace etl
   }
 
   //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
+  /// Like etl::transform_if but inputs from two ranges.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TSize1, typename TOutputIterator, typename TSize2>
-  ETL_CONSTEXPR14 TOutputIterator copy_n_s(TInputIterator i_begin, TSize1 n1, TOutputIterator o_begin, TSize2 n2)
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryFunction, typename TBinaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator transform_if(TInputIterator1 i_begin1, const TInputIterator1 i_end1, TInputIterator2 i_begin2, TOutputIterator o_begin,
+                                         TBinaryFunction function, TBinaryPredicate predicate)
   {
-    while ((n1-- > 0) && (n2-- > 0))
+    while (i_begin1 != i_end1)
     {
-      *o_begin = *i_begin;
-      ++o_begin;
-      ++i_begin;
+      if (predicate(*i_begin1, *i_begin2))
+      {
+        *o_begin = function(*i_begin1, *i_begin2);
+        ++o_begin;
+      }
+
+      ++i_begin1;
+      ++i_begin2;
     }
 
     return o_begin;
   }
 
   //***************************************************************************
-  /// copy_if
-  /// A safer form of copy_if where it terminates when the first end iterator is
-  /// reached. There is currently no STL equivalent.
+  /// Like std::transform_if, for 'n' items.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator copy_if_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end,
-                                      TUnaryPredicate predicate)
+  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryFunction, typename TUnaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator transform_n_if(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryFunction function,
+                                           TUnaryPredicate predicate)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (n-- > 0)
     {
       if (predicate(*i_begin))
       {
-        *o_begin = *i_begin;
+        *o_begin = function(*i_begin);
         ++o_begin;
       }
 
@@ -2740,589 +4088,1142 @@ namespace etl
   }
 
   //***************************************************************************
-  /// copy_n_if
-  /// Combination of copy_n and copy_if.
+  /// Like etl::transform_if but inputs from two ranges for 'n' items.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator copy_n_if(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryPredicate predicate)
+  template <typename TInputIterator1, typename TInputIterator2, typename TSize, typename TOutputIterator, typename TBinaryFunction,
+            typename TBinaryPredicate>
+  ETL_CONSTEXPR14 TOutputIterator transform_n_if(TInputIterator1 i_begin1, TInputIterator2 i_begin2, TSize n, TOutputIterator o_begin,
+                                           TBinaryFunction function, TBinaryPredicate predicate)
   {
     while (n-- > 0)
     {
-      if (predicate(*i_begin))
+      if (predicate(*i_begin1, *i_begin2))
       {
-        *o_begin = *i_begin;
-        ++o_begin;
+        *o_begin++ = function(*i_begin1, *i_begin2);
       }
 
-      ++i_begin;
+      ++i_begin1;
+      ++i_begin2;
     }
 
     return o_begin;
   }
 
-#if ETL_USING_CPP11
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Transforms the elements from the range (begin, end) to two different
+  /// ranges depending on the value returned by the predicate.<br>
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  ETL_CONSTEXPR14
-    typename etl::enable_if< etl::is_random_iterator<TInputIterator>::value && etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-    move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14 ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>
+    partition_transform(TSource begin, TSource end, TDestinationTrue destination_true, TDestinationFalse destination_false,
+                        TUnaryFunctionTrue function_true, TUnaryFunctionFalse function_false, TUnaryPredicate predicate)
   {
-    using s_size_type   = typename iterator_traits<TInputIterator>::difference_type;
-    using d_size_type   = typename iterator_traits<TOutputIterator>::difference_type;
-    using min_size_type = typename etl::common_type<s_size_type, d_size_type>::type;
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        *destination_true = function_true(*begin);
+        ++destination_true;
+      }
+      else
+      {
+        *destination_false = function_false(*begin);
+        ++destination_false;
+      }
 
-    s_size_type   s_size   = etl::distance(i_begin, i_end);
-    d_size_type   d_size   = etl::distance(o_begin, o_end);
-    min_size_type min_size = etl::min<min_size_type>(s_size, d_size);
+      ++begin;
+    }
 
-    return etl::move(i_begin, i_begin + min_size, o_begin);
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
 
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
+  /// to two different ranges depending on the value returned by the predicate.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  ETL_CONSTEXPR14 typename etl::enable_if< !etl::is_random_iterator<TInputIterator>::value || !etl::is_random_iterator<TOutputIterator>::value,
-                                     TOutputIterator>::type
-    move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  template <typename TSource1, typename TSource2, typename TDestinationTrue, typename TDestinationFalse, typename TBinaryFunctionTrue,
+            typename TBinaryFunctionFalse, typename TBinaryPredicate>
+  ETL_CONSTEXPR14 ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>
+    partition_transform(TSource1 begin1, TSource1 end1, TSource2 begin2, TDestinationTrue destination_true, TDestinationFalse destination_false,
+                        TBinaryFunctionTrue function_true, TBinaryFunctionFalse function_false, TBinaryPredicate predicate)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (begin1 != end1)
     {
-      *o_begin = etl::move(*i_begin);
-      ++i_begin;
-      ++o_begin;
+      if (predicate(*begin1, *begin2))
+      {
+        *destination_true = function_true(*begin1, *begin2);
+        ++destination_true;
+      }
+      else
+      {
+        *destination_false = function_false(*begin1, *begin2);
+        ++destination_false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using shell sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+    void
+    shell_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (first == last)
+    {
+      return;
+    }
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t n = etl::distance(first, last);
+
+    for (difference_t i = n / 2; i > 0; i /= 2)
+    {
+      for (difference_t j = i; j < n; ++j)
+      {
+        for (difference_t k = j - i; k >= 0; k -= i)
+        {
+          TIterator itr1 = first;
+          TIterator itr2 = first;
+
+          etl::advance(itr1, k);
+          etl::advance(itr2, k + i);
+
+          if (compare(*itr2, *itr1))
+          {
+            etl::iter_swap(itr1, itr2);
+          }
+        }
+      }
     }
-
-    return o_begin;
   }
-#else
+
   //***************************************************************************
-  /// move_s
-  /// C++03
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Sorts the elements using shell sort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  TOutputIterator move_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end)
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+    void
+    shell_sort(TIterator first, TIterator last)
   {
-    // Move not supported. Defer to copy.
-    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
-#endif
 
   //***************************************************************************
-  /// binary_find
+  /// Sorts the elements using insertion sort.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not
-  /// found.
   //***************************************************************************
-  template <typename TIterator, typename TValue>
-  ETL_NODISCARD ETL_CONSTEXPR14 TIterator binary_find(TIterator begin, TIterator end, const TValue& value)
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare)
   {
-    TIterator it = etl::lower_bound(begin, end, value);
-
-    if ((it == end) || (*it != value))
+    for (TIterator itr = first; itr != last; ++itr)
     {
-      it = end;
+      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
     }
-
-    return it;
   }
 
   //***************************************************************************
-  /// binary_find
+  /// Sorts the elements using insertion sort.
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not
-  /// found.
   //***************************************************************************
-  template <typename TIterator, typename TValue, typename TBinaryPredicate, typename TBinaryEquality>
-  ETL_NODISCARD ETL_CONSTEXPR14 TIterator binary_find(TIterator begin, TIterator end, const TValue& value, TBinaryPredicate predicate, TBinaryEquality equality)
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last)
   {
-    TIterator it = etl::lower_bound(begin, end, value, predicate);
-
-    if ((it == end) || !equality(*it, value))
-    {
-      it = end;
-    }
-
-    return it;
+    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryFunction, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TUnaryFunction for_each_if(TIterator begin, const TIterator end, TUnaryFunction function, TUnaryPredicate predicate)
+  namespace private_algorithm
   {
-    while (begin != end)
+    template <typename TIterator>
+    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator first_, TIterator last_)
     {
-      if (predicate(*begin))
+      TIterator last      = first_;
+      TIterator lastplus1 = first_;
+      ++lastplus1;
+
+      while (lastplus1 != last_)
       {
-        function(*begin);
+        ++last;
+        ++lastplus1;
       }
 
-      ++begin;
+      return last;
     }
 
-    return function;
-  }
+    template <typename TIterator>
+    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator /*first_*/,
+                                                                                                                         TIterator last_)
+    {
+      TIterator last = last_;
+      --last;
+
+      return last;
+    }
+
+    template <typename TIterator>
+    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator /*first_*/,
+                                                                                                                         TIterator last_)
+    {
+      return last_ - 1;
+    }
+  } // namespace private_algorithm
 
   //***************************************************************************
-  /// Like std::for_each but for 'n' iterations.
+  /// Sorts the elements using selection sort.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TSize, typename TUnaryFunction>
-  ETL_CONSTEXPR14 TIterator for_each_n(TIterator begin, TSize n, TUnaryFunction function)
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR20 void selection_sort(TIterator first, TIterator last, TCompare compare)
   {
-    while (n-- > 0)
+    if (first == last)
     {
-      function(*begin);
-      ++begin;
+      return;
     }
 
-    return begin;
-  }
+    TIterator       min;
+    const TIterator ilast = private_algorithm::get_before_last(first, last);
+    const TIterator jlast = last;
 
-  //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function,
-  /// for 'n' iterations
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TSize, typename TUnaryFunction, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TIterator for_each_n_if(TIterator begin, TSize n, TUnaryFunction function, TUnaryPredicate predicate)
-  {
-    while (n-- > 0)
+    for (TIterator i = first; i != ilast; ++i)
     {
-      if (predicate(*begin))
+      min = i;
+
+      TIterator j = i;
+      ++j;
+
+      for (; j != jlast; ++j)
       {
-        function(*begin);
+        if (compare(*j, *min))
+        {
+          min = j;
+        }
       }
 
-      ++begin;
+      using ETL_OR_STD::swap; // Allow ADL
+      if (min != i)
+      {
+        swap(*i, *min);
+      }
     }
-
-    return begin;
   }
 
   //***************************************************************************
-  /// A safer form of std::transform where the transform returns when the first
-  /// range end is reached.
-  /// There is currently no STL equivalent.
+  /// Sorts the elements using selection sort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
-  ETL_CONSTEXPR14 TOutputIterator transform_s(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TOutputIterator o_end,
-                                        TUnaryFunction function)
+  template <typename TIterator>
+  ETL_CONSTEXPR20 void selection_sort(TIterator first, TIterator last)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
-    {
-      *o_begin = function(*i_begin);
-      ++i_begin;
-      ++o_begin;
-    }
-
-    return o_begin;
+    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Transform 'n' items.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
+  /// Sorts the elements using heap sort.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryFunction>
-  ETL_CONSTEXPR14 void transform_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryFunction function)
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last, TCompare compare)
   {
-    TInputIterator i_end(i_begin);
-    etl::advance(i_end, n);
-
-    etl::transform(i_begin, i_end, o_begin, function);
+    etl::make_heap(first, last, compare);
+    etl::sort_heap(first, last, compare);
   }
 
   //***************************************************************************
-  /// Transform 'n' items from two ranges.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
+  /// Sorts the elements using heap sort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator1, typename TInputIterator2, typename TSize, typename TOutputIterator, typename TBinaryFunction>
-  ETL_CONSTEXPR14 void transform_n(TInputIterator1 i_begin1, TInputIterator2 i_begin2, TSize n, TOutputIterator o_begin, TBinaryFunction function)
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last)
   {
-    TInputIterator1 i_end1(i_begin1);
-    etl::advance(i_end1, n);
-
-    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
+    etl::make_heap(first, last);
+    etl::sort_heap(first, last);
   }
 
   //***************************************************************************
-  /// Like std::transform but applies a predicate before calling the function.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator transform_if(TInputIterator i_begin, const TInputIterator i_end, TOutputIterator o_begin, TUnaryFunction function,
-                                         TUnaryPredicate predicate)
+  namespace private_pdq_sort
   {
-    while (i_begin != i_end)
+    enum
     {
-      if (predicate(*i_begin))
+      Insertion_Sort_Threshold     = 24,  ///< Partitions below this size are insertion sorted.
+      Ninther_Threshold            = 128, ///< Partitions above this size use a pseudomedian of nine as the pivot.
+      Partial_Insertion_Sort_Limit = 8,   ///< Moves allowed before giving up on a partial insertion sort.
+      Block_Size                   = 64   ///< Elements classified per block by the branchless partition.
+    };
+
+    //*************************************************************************
+    /// Sorts [first, last) using insertion sort.
+    /// If 'guarded' is false then the element before 'first' must be no
+    /// greater than any element in the range. It then acts as a sentinel.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare, bool guarded)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
       {
-        *o_begin = function(*i_begin);
-        ++o_begin;
+        return;
       }
 
-      ++i_begin;
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((!guarded || (sift != first)) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Attempts to insertion sort [first, last).
+    /// Gives up, returning false, when more than Partial_Insertion_Sort_Limit
+    /// elements have had to be moved.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      ptrdiff_t moves = 0;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+          moves += current - sift;
+        }
+
+        if (moves > Partial_Insertion_Sort_Limit)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Orders *a and *b.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
     }
 
-    return o_begin;
-  }
+    //*************************************************************************
+    /// Orders *a, *b and *c.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      sort2(a, b, compare);
+      sort2(b, c, compare);
+      sort2(a, b, compare);
+    }
 
-  //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryFunction, typename TBinaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator transform_if(TInputIterator1 i_begin1, const TInputIterator1 i_end1, TInputIterator2 i_begin2, TOutputIterator o_begin,
-                                         TBinaryFunction function, TBinaryPredicate predicate)
-  {
-    while (i_begin1 != i_end1)
+    //*************************************************************************
+    /// Swaps the elements at the offsets found by the branchless partition.
+    //*************************************************************************
+    template <typename TIterator>
+    void swap_offsets(TIterator first, TIterator last, const unsigned char* offsets_l, const unsigned char* offsets_r, size_t n, bool use_swaps)
     {
-      if (predicate(*i_begin1, *i_begin2))
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (use_swaps)
       {
-        *o_begin = function(*i_begin1, *i_begin2);
-        ++o_begin;
+        // Keeps the descending case O(N), as a cyclic permutation would not.
+        for (size_t i = 0U; i < n; ++i)
+        {
+          etl::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
       }
+      else if (n > 0U)
+      {
+        TIterator  l = first + offsets_l[0];
+        TIterator  r = last - offsets_r[0];
+        value_type temp(ETL_MOVE(*l));
+        *l = ETL_MOVE(*r);
 
-      ++i_begin1;
-      ++i_begin2;
-    }
+        for (size_t i = 1U; i < n; ++i)
+        {
+          l  = first + offsets_l[i];
+          *r = ETL_MOVE(*l);
+          r  = last - offsets_r[i];
+          *l = ETL_MOVE(*r);
+        }
 
-    return o_begin;
-  }
+        *r = ETL_MOVE(temp);
+      }
+    }
 
-  //***************************************************************************
-  /// Like std::transform_if, for 'n' items.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TUnaryFunction, typename TUnaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator transform_n_if(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TUnaryFunction function,
-                                           TUnaryPredicate predicate)
-  {
-    while (n-- > 0)
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the right.
+    /// Elements are classified a block at a time into offset buffers, so the
+    /// comparisons do not cause branches. Then the misplaced ones are swapped.
+    ///\return The pivot position and whether the range was already partitioned.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> partition_right_branchless(TIterator begin, TIterator end, TCompare compare)
     {
-      if (predicate(*i_begin))
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*begin));
+      TIterator  first = begin;
+      TIterator  last  = end;
+
+      // Find the first element greater than or equal to the pivot.
+      // The median of three guarantees that one exists.
+      while (compare(*++first, pivot)) {}
+
+      // Find the first element strictly smaller than the pivot.
+      if ((first - 1) == begin)
       {
-        *o_begin = function(*i_begin);
-        ++o_begin;
+        while ((first < last) && !compare(*--last, pivot)) {}
+      }
+      else
+      {
+        while (!compare(*--last, pivot)) {}
       }
 
-      ++i_begin;
-    }
-
-    return o_begin;
-  }
+      const bool already_partitioned = (first >= last);
 
-  //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges for 'n' items.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator1, typename TInputIterator2, typename TSize, typename TOutputIterator, typename TBinaryFunction,
-            typename TBinaryPredicate>
-  ETL_CONSTEXPR14 TOutputIterator transform_n_if(TInputIterator1 i_begin1, TInputIterator2 i_begin2, TSize n, TOutputIterator o_begin,
-                                           TBinaryFunction function, TBinaryPredicate predicate)
-  {
-    while (n-- > 0)
-    {
-      if (predicate(*i_begin1, *i_begin2))
+      if (!already_partitioned)
       {
-        *o_begin++ = function(*i_begin1, *i_begin2);
+        etl::iter_swap(first, last);
+        ++first;
+
+        unsigned char offsets_l[Block_Size];
+        unsigned char offsets_r[Block_Size];
+
+        TIterator offsets_l_base = first;
+        TIterator offsets_r_base = last;
+        size_t    num_l          = 0U;
+        size_t    num_r          = 0U;
+        size_t    start_l        = 0U;
+        size_t    start_r        = 0U;
+
+        while (first < last)
+        {
+          // Fill the offset blocks that are empty.
+          const size_t num_unknown = size_t(last - first);
+          const size_t left_split  = (num_l == 0U) ? ((num_r == 0U) ? (num_unknown / 2U) : num_unknown) : 0U;
+          const size_t right_split = (num_r == 0U) ? (num_unknown - left_split) : 0U;
+          const size_t n_left      = (left_split < size_t(Block_Size)) ? left_split : size_t(Block_Size);
+          const size_t n_right     = (right_split < size_t(Block_Size)) ? right_split : size_t(Block_Size);
+
+          for (size_t i = 0U; i < n_left; ++i)
+          {
+            offsets_l[num_l] = static_cast<unsigned char>(i);
+            num_l += !compare(*first, pivot) ? 1U : 0U;
+            ++first;
+          }
+
+          for (size_t i = 0U; i < n_right; ++i)
+          {
+            offsets_r[num_r] = static_cast<unsigned char>(i + 1U);
+            num_r += compare(*--last, pivot) ? 1U : 0U;
+          }
+
+          // Swap the elements that are on the wrong side.
+          const size_t n = (num_l < num_r) ? num_l : num_r;
+          swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, n, num_l == num_r);
+
+          num_l   -= n;
+          num_r   -= n;
+          start_l += n;
+          start_r += n;
+
+          if (num_l == 0U)
+          {
+            start_l        = 0U;
+            offsets_l_base = first;
+          }
+
+          if (num_r == 0U)
+          {
+            start_r        = 0U;
+            offsets_r_base = last;
+          }
+        }
+
+        // One of the blocks may still hold misplaced elements.
+        if (num_l != 0U)
+        {
+          while (num_l-- != 0U)
+          {
+            etl::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+          }
+
+          first = last;
+        }
+
+        if (num_r != 0U)
+        {
+          while (num_r-- != 0U)
+          {
+            etl::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+            ++first;
+          }
+
+          last = first;
+        }
       }
 
-      ++i_begin1;
-      ++i_begin2;
-    }
+      // Put the pivot in the right place.
+      TIterator pivot_position = first - 1;
+      *begin                   = ETL_MOVE(*pivot_position);
+      *pivot_position          = ETL_MOVE(pivot);
 
-    return o_begin;
-  }
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
 
-  //***************************************************************************
-  /// Transforms the elements from the range (begin, end) to two different
-  /// ranges depending on the value returned by the predicate.<br>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14 ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>
-    partition_transform(TSource begin, TSource end, TDestinationTrue destination_true, TDestinationFalse destination_false,
-                        TUnaryFunctionTrue function_true, TUnaryFunctionFalse function_false, TUnaryPredicate predicate)
-  {
-    while (begin != end)
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the right.
+    ///\return The pivot position and whether the range was already partitioned.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> partition_right(TIterator begin, TIterator end, TCompare compare)
     {
-      if (predicate(*begin))
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*begin));
+      TIterator  first = begin;
+      TIterator  last  = end;
+
+      while (compare(*++first, pivot)) {}
+
+      if ((first - 1) == begin)
       {
-        *destination_true = function_true(*begin);
-        ++destination_true;
+        while ((first < last) && !compare(*--last, pivot)) {}
       }
       else
       {
-        *destination_false = function_false(*begin);
-        ++destination_false;
+        while (!compare(*--last, pivot)) {}
       }
 
-      ++begin;
-    }
+      const bool already_partitioned = (first >= last);
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
-  }
+      while (first < last)
+      {
+        etl::iter_swap(first, last);
+        while (compare(*++first, pivot)) {}
+        while (!compare(*--last, pivot)) {}
+      }
 
-  //***************************************************************************
-  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
-  /// to two different ranges depending on the value returned by the predicate.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TSource1, typename TSource2, typename TDestinationTrue, typename TDestinationFalse, typename TBinaryFunctionTrue,
-            typename TBinaryFunctionFalse, typename TBinaryPredicate>
-  ETL_CONSTEXPR14 ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>
-    partition_transform(TSource1 begin1, TSource1 end1, TSource2 begin2, TDestinationTrue destination_true, TDestinationFalse destination_false,
-                        TBinaryFunctionTrue function_true, TBinaryFunctionFalse function_false, TBinaryPredicate predicate)
-  {
-    while (begin1 != end1)
+      TIterator pivot_position = first - 1;
+      *begin                   = ETL_MOVE(*pivot_position);
+      *pivot_position          = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the left. Used when the pivot equals
+    /// the element before the range, so that all of the equal elements are
+    /// put in place in one pass.
+    ///\return The pivot position.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator begin, TIterator end, TCompare compare)
     {
-      if (predicate(*begin1, *begin2))
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*begin));
+      TIterator  first = begin;
+      TIterator  last  = end;
+
+      while (compare(pivot, *--last)) {}
+
+      if ((last + 1) == end)
       {
-        *destination_true = function_true(*begin1, *begin2);
-        ++destination_true;
+        while ((first < last) && !compare(pivot, *++first)) {}
       }
       else
       {
-        *destination_false = function_false(*begin1, *begin2);
-        ++destination_false;
+        while (!compare(pivot, *++first)) {}
       }
 
-      ++begin1;
-      ++begin2;
-    }
+      while (first < last)
+      {
+        etl::iter_swap(first, last);
+        while (compare(pivot, *--last)) {}
+        while (!compare(pivot, *++first)) {}
+      }
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
-  }
+      TIterator pivot_position = last;
+      *begin                   = ETL_MOVE(*pivot_position);
+      *pivot_position          = ETL_MOVE(pivot);
 
-  //***************************************************************************
-  /// Sorts the elements using shell sort.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-#if ETL_USING_STD_NAMESPACE
-  ETL_CONSTEXPR20
-#else
-  ETL_CONSTEXPR14
-#endif
-    void
-    shell_sort(TIterator first, TIterator last, TCompare compare)
-  {
-    if (first == last)
-    {
-      return;
+      return pivot_position;
     }
 
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    //*************************************************************************
+    /// Swaps a few elements to break up a pattern that caused a badly
+    /// unbalanced partition of [first, last) of size 'n'.
+    //*************************************************************************
+    template <typename TIterator>
+    void shuffle_partition(TIterator first, TIterator last, ptrdiff_t n)
+    {
+      if (n >= Insertion_Sort_Threshold)
+      {
+        etl::iter_swap(first, first + (n / 4));
+        etl::iter_swap(last - 1, last - (n / 4));
 
-    difference_t n = etl::distance(first, last);
+        if (n > Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + ((n / 4) + 1));
+          etl::iter_swap(first + 2, first + ((n / 4) + 2));
+          etl::iter_swap(last - 2, last - ((n / 4) + 1));
+          etl::iter_swap(last - 3, last - ((n / 4) + 2));
+        }
+      }
+    }
 
-    for (difference_t i = n / 2; i > 0; i /= 2)
+    //*************************************************************************
+    /// The pattern-defeating quicksort loop.
+    /// Recurses into the smaller partition and loops on the larger, so the
+    /// recursion depth is bounded by log2(N).
+    /// 'bad_allowed' is the number of badly unbalanced partitions allowed
+    /// before switching to heap sort. 'leftmost' is true if there is no
+    /// element before 'first' that may be used as a sentinel.
+    //*************************************************************************
+    template <bool Branchless, typename TIterator, typename TCompare>
+    void pdq_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
     {
-      for (difference_t j = i; j < n; ++j)
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      while (true)
       {
-        for (difference_t k = j - i; k >= 0; k -= i)
+        const difference_type size = last - first;
+
+        if (size < Insertion_Sort_Threshold)
         {
-          TIterator itr1 = first;
-          TIterator itr2 = first;
+          private_pdq_sort::insertion_sort(first, last, compare, leftmost);
+          return;
+        }
 
-          etl::advance(itr1, k);
-          etl::advance(itr2, k + i);
+        // Choose the pivot as the median of three or pseudomedian of nine.
+        const difference_type half = size / 2;
 
-          if (compare(*itr2, *itr1))
+        if (size > Ninther_Threshold)
+        {
+          sort3(first, first + half, last - 1, compare);
+          sort3(first + 1, first + (half - 1), last - 2, compare);
+          sort3(first + 2, first + (half + 1), last - 3, compare);
+          sort3(first + (half - 1), first + half, first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          sort3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot equals the element before the range then every element
+        // equal to it is already in place once partitioned to the left.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = private_pdq_sort::partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> result;
+
+        if ETL_IF_CONSTEXPR (Branchless)
+        {
+          result = private_pdq_sort::partition_right_branchless(first, last, compare);
+        }
+        else
+        {
+          result = private_pdq_sort::partition_right(first, last, compare);
+        }
+
+        TIterator  pivot_position      = result.first;
+        const bool already_partitioned = result.second;
+
+        const difference_type l_size = pivot_position - first;
+        const difference_type r_size = last - (pivot_position + 1);
+
+        if ((l_size < (size / 8)) || (r_size < (size / 8)))
+        {
+          // Too many bad partitions. Fall back to the guaranteed O(N log N).
+          if (--bad_allowed == 0)
           {
-            etl::iter_swap(itr1, itr2);
+            etl::heap_sort(first, last, compare);
+            return;
           }
+
+          shuffle_partition(first, pivot_position, l_size);
+          shuffle_partition(pivot_position + 1, last, r_size);
+        }
+        else if (already_partitioned && private_pdq_sort::partial_insertion_sort(first, pivot_position, compare) &&
+                 private_pdq_sort::partial_insertion_sort(pivot_position + 1, last, compare))
+        {
+          // The range was sorted, or very nearly so.
+          return;
         }
-      }
-    }
-  }
 
-  //***************************************************************************
-  /// Sorts the elements using shell sort.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-#if ETL_USING_STD_NAMESPACE
-  ETL_CONSTEXPR20
-#else
-  ETL_CONSTEXPR14
-#endif
-    void
-    shell_sort(TIterator first, TIterator last)
-  {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
+        if (l_size < r_size)
+        {
+          pdq_sort_loop<Branchless>(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          pdq_sort_loop<Branchless>(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+  } // namespace private_pdq_sort
 
   //***************************************************************************
-  /// Sorts the elements using insertion sort.
+  /// Sorts the elements using pattern-defeating quicksort.
+  /// A quicksort that falls back to heap sort after too many unbalanced
+  /// partitions, so is O(N log N) in the worst case. It is O(N) for sorted,
+  /// reversed and few unique inputs. Arithmetic and pointer values are
+  /// partitioned without branching on the comparisons.
+  /// Not stable. Requires random access iterators.
+  /// Based on pdqsort by Orson Peters.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare)
+  void pdq_sort(TIterator first, TIterator last, TCompare compare)
   {
-    for (TIterator itr = first; itr != last; ++itr)
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    ptrdiff_t size = last - first;
+
+    if (size < 2)
     {
-      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
+      return;
+    }
+
+    // Allow about log2(N) bad partitions.
+    int bad_allowed = 0;
+
+    while (size != 0)
+    {
+      ++bad_allowed;
+      size >>= 1;
     }
+
+    static ETL_CONSTANT bool Branchless = etl::is_arithmetic<value_type>::value || etl::is_pointer<value_type>::value;
+
+    private_pdq_sort::pdq_sort_loop<Branchless>(first, last, compare, bad_allowed, true);
   }
 
   //***************************************************************************
-  /// Sorts the elements using insertion sort.
+  /// Sorts the elements using pattern-defeating quicksort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
-  ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last)
+  void pdq_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::pdq_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   namespace private_algorithm
   {
-    template <typename TIterator>
-    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator first_, TIterator last_)
+    enum
     {
-      TIterator last      = first_;
-      TIterator lastplus1 = first_;
-      ++lastplus1;
+      Merge_Sort_Run_Size = 16 ///< Runs of up to this size are insertion sorted before merging.
+    };
 
-      while (lastplus1 != last_)
+    //*************************************************************************
+    /// Merges [first, middle) and [middle, last) using the scratch buffer.
+    /// The smaller half is moved to the buffer when it fits, and merged back
+    /// in one pass. Otherwise the halves are split and rotated as for
+    /// inplace_merge_without_buffer, until the pieces fit.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last, TDistance len1, TDistance len2, TBufferIterator buffer,
+                        TDistance buffer_size, TCompare compare)
+    {
+      if (buffer_size == 0)
       {
-        ++last;
-        ++lastplus1;
+        private_algorithm::inplace_merge_without_buffer(first, middle, last, len1, len2, compare);
+        return;
       }
 
-      return last;
-    }
+      while ((len1 != 0) && (len2 != 0))
+      {
+        if ((len1 <= len2) && (len1 <= buffer_size))
+        {
+          // Merge forwards from the buffered left half.
+          TBufferIterator itr        = buffer;
+          TBufferIterator buffer_end = etl::move(first, middle, buffer);
 
-    template <typename TIterator>
-    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator /*first_*/,
-                                                                                                                         TIterator last_)
-    {
-      TIterator last = last_;
-      --last;
+          while ((itr != buffer_end) && (middle != last))
+          {
+            if (compare(*middle, *itr))
+            {
+              *first = ETL_MOVE(*middle);
+              ++middle;
+            }
+            else
+            {
+              *first = ETL_MOVE(*itr);
+              ++itr;
+            }
 
-      return last;
+            ++first;
+          }
+
+          etl::move(itr, buffer_end, first);
+          return;
+        }
+
+        if (len2 <= buffer_size)
+        {
+          // Merge backwards from the buffered right half.
+          TBufferIterator buffer_end = etl::move(middle, last, buffer);
+
+          while ((buffer_end != buffer) && (middle != first))
+          {
+            if (compare(*(buffer_end - 1), *(middle - 1)))
+            {
+              *--last = ETL_MOVE(*--middle);
+            }
+            else
+            {
+              *--last = ETL_MOVE(*--buffer_end);
+            }
+          }
+
+          etl::move_backward(buffer, buffer_end, last);
+          return;
+        }
+
+        TIterator cut1 = first;
+        TIterator cut2 = middle;
+        TDistance n1;
+        TDistance n2;
+
+        if (len1 > len2)
+        {
+          n1   = len1 / 2;
+          cut1 = first + n1;
+          cut2 = etl::lower_bound(middle, last, *cut1, compare);
+          n2   = cut2 - middle;
+        }
+        else
+        {
+          n2   = len2 / 2;
+          cut2 = middle + n2;
+          cut1 = etl::upper_bound(first, middle, *cut2, compare);
+          n1   = cut1 - first;
+        }
+
+        TIterator new_middle = etl::rotate(cut1, middle, cut2);
+
+        if ((n1 + n2) < ((len1 - n1) + (len2 - n2)))
+        {
+          merge_adaptive(first, cut1, new_middle, n1, n2, buffer, buffer_size, compare);
+          first  = new_middle;
+          middle = cut2;
+          len1  -= n1;
+          len2  -= n2;
+        }
+        else
+        {
+          merge_adaptive(new_middle, cut2, last, len1 - n1, len2 - n2, buffer, buffer_size, compare);
+          last   = new_middle;
+          middle = cut1;
+          len1   = n1;
+          len2   = n2;
+        }
+      }
     }
 
-    template <typename TIterator>
-    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type get_before_last(TIterator /*first_*/,
-                                                                                                                         TIterator last_)
+    //*************************************************************************
+    /// Top down merge sort of [first, last).
+    /// The recursion depth is log2(N / Merge_Sort_Run_Size).
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TDistance length, TBufferIterator buffer, TDistance buffer_size, TCompare compare)
     {
-      return last_ - 1;
+      if (length <= Merge_Sort_Run_Size)
+      {
+        private_pdq_sort::insertion_sort(first, last, compare, true);
+        return;
+      }
+
+      const TDistance half   = length / 2;
+      TIterator       middle = first + half;
+
+      merge_sort(first, middle, half, buffer, buffer_size, compare);
+      merge_sort(middle, last, length - half, buffer, buffer_size, compare);
+
+      // Merge unless already in order.
+      if (compare(*middle, *(middle - 1)))
+      {
+        merge_adaptive(first, middle, last, half, length - half, buffer, buffer_size, compare);
+      }
     }
   } // namespace private_algorithm
 
   //***************************************************************************
-  /// Sorts the elements using selection sort.
+  /// Sorts the elements using a merge sort with a caller supplied scratch
+  /// buffer. Does not allocate.
+  /// The buffer must hold constructed, assignable values, such as a resized
+  /// etl::vector_ext or an array. Its contents are left unspecified.
+  /// A buffer of at least half the length of the range gives O(N log N).
+  /// A smaller, or empty, buffer falls back to rotation merges where it
+  /// does not fit, up to O(N log^2 N).
+  /// Stable. Requires random access iterators.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR20 void selection_sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
   {
-    if (first == last)
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+    const difference_type length      = last - first;
+    const difference_type buffer_size = static_cast<difference_type>(buffer_last - buffer_first);
+
+    if (length > 1)
     {
-      return;
+      private_algorithm::merge_sort(first, last, length, buffer_first, buffer_size, compare);
     }
+  }
 
-    TIterator       min;
-    const TIterator ilast = private_algorithm::get_before_last(first, last);
-    const TIterator jlast = last;
+  //***************************************************************************
+  /// Sorts the elements using a merge sort with a caller supplied scratch
+  /// buffer.
+  /// Stable. Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::stable_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
 
-    for (TIterator i = first; i != ilast; ++i)
+  //***************************************************************************
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// Maps an arithmetic key to an unsigned value with the same ordering.
+    //*************************************************************************
+    template <typename T, bool Is_Floating_Point = etl::is_floating_point<T>::value>
+    struct radix_key
     {
-      min = i;
-
-      TIterator j = i;
-      ++j;
+      typedef typename etl::make_unsigned<T>::type type;
 
-      for (; j != jlast; ++j)
+      static type to_unsigned(T value)
       {
-        if (compare(*j, *min))
+        type result = static_cast<type>(value);
+
+        // Signed values have the sign bit flipped, so negatives come first.
+        if ETL_IF_CONSTEXPR (etl::is_signed<T>::value)
         {
-          min = j;
+          result ^= static_cast<type>(type(1U) << ((sizeof(type) * CHAR_BIT) - 1U));
         }
+
+        return result;
       }
+    };
 
-      using ETL_OR_STD::swap; // Allow ADL
-      if (min != i)
+    //*************************************************************************
+    /// IEEE 754 keys.
+    /// Negative values have all of the bits flipped, positive values have the
+    /// sign bit flipped.
+    //*************************************************************************
+    template <typename T>
+    struct radix_key<T, true>
+    {
+      ETL_STATIC_ASSERT((sizeof(T) == sizeof(uint32_t)) || (sizeof(T) == sizeof(uint64_t)), "Only 32 and 64 bit floating point keys are supported");
+
+      typedef typename etl::conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+
+      static type to_unsigned(T value)
       {
-        swap(*i, *min);
+        type result;
+        memcpy(&result, &value, sizeof(type));
+
+        const type sign_bit = static_cast<type>(type(1U) << ((sizeof(type) * CHAR_BIT) - 1U));
+
+        return ((result & sign_bit) != 0U) ? static_cast<type>(~result) : static_cast<type>(result | sign_bit);
       }
+    };
+
+    //*************************************************************************
+    template <typename T>
+    typename radix_key<T>::type to_unsigned(T value)
+    {
+      return radix_key<T>::to_unsigned(value);
     }
-  }
 
-  //***************************************************************************
-  /// Sorts the elements using selection sort.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR20 void selection_sort(TIterator first, TIterator last)
-  {
-    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
+    //*************************************************************************
+    /// The default key. The value itself.
+    //*************************************************************************
+    struct identity
+    {
+      template <typename T>
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
 
-  //***************************************************************************
-  /// Sorts the elements using heap sort.
-  /// Uses user defined comparison.
+    //*************************************************************************
+    /// One counting sort pass on the byte at 'shift', from the source range
+    /// to the destination.
+    /// Returns false, without moving anything, if every key has the same byte.
+    //*************************************************************************
+    template <typename TSource, typename TDestination, typename TKey>
+    bool radix_pass(TSource first, TSource last, TDestination destination, size_t length, TKey key, size_t shift)
+    {
+      size_t counts[256] = {0U};
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[static_cast<size_t>((private_radix_sort::to_unsigned(key(*itr)) >> shift) & 0xFFU)];
+      }
+
+      if (counts[static_cast<size_t>((private_radix_sort::to_unsigned(key(*first)) >> shift) & 0xFFU)] == length)
+      {
+        return false;
+      }
+
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        const size_t count = counts[i];
+        counts[i]          = total;
+        total             += count;
+      }
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        const size_t digit = static_cast<size_t>((private_radix_sort::to_unsigned(key(*itr)) >> shift) & 0xFFU);
+
+        destination[static_cast<ptrdiff_t>(counts[digit]++)] = ETL_MOVE(*itr);
+      }
+
+      return true;
+    }
+  } // namespace private_radix_sort
+
+  //***************************************************************************
+  /// Sorts the elements using a least significant digit radix sort, a byte
+  /// at a time, on the arithmetic key returned by 'key'.
+  /// Integral, signed and IEEE 754 float and double keys are supported.
+  /// Passes in which every key has the same byte are skipped.
+  /// [buffer_first, buffer_last) is scratch space of constructed, assignable
+  /// values, at least as long as the range, such as a resized
+  /// etl::vector_ext or an array. Its contents are left unspecified.
+  /// Does not allocate. Uses a 256 entry histogram on the stack.
+  /// Stable. O(N * sizeof(key)). Requires random access iterators.
+  /// -0.0 sorts before +0.0. NaNs sort by their bit patterns.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator, typename TBufferIterator, typename TKey>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TKey key)
   {
-    etl::make_heap(first, last, compare);
-    etl::sort_heap(first, last, compare);
+    const ptrdiff_t length = last - first;
+
+    if (length < 2)
+    {
+      return;
+    }
+
+    ETL_ASSERT_OR_RETURN((buffer_last - buffer_first) >= length, ETL_ERROR(algorithm_error));
+
+    const size_t    key_bits   = sizeof(private_radix_sort::to_unsigned(key(*first))) * CHAR_BIT;
+    TBufferIterator buffer_end = buffer_first + length;
+    bool            in_buffer  = false;
+
+    for (size_t shift = 0U; shift < key_bits; shift += 8U)
+    {
+      if (in_buffer)
+      {
+        in_buffer = !private_radix_sort::radix_pass(buffer_first, buffer_end, first, size_t(length), key, shift);
+      }
+      else
+      {
+        in_buffer = private_radix_sort::radix_pass(first, last, buffer_first, size_t(length), key, shift);
+      }
+    }
+
+    if (in_buffer)
+    {
+      etl::move(buffer_first, buffer_end, first);
+    }
   }
 
   //***************************************************************************
-  /// Sorts the elements using heap sort.
+  /// Sorts the arithmetic elements using a least significant digit radix sort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last)
+  template <typename TIterator, typename TBufferIterator>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
   {
-    etl::make_heap(first, last);
-    etl::sort_heap(first, last);
+    etl::radix_sort(first, last, buffer_first, buffer_last, private_radix_sort::identity());
   }
 
   //***************************************************************************
@@ -3544,43 +5445,10 @@ namespace etl
     return first;
   }
 
-  //*********************************************************
-  namespace private_algorithm
-  {
-    using ETL_OR_STD::swap;
-
-    template <typename TIterator, typename TCompare>
-#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
-    constexpr
-#endif
-      TIterator
-      nth_partition(TIterator first, TIterator last, TCompare compare)
-    {
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      value_type pivot_value = ETL_MOVE(*last);
-
-      TIterator i = first;
-
-      for (TIterator j = first; j < last; ++j)
-      {
-        if (!compare(pivot_value, *j)) // Hack to get '*j <= pivot_value' in
-                                       // terms of 'pivot_value < *j'
-        {
-          swap(*i, *j);
-          ++i;
-        }
-      }
-
-      swap(*i, *last);
-
-      return i;
-    }
-  } // namespace private_algorithm
-
   //*********************************************************
   /// nth_element
   /// see https://en.cppreference.com/w/cpp/algorithm/nth_element
+  /// Uses introselect, so is O(N) in the worst case.
   //*********************************************************
 #if ETL_USING_CPP11
   template <typename TIterator, typename TCompare = etl::less<typename etl::iterator_traits<TIterator>::value_type>>
@@ -3590,31 +5458,12 @@ namespace etl
     typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type
     nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare = TCompare())
   {
-    if (first == last)
+    if ((first == last) || (nth == last))
     {
       return;
     }
 
-    // 'last' must point to the actual last value.
-    --last;
-
-    while (first <= last)
-    {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
-
-      if (p == nth)
-      {
-        return;
-      }
-      else if (p > nth)
-      {
-        last = p - 1;
-      }
-      else
-      {
-        first = p + 1;
-      }
-    }
+    private_algorithm::introselect(first, nth, last, compare);
   }
 
 #else
@@ -3624,31 +5473,12 @@ namespace etl
   typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type nth_element(TIterator first, TIterator nth,
                                                                                                              TIterator last, TCompare compare)
   {
-    if (first == last)
+    if ((first == last) || (nth == last))
     {
       return;
     }
 
-    // 'last' must point to the actual last value.
-    --last;
-
-    while (first <= last)
-    {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
-
-      if (p == nth)
-      {
-        return;
-      }
-      else if (p > nth)
-      {
-        last = p - 1;
-      }
-      else
-      {
-        first = p + 1;
-      }
-    }
+    private_algorithm::introselect(first, nth, last, compare);
   }
 
   //*********************************************************
@@ -4325,6 +6155,24 @@ namespace etl
       constexpr ranges::mismatch_result<I1, I2> operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = {}, Proj1 proj1 = {},
                                                            Proj2 proj2 = {}) const
       {
+#if ETL_USING_SIMD_ALGORITHMS
+        // Pointers to the same integral type, compared with ==, are compared
+        // a vector of bytes at a time.
+        constexpr bool vectorisable = etl::is_same_v<I1, S1> && etl::is_same_v<I2, S2> && etl::is_same_v<Pred, ranges::equal_to> &&
+                                      etl::is_same_v<Proj1, etl::identity> && etl::is_same_v<Proj2, etl::identity> &&
+                                      private_algorithm_simd::is_equal_vectorisable<I1, I2>::value;
+
+        if constexpr (vectorisable)
+        {
+          if (!etl::is_constant_evaluated())
+          {
+            const size_t n = private_algorithm_simd::mismatch(first1, last1, first2, last2, etl::integral_constant<bool, vectorisable>());
+
+            return {first1 + n, first2 + n};
+          }
+        }
+#endif
+
         for (; first1 != last1 && first2 != last2; ++first1, ++first2)
         {
           if (!etl::invoke(pred, etl::invoke(proj1, *first1), etl::invoke(proj2, *first2)))
@@ -101,6 +101,15 @@ namespace etl
     memory_order_seq_cst = __ATOMIC_SEQ_CST
   } memory_order;
 
+  //***************************************************************************
+  /// Establishes memory synchronisation ordering of non-atomic and relaxed
+  /// atomic accesses.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    __atomic_thread_fence(order);
+  }
+
   template <bool Is_Always_Lock_Free>
   struct atomic_traits
   {
@@ -978,6 +987,16 @@ namespace etl
     memory_order_seq_cst
   } memory_order;
 
+  //***************************************************************************
+  /// Establishes memory synchronisation ordering of non-atomic and relaxed
+  /// atomic accesses.
+  /// The '__sync' builtins only support a full barrier.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order)
+  {
+    __sync_synchronize();
+  }
+
   template <bool Is_Always_Lock_Free>
   struct atomic_traits
   {
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "memory.h"
 #include "string_utilities.h"
 #include "type_traits.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1447,7 +1448,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      return find_impl(str.begin(), str.end(), str.size(), pos);
+      return find_impl(str.data(), str.size(), pos);
     }
 
     //*********************************************************************
@@ -1458,7 +1459,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type find(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return find_impl(view.begin(), view.end(), view.size(), pos);
+      return find_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1468,9 +1469,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + sz, sz, pos);
+      return find_impl(s, etl::strlen(s), pos);
     }
 
     //*********************************************************************
@@ -1481,9 +1480,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + n, sz, pos);
+      return find_impl(s, n, pos);
     }
 
     //*********************************************************************
@@ -1512,7 +1509,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const ibasic_string<T>& str, size_type position = npos) const
     {
-      return rfind_impl(str.rbegin(), str.rend(), str.size(), position);
+      return rfind_impl(str.data(), str.size(), position);
     }
 
     //*********************************************************************
@@ -1523,7 +1520,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type rfind(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return rfind_impl(view.rbegin(), view.rend(), view.size(), pos);
+      return rfind_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1533,12 +1530,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position = npos) const
     {
-      size_type len = etl::strlen(s);
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, len, position);
+      return rfind_impl(s, etl::strlen(s), position);
     }
 
     //*********************************************************************
@@ -1548,10 +1540,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position, size_type length_) const
     {
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, length_, position);
+      return rfind_impl(s, length_, position);
     }
 
     //*********************************************************************
@@ -2040,21 +2029,9 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
+      const size_type result = private_string_search::find_first_of(p_buffer, size(), position, s, n, true);
 
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     //*********************************************************************
@@ -2064,18 +2041,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find_first_of(&c, position, 1U);
     }
 
     //*********************************************************************
@@ -2117,30 +2083,9 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<difference_type>(size() - position - 1);
+      const size_type result = private_string_search::find_last_of(p_buffer, size(), position, s, n, true);
 
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     //*********************************************************************
@@ -2212,28 +2157,9 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
+      const size_type result = private_string_search::find_first_of(p_buffer, size(), position, s, n, false);
 
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     //*********************************************************************
@@ -2296,37 +2222,9 @@ namespace etl
     //*********************************************************************
     size_type find_last_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<difference_type>(size() - position - 1);
+      const size_type result = private_string_search::find_last_of(p_buffer, size(), position, s, n, false);
 
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     //*********************************************************************
@@ -2863,54 +2761,32 @@ namespace etl
     //*************************************************************************
     /// Common implementation for 'find'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type find_impl(TIterator first, TIterator last, size_type sz, size_type pos = 0) const
+    size_type find_impl(const_pointer s, size_type sz, size_type pos) const
     {
       if ((pos + sz) > size())
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), first, last);
+      const size_type position = private_string_search::search(data() + pos, size() - pos, s, sz);
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return static_cast<size_type>(etl::distance(begin(), iposition));
-      }
+      return (position == private_string_search::Npos) ? npos : pos + position;
     }
 
     //*************************************************************************
     /// Common implementation for 'rfind'.
+    /// Finds the last match that ends at or before pos.
     //*************************************************************************
-    template <typename TIterator>
-    size_type rfind_impl(TIterator rfirst, TIterator rlast, size_type sz, size_type pos = 0) const
+    size_type rfind_impl(const_pointer s, size_type sz, size_type pos) const
     {
       if (sz > size())
       {
         return npos;
       }
 
-      if (pos >= size())
-      {
-        pos = size();
-      }
-
-      pos = size() - pos;
-
-      const_reverse_iterator iposition = etl::search(rbegin() + static_cast<difference_type>(pos), rend(), rfirst, rlast);
+      const size_type position = private_string_search::reverse_search(data(), etl::min(pos, size()), s, sz);
 
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - sz - static_cast<size_type>(etl::distance(rbegin(), iposition));
-      }
+      return (position == private_string_search::Npos) ? npos : position;
     }
 
     //*********************************************************************
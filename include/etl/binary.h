@@ -47,6 +47,8 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 
+#include <limits.h>
+
 #if ETL_USING_CPP20 && ETL_USING_STL
   #include <bit>
 #endif
@@ -1178,7 +1180,8 @@ namespace etl
 
   //***************************************************************************
   /// Count trailing zeros. 32bit.
-  /// Uses a binary search.
+  /// Uses std::countr_zero, __builtin_ctz if int is at least 32 bits,
+  /// or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1188,6 +1191,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (UINT_MAX >= 0xFFFFFFFFUL)
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1239,7 +1244,7 @@ namespace etl
 #if ETL_USING_64BIT_TYPES
   //***************************************************************************
   /// Count trailing zeros. 64bit.
-  /// Uses a binary search.
+  /// Uses std::countr_zero, __builtin_ctzll, or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1249,6 +1254,8 @@ namespace etl
   {
   #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+  #elif defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_ctzll(value));
   #else
     uint_least8_t count = 0U;
 
@@ -1422,7 +1429,8 @@ namespace etl
 
   //***************************************************************************
   /// Count trailing zeros. 32bit.
-  /// Uses a binary search.
+  /// Uses std::countr_one, __builtin_ctz if int is at least 32 bits,
+  /// or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1432,6 +1440,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (UINT_MAX >= 0xFFFFFFFFUL)
+    return (value == 0xFFFFFFFFUL) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_ctz(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1483,7 +1493,7 @@ namespace etl
 #if ETL_USING_64BIT_TYPES
   //***************************************************************************
   /// Count trailing zeros. 64bit.
-  /// Uses a binary search.
+  /// Uses std::countr_one, __builtin_ctzll, or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1493,6 +1503,8 @@ namespace etl
   {
   #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+  #elif defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    return (value == 0xFFFFFFFFFFFFFFFFULL) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_ctzll(~value));
   #else
     uint_least8_t count = 0U;
 
@@ -1660,7 +1672,8 @@ namespace etl
 
   //***************************************************************************
   /// Count leading zeros.
-  /// Uses a binary search.
+  /// Uses std::countl_zero, __builtin_clz if int is at least 32 bits,
+  /// or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1670,6 +1683,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (UINT_MAX >= 0xFFFFFFFFUL)
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_clz(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1721,7 +1736,7 @@ namespace etl
 #if ETL_USING_64BIT_TYPES
   //***************************************************************************
   /// Count leading zeros.
-  /// Uses a binary search.
+  /// Uses std::countl_zero, __builtin_clzll, or a binary search.
   ///\ingroup binary
   //***************************************************************************
   template <typename T>
@@ -1731,6 +1746,8 @@ namespace etl
   {
   #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+  #elif defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_clzll(value));
   #else
     uint_least8_t count = 0U;
 
@@ -32,19 +32,57 @@ SOFTWARE.
 #define ETL_BLOOM_FILTER_INCLUDED
 
 #include "platform.h"
+#include "alignment.h"
 #include "binary.h"
 #include "bitset.h"
+#include "error_handler.h"
+#include "exception.h"
 #include "log.h"
 #include "parameter_type.h"
 #include "power.h"
+#include "span.h"
+#include "static_assert.h"
 #include "type_traits.h"
 
+#include "private/bloom_filter_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
 ///\ingroup containers
 
 namespace etl
 {
+  //***************************************************************************
+  /// Exception for the blocked_bloom_filter.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  class bloom_filter_exception : public etl::exception
+  {
+  public:
+
+    bloom_filter_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the blocked_bloom_filter.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  class bloom_filter_out_of_range : public etl::bloom_filter_exception
+  {
+  public:
+
+    bloom_filter_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::bloom_filter_exception(ETL_ERROR_TEXT("bloom_filter:range", ETL_BLOOM_FILTER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   namespace private_bloom_filter
   {
     // Placeholder null hash for defaulted template parameters.
@@ -56,6 +94,23 @@ namespace etl
         return 0;
       }
     };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Mixes the bits of a hash, so that every bit of the result depends on
+    /// every bit of the hash. The MurmurHash3 64 bit finaliser.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t hash)
+    {
+      hash ^= (hash >> 33U);
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= (hash >> 33U);
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= (hash >> 33U);
+
+      return hash;
+    }
+#endif
   } // namespace private_bloom_filter
 
   //***************************************************************************
@@ -183,6 +238,396 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// Each key sets k bits in one 64 byte block, so adding or testing a key
+  /// touches one cache line, rather than one line for each bit.
+  /// k is given to the constructor, up to Max_Hash_Count, so that it can be
+  /// chosen at run time for the expected number of keys.
+  /// The block and the bits all come from one 64 bit hash of the key. The
+  /// block is chosen by the high 32 bits, and the bits by double hashing.
+  /// The hash is mixed first, so a weak hash, such as the identity, is fine.
+  /// The false positive rate is a little above that of a standard Bloom filter
+  /// of the same width, as the keys are not spread evenly over the blocks.
+  ///\tparam Desired_Width  The desired number of bits. Rounded up to whole blocks.
+  ///\tparam THash          The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam Max_Hash_Count The most bits that may be set for each key. The default k.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count = 8U>
+  class blocked_bloom_filter
+  {
+  public:
+
+    typedef typename THash::argument_type key_type;
+
+  private:
+
+    typedef typename etl::parameter_type<key_type>::type parameter_t;
+
+    ETL_STATIC_ASSERT(Desired_Width != 0U, "Width must not be zero");
+    ETL_STATIC_ASSERT(Max_Hash_Count != 0U, "Hash count must not be zero");
+
+    static ETL_CONSTANT size_t Bits_Per_Block  = 512U;
+    static ETL_CONSTANT size_t Words_Per_Block = 8U;
+    static ETL_CONSTANT size_t Block_Count     = (Desired_Width + Bits_Per_Block - 1U) / Bits_Per_Block;
+
+  public:
+
+    enum
+    {
+      WIDTH          = Block_Count * Bits_Per_Block,
+      MAX_HASH_COUNT = Max_Hash_Count
+    };
+
+    //***************************************************************************
+    /// Constructor. Sets Max_Hash_Count bits for each key.
+    //***************************************************************************
+    blocked_bloom_filter()
+      : n_hashes(Max_Hash_Count)
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Constructor.
+    /// Emits a bloom_filter_out_of_range error if the hash count is zero or more
+    /// than Max_Hash_Count, and uses the nearest valid count.
+    ///\param hash_count_ The number of bits set for each key.
+    //***************************************************************************
+    explicit blocked_bloom_filter(size_t hash_count_)
+      : n_hashes((hash_count_ == 0U) ? 1U : ((hash_count_ > Max_Hash_Count) ? Max_Hash_Count : hash_count_))
+    {
+      ETL_ASSERT((hash_count_ != 0U) && (hash_count_ <= Max_Hash_Count), ETL_ERROR(bloom_filter_out_of_range));
+
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      uint64_t* p = words();
+
+      for (size_t i = 0U; i < (Block_Count * Words_Per_Block); ++i)
+      {
+        p[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      add_hash(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return exists_hash(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Adds a batch of keys to the filter.
+    /// The keys are hashed and their blocks prefetched a batch at a time, so
+    /// that the cache misses overlap.
+    ///\param keys The keys to add.
+    //***************************************************************************
+    void add_batch(etl::span<const key_type> keys)
+    {
+      uint64_t hashes[Batch_Size];
+
+      for (size_t first = 0U; first < keys.size(); first += Batch_Size)
+      {
+        const size_t count = start_batch(keys, first, hashes);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          add_hash(hashes[i]);
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Tests each of a batch of keys to see if it exists in the filter.
+    /// See add_batch. With AVX2, whole batches are tested with SIMD.
+    /// Emits a bloom_filter_out_of_range error if there are fewer results
+    /// than keys.
+    ///\param keys    The keys to test.
+    ///\param results <b>true</b> if the key exists in the filter, for each key.
+    //***************************************************************************
+    void exists_batch(etl::span<const key_type> keys, etl::span<bool> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(bloom_filter_out_of_range));
+
+      uint64_t hashes[Batch_Size];
+
+      for (size_t first = 0U; first < keys.size(); first += Batch_Size)
+      {
+        const size_t count = start_batch(keys, first, hashes);
+
+#if ETL_USING_SIMD_BLOOM_FILTER
+        // The gather indexes 32 bit words with a signed 32 bit index.
+        if ((count == Batch_Size) && (Block_Count <= Max_Gather_Blocks))
+        {
+          exists_batch_simd(hashes, &results[first]);
+          continue;
+        }
+#endif
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          results[first + i] = exists_hash(hashes[i]);
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of bits set for each key.
+    //***************************************************************************
+    size_t hash_count() const
+    {
+      return n_hashes;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      const uint64_t* p     = words();
+      size_t          total = 0U;
+
+      for (size_t i = 0U; i < (Block_Count * Words_Per_Block); ++i)
+      {
+        total += etl::count_bits(p[i]);
+      }
+
+      return total;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the mixed hash for the key.
+    //***************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix(static_cast<uint64_t>(THash()(key)));
+    }
+
+    //***************************************************************************
+    /// Gets the index of the first word of the block for a hash.
+    /// Multiplying by the block count maps the high 32 bits onto the blocks
+    /// without a division, for any number of blocks.
+    //***************************************************************************
+    static size_t get_block_index(uint64_t hash)
+    {
+      return static_cast<size_t>(((hash >> 32U) * Block_Count) >> 32U) * Words_Per_Block;
+    }
+
+    //***************************************************************************
+    /// Gets the first bit step for a hash, the low 32 bits.
+    /// Each bit is the top 9 bits of the step, within the block.
+    //***************************************************************************
+    static uint32_t get_step(uint64_t hash)
+    {
+      return static_cast<uint32_t>(hash);
+    }
+
+    //***************************************************************************
+    /// Gets the second bit step for a hash, from the high 32 bits, multiplied
+    /// so that it does not depend on the block alone.
+    /// The first step is advanced by the second, and the second also changes
+    /// at every step, in its top bits. With a fixed second step the bits for
+    /// large hash counts are correlated, and the false positive rate rises
+    /// well above that expected for the block size.
+    //***************************************************************************
+    static uint32_t get_step2(uint64_t hash)
+    {
+      return static_cast<uint32_t>(static_cast<uint32_t>(hash >> 32U) * 0x9E3779B9UL);
+    }
+
+    //***************************************************************************
+    /// Advances the bit steps after bit i.
+    //***************************************************************************
+    static void next_step(uint32_t& h, uint32_t& h2, size_t i)
+    {
+      h  = static_cast<uint32_t>(h + h2);
+      h2 = static_cast<uint32_t>(h2 + (static_cast<uint32_t>(i) << 23U) + 0x9E3779B9UL);
+    }
+
+    //***************************************************************************
+    /// Adds a hash to the filter.
+    //***************************************************************************
+    void add_hash(uint64_t hash)
+    {
+      uint64_t* block = words() + get_block_index(hash);
+      uint32_t  h     = get_step(hash);
+      uint32_t  h2    = get_step2(hash);
+
+      for (size_t i = 0U; i < n_hashes; ++i)
+      {
+        const uint32_t bit = h >> 23U;
+
+        block[bit >> 6U] |= (uint64_t(1U) << (bit & 63U));
+        next_step(h, h2, i);
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a hash to see if it exists in the filter.
+    /// Testing the bits one at a time, and stopping at the first one missing,
+    /// is faster for a single key than building a mask of the bits to test
+    /// with SIMD.
+    //***************************************************************************
+    bool exists_hash(uint64_t hash) const
+    {
+      const uint64_t* block = words() + get_block_index(hash);
+      uint32_t        h     = get_step(hash);
+      uint32_t        h2    = get_step2(hash);
+
+      for (size_t i = 0U; i < n_hashes; ++i)
+      {
+        const uint32_t bit = h >> 23U;
+
+        if ((block[bit >> 6U] & (uint64_t(1U) << (bit & 63U))) == 0U)
+        {
+          return false;
+        }
+
+        next_step(h, h2, i);
+      }
+
+      return true;
+    }
+
+#if ETL_USING_SIMD_BLOOM_FILTER
+    //***************************************************************************
+    /// Tests a whole batch of hashes, eight at a time.
+    //***************************************************************************
+    void exists_batch_simd(const uint64_t* hashes, bool* results) const
+    {
+      uint32_t h[Batch_Size];
+      uint32_t h2[Batch_Size];
+      uint32_t offsets[Batch_Size];
+
+      for (size_t i = 0U; i < Batch_Size; ++i)
+      {
+        h[i]       = get_step(hashes[i]);
+        h2[i]      = get_step2(hashes[i]);
+        offsets[i] = static_cast<uint32_t>(get_block_index(hashes[i]) * 2U);
+      }
+
+      const uint32_t* p = reinterpret_cast<const uint32_t*>(words());
+
+      for (size_t first = 0U; first < Batch_Size; first += 8U)
+      {
+        const uint32_t found = private_bloom_filter::exists_8(p, h + first, h2 + first, offsets + first, n_hashes);
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          results[first + i] = ((found >> i) & 1U) != 0U;
+        }
+      }
+    }
+#endif
+
+    //***************************************************************************
+    /// Hashes the keys of the batch starting at 'first' and prefetches their
+    /// blocks.
+    ///\return The number of keys in the batch.
+    //***************************************************************************
+    size_t start_batch(etl::span<const key_type> keys, size_t first, uint64_t* hashes) const
+    {
+      const size_t remaining = keys.size() - first;
+      const size_t count     = (remaining < Batch_Size) ? remaining : Batch_Size;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        hashes[i] = get_hash(keys[first + i]);
+        ETL_PREFETCH(words() + get_block_index(hashes[i]));
+      }
+
+      return count;
+    }
+
+    //***************************************************************************
+    uint64_t* words()
+    {
+      return storage.template get_address<uint64_t>();
+    }
+
+    //***************************************************************************
+    const uint64_t* words() const
+    {
+      return storage.template get_address<uint64_t>();
+    }
+
+    /// How many keys are hashed and prefetched ahead of a batch.
+    static ETL_CONSTANT size_t Batch_Size = 16U;
+
+    /// The most blocks that the SIMD batch test can index.
+    static ETL_CONSTANT size_t Max_Gather_Blocks = 0x7FFFFFFFUL / (Words_Per_Block * 2U);
+
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    /// Each block fills one 64 byte cache line.
+    static ETL_CONSTANT size_t Alignment = 64U;
+#else
+    static ETL_CONSTANT size_t Alignment = etl::alignment_of<uint64_t>::value;
+#endif
+
+    /// The Bloom filter blocks.
+    typename etl::aligned_storage<sizeof(uint64_t) * Block_Count * Words_Per_Block, Alignment>::type storage;
+
+    /// The number of bits set for each key.
+    size_t n_hashes;
+  };
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Bits_Per_Block;
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Words_Per_Block;
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Block_Count;
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Batch_Size;
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Max_Gather_Blocks;
+
+  template <size_t Desired_Width, typename THash, size_t Max_Hash_Count>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Max_Hash_Count>::Alignment;
+#endif
 } // namespace etl
 
 #endif
@@ -0,0 +1,550 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "nth_type.h"
+#include "pool.h"
+#include "utility.h"
+
+#include "private/btree_base.h"
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map, implemented as a B+ tree, with the capacity defined at compile time.
+/// The elements are held in arrays in the leaf nodes, so lookups and in order
+/// traversal touch far fewer cache lines than a node based map.
+/// Inserting or erasing elements invalidates all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for a B+ tree map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map
+    : public etl::ibtree<TKey, ETL_OR_STD::pair<const TKey, TMapped>, private_btree::key_of_pair<TKey, ETL_OR_STD::pair<const TKey, TMapped> >, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree<TKey, ETL_OR_STD::pair<const TKey, TMapped>, private_btree::key_of_pair<TKey, ETL_OR_STD::pair<const TKey, TMapped> >, TKeyCompare> base_t;
+
+  public:
+
+    typedef typename base_t::key_type        key_type;
+    typedef typename base_t::value_type      value_type;
+    typedef TMapped                          mapped_type;
+    typedef typename base_t::key_compare     key_compare;
+    typedef typename base_t::reference       reference;
+    typedef typename base_t::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base_t::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base_t::pointer        pointer;
+    typedef typename base_t::const_pointer  const_pointer;
+    typedef typename base_t::size_type      size_type;
+    typedef typename base_t::iterator       iterator;
+    typedef typename base_t::const_iterator const_iterator;
+
+    /// Defines the parameter types
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(value_type(etl::move(key), mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(value_type(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds
+    /// if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds
+    /// if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator=(const ibtree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator=(ibtree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+
+        iterator from = rhs.begin();
+
+        while (from != rhs.end())
+        {
+          this->insert(etl::move(*from));
+          ++from;
+        }
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree_map() {}
+#else
+
+  protected:
+
+    ~ibtree_map() {}
+#endif
+  };
+
+  //*************************************************************************
+  /// A B+ tree map that uses fixed size pools.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        ++from;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator=(const btree_map& rhs)
+    {
+      base_t::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator=(btree_map&& rhs)
+    {
+      base_t::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename base_t::template pool_size<MAX_SIZE_> pool_size_t;
+
+    /// The pools of nodes used for the map.
+    etl::pool<typename base_t::leaf_type, pool_size_t::Leaves>       leaf_pool;
+    etl::pool<typename base_t::inner_type, pool_size_t::Inner_Nodes> inner_pool;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// A B+ tree map that uses external pools.
+  /// The pools must be able to hold the number of nodes given by
+  /// ibtree_map::pool_size for the maximum size.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class btree_map_ext : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_map_ext(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor, with its own pools.
+    //*************************************************************************
+    btree_map_ext(const btree_map_ext& other, etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map_ext(TIterator first, TIterator last, etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map_ext()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map_ext& operator=(const btree_map_ext& rhs)
+    {
+      base_t::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction without pools.
+    btree_map_ext(const btree_map_ext&) ETL_DELETE;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  btree_map(TPairs...)
+    -> btree_map<typename etl::nth_type_t<0, TPairs...>::first_type, typename etl::nth_type_t<0, TPairs...>::second_type, sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_btree_map(TPairs&&... pairs) -> etl::btree_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator!=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the first map is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator<(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.value_comp());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the first map is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator>(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the first map is lexicographically less than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator<=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the first map is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator>=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+} // namespace etl
+
+#endif
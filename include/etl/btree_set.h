@@ -0,0 +1,433 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "nth_type.h"
+#include "pool.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/btree_base.h"
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set, implemented as a B+ tree, with the capacity defined at compile time.
+/// The elements are held in arrays in the leaf nodes, so lookups and in order
+/// traversal touch far fewer cache lines than a node based set.
+/// Inserting or erasing elements invalidates all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for a B+ tree set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_set : public etl::ibtree<TKey, TKey, private_btree::key_of_value<TKey>, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree<TKey, TKey, private_btree::key_of_value<TKey>, TKeyCompare> base_t;
+
+  public:
+
+    typedef typename base_t::key_type        key_type;
+    typedef typename base_t::value_type      value_type;
+    typedef typename base_t::key_compare     key_compare;
+    typedef TKeyCompare                      value_compare;
+    typedef typename base_t::reference       reference;
+    typedef typename base_t::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base_t::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base_t::pointer        pointer;
+    typedef typename base_t::const_pointer  const_pointer;
+    typedef typename base_t::size_type      size_type;
+    typedef typename base_t::iterator       iterator;
+    typedef typename base_t::const_iterator const_iterator;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->kcompare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator=(const ibtree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator=(ibtree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+
+        iterator from = rhs.begin();
+
+        while (from != rhs.end())
+        {
+          this->insert(etl::move(*from));
+          ++from;
+        }
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree_set() {}
+#else
+
+  protected:
+
+    ~ibtree_set() {}
+#endif
+  };
+
+  //*************************************************************************
+  /// A B+ tree set that uses fixed size pools.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class btree_set : public etl::ibtree_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, TCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        ++from;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator=(const btree_set& rhs)
+    {
+      base_t::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator=(btree_set&& rhs)
+    {
+      base_t::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename base_t::template pool_size<MAX_SIZE_> pool_size_t;
+
+    /// The pools of nodes used for the set.
+    etl::pool<typename base_t::leaf_type, pool_size_t::Leaves>       leaf_pool;
+    etl::pool<typename base_t::inner_type, pool_size_t::Inner_Nodes> inner_pool;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// A B+ tree set that uses external pools.
+  /// The pools must be able to hold the number of nodes given by
+  /// ibtree_set::pool_size for the maximum size.
+  //*************************************************************************
+  template <typename TKey, typename TCompare = etl::less<TKey> >
+  class btree_set_ext : public etl::ibtree_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, TCompare> base_t;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_set_ext(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor, with its own pools.
+    //*************************************************************************
+    btree_set_ext(const btree_set_ext& other, etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set_ext(TIterator first, TIterator last, etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+      this->assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set_ext()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set_ext& operator=(const btree_set_ext& rhs)
+    {
+      base_t::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction without pools.
+    btree_set_ext(const btree_set_ext&) ETL_DELETE;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  btree_set(T...) -> btree_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_btree_set(T&&... keys) -> etl::btree_set<TKey, sizeof...(T), TKeyCompare>
+  {
+    return {etl::forward<T>(keys)...};
+  }
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator==(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator!=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the first set is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator<(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.value_comp());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the first set is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator>(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the first set is lexicographically less than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator<=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the first set is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator>=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+} // namespace etl
+
+#endif
@@ -31,6 +31,8 @@ SOFTWARE.
 #include "binary.h"
 #include "frame_check_sequence.h"
 
+#include "private/checksum_simd.h"
+
 #include <stdint.h>
 
 ///\defgroup checksum Checksum calculation
@@ -56,6 +58,13 @@ namespace etl
       return sum + value;
     }
 
+#if ETL_USING_SIMD_CHECKSUM
+    T add_range(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return static_cast<T>(sum + static_cast<T>(etl::private_checksum_simd::sum_bytes(begin, end)));
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
@@ -104,6 +113,13 @@ namespace etl
       return sum ^ value;
     }
 
+#if ETL_USING_SIMD_CHECKSUM
+    T add_range(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return sum ^ etl::private_checksum_simd::xor_bytes(begin, end);
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
@@ -152,6 +168,14 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+#if ETL_USING_SIMD_CHECKSUM
+    // The parity of every byte is the parity of their XOR.
+    T add_range(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return sum ^ etl::parity(etl::private_checksum_simd::xor_bytes(begin, end));
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
@@ -0,0 +1,1012 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+#define ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "function.h"
+#include "functional.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "memory_model.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup concurrent_unordered_map concurrent_unordered_map
+/// A fixed capacity hash map that may be shared between threads without a lock.
+/// Uses linear probing over slots, each guarded by an atomic state word.
+/// Keys and values are copied in and out, and must be trivially copyable.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized concurrent_unordered_map.
+  /// Can be used as a reference type for all concurrent_unordered_map
+  /// containing a specific type.
+  ///
+  /// Lookups are lock free and writers may block.
+  ///
+  /// find, contains and size never take a lock, never write shared state
+  /// and never wait for another thread. Each slot holds two copies of the
+  /// value, so a lookup reads the last settled value while an assignment
+  /// writes the other. A lookup only reads a slot again if another thread
+  /// completed a change to it during the copy, so lookups are lock free, but
+  /// not wait free.
+  /// insert, insert_or_assign, assign and erase do not take a lock, but they
+  /// are not lock free. A writer that meets a slot in its probe run that
+  /// another writer is part way through inserting, updating or reclaiming,
+  /// waits for that writer to finish. A writer that is suspended there delays
+  /// the other writers of the same probe run. It never delays a lookup.
+  /// A waiting writer calls the wait function on every retry, if one is set.
+  /// On an RTOS this should yield or delay, so that a suspended lower
+  /// priority writer can run and finish.
+  /// clear is not thread safe.
+  ///
+  /// An erased slot becomes a tombstone. Tombstones at the end of a probe run
+  /// are reclaimed by erase, so that the run shrinks back.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>,
+            const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iconcurrent_unordered_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_trivially_copyable<TKey>::value), "The key type must be trivially copyable");
+    ETL_STATIC_ASSERT((etl::is_trivially_copyable<T>::value), "The mapped type must be trivially copyable");
+
+    typedef TKey      key_type;
+    typedef T         mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+
+    /// The type used for determining the size of the map.
+    typedef typename etl::size_type_lookup<Memory_Model>::type size_type;
+
+    typedef const key_type&    const_key_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    //*************************************************************************
+    /// The state word of a slot.
+    /// The low bits hold the state and the index of the current value buffer.
+    /// The remainder is a version number that is incremented on every change,
+    /// so that readers can detect a change.
+    //*************************************************************************
+    struct state
+    {
+      enum
+      {
+        Empty      = 0U, ///< Has never been used, or has been reclaimed. Terminates a probe.
+        Inserting  = 1U, ///< Claimed by an insert. The key is not yet valid.
+        Pending    = 2U, ///< Holds the key of an insert that is checking for a duplicate. Not yet visible.
+        Full       = 3U, ///< Holds a key and a value.
+        Updating   = 4U, ///< Holds a key. The value is being written.
+        Deleted    = 5U, ///< A tombstone. Probes continue past it. May be reused by insert.
+        Reclaiming = 6U  ///< A tombstone that is being tested for reclamation.
+      };
+
+      static ETL_CONSTANT uint32_t Mask   = 0x07U;
+      static ETL_CONSTANT uint32_t Buffer = 0x08U;
+      static ETL_CONSTANT uint32_t Shift  = 4U;
+
+      static uint32_t get(uint32_t value)
+      {
+        return value & Mask;
+      }
+
+      /// The index of the value buffer holding the current value.
+      static size_t buffer(uint32_t value)
+      {
+        return ((value & Buffer) != 0U) ? 1U : 0U;
+      }
+
+      /// The next version of the word, with a new state and the same buffer.
+      static uint32_t next(uint32_t value, uint32_t new_state)
+      {
+        return static_cast<uint32_t>((((value >> Shift) + 1U) << Shift) | (value & Buffer) | new_state);
+      }
+
+      /// The number of changes from one word to a later one.
+      static uint32_t changes(uint32_t from, uint32_t to)
+      {
+        return static_cast<uint32_t>((to >> Shift) - (from >> Shift)) & (0xFFFFFFFFUL >> Shift);
+      }
+    };
+
+  public:
+
+    //*************************************************************************
+    /// A slot holding one element.
+    /// An assignment writes the value buffer that is not current, and then
+    /// makes it current.
+    /// concurrent_unordered_map_ext takes an array of these.
+    //*************************************************************************
+    struct slot_type
+    {
+      etl::atomic<uint32_t> control;
+
+      typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type key;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type       value[2];
+    };
+
+    //*************************************************************************
+    /// Inserts the key and value, if the key is not already in the map.
+    ///\return <b>true</b> if inserted, <b>false</b> if the key already exists
+    /// or the map is full.
+    //*************************************************************************
+    bool insert(const_key_reference key, const_mapped_reference value)
+    {
+      return do_insert(key, value, false);
+    }
+
+    //*************************************************************************
+    /// Inserts the key and value, or assigns the value if the key already exists.
+    ///\return <b>true</b> if inserted or assigned, <b>false</b> if the map is full.
+    //*************************************************************************
+    bool insert_or_assign(const_key_reference key, const_mapped_reference value)
+    {
+      return do_insert(key, value, true);
+    }
+
+    //*************************************************************************
+    /// Assigns the value, if the key already exists.
+    ///\return <b>true</b> if assigned, <b>false</b> if the key does not exist.
+    //*************************************************************************
+    bool assign(const_key_reference key, const_mapped_reference value)
+    {
+      size_t   index;
+      uint32_t current;
+
+      while (locate(key, index, current, true))
+      {
+        if (try_assign(index, current, value))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Erases the key.
+    ///\return <b>true</b> if erased, <b>false</b> if the key does not exist.
+    //*************************************************************************
+    bool erase(const_key_reference key)
+    {
+      size_t   index;
+      uint32_t current;
+
+      while (locate(key, index, current, true))
+      {
+        if (pslots[index].control.compare_exchange_strong(current, state::next(current, state::Deleted)))
+        {
+          current_size.fetch_sub(1U);
+          reclaim(index);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Finds the key and copies the value.
+    ///\param key   The key to search for.
+    ///\param value Set to the value, if found.
+    ///\return <b>true</b> if found, otherwise <b>false</b>.
+    //*************************************************************************
+    bool find(const_key_reference key, mapped_type& value) const
+    {
+      size_t index = home_of(key);
+
+      for (size_t probe = 0U; probe < number_of_slots;)
+      {
+        const slot_type& slot    = pslots[index];
+        const uint32_t   current = slot.control.load(etl::memory_order_acquire);
+
+        switch (state::get(current))
+        {
+          case state::Empty:
+          {
+            return false;
+          }
+
+          case state::Full:
+          case state::Updating:
+          {
+            // The current value buffer is not written by an update in progress.
+            key_storage_t key_copy;
+            memcpy(&key_copy, &slot.key, sizeof(TKey));
+
+            value_storage_t value_copy;
+            memcpy(&value_copy, &slot.value[state::buffer(current)], sizeof(T));
+
+            if (!is_copy_valid(slot, current))
+            {
+              // Another thread completed a change to the slot. Read it again.
+              continue;
+            }
+
+            if (key_equal_function(key, *reinterpret_cast<const TKey*>(&key_copy)))
+            {
+              memcpy(&value, &value_copy, sizeof(T));
+              return true;
+            }
+
+            break;
+          }
+
+          default:
+          {
+            // Inserting, Pending, Deleted or Reclaiming.
+            break;
+          }
+        }
+
+        index = next_index(index);
+        ++probe;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      size_t   index;
+      uint32_t current;
+
+      return locate(key, index, current, false);
+    }
+
+    //*************************************************************************
+    /// Counts the key.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    /// Not thread safe.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        pslots[i].control.store(state::Empty, etl::memory_order_relaxed);
+      }
+
+      current_size.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// How many items in the map?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Is the map empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the map full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() >= maximum_size;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the map.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      const size_type n = size();
+
+      return (n >= maximum_size) ? 0U : static_cast<size_type>(maximum_size - n);
+    }
+
+    //*************************************************************************
+    /// How many items can the map hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// How many items can the map hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// The number of slots.
+    //*************************************************************************
+    size_t bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*************************************************************************
+    /// Sets the function that a writer calls each time it retries while
+    /// waiting for another writer. It is passed the number of times the
+    /// writer has already waited, so that it may back off.
+    /// Set it before the map is shared between threads.
+    //*************************************************************************
+    void set_wait_function(const etl::ifunction<size_t>& wait_function)
+    {
+      p_wait_function = &wait_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iconcurrent_unordered_map(slot_type* pslots_, size_t number_of_slots_, size_type maximum_size_, const hasher& hash_, const key_equal& equal_)
+      : pslots(pslots_)
+      , number_of_slots(number_of_slots_)
+      , maximum_size(maximum_size_)
+      , key_hash_function(hash_)
+      , key_equal_function(equal_)
+      , p_wait_function(ETL_NULLPTR)
+    {
+      clear();
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type key_storage_t;
+    typedef typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type       value_storage_t;
+
+    //*************************************************************************
+    size_t home_of(const_key_reference key) const
+    {
+      return static_cast<size_t>(key_hash_function(key)) % number_of_slots;
+    }
+
+    //*************************************************************************
+    size_t next_index(size_t index) const
+    {
+      ++index;
+      return (index == number_of_slots) ? 0U : index;
+    }
+
+    //*************************************************************************
+    size_t previous_index(size_t index) const
+    {
+      return (index == 0U) ? number_of_slots - 1U : index - 1U;
+    }
+
+    //*************************************************************************
+    /// Called each time a writer retries while waiting for another writer.
+    //*************************************************************************
+    void wait(size_t& waits) const
+    {
+      if (p_wait_function != ETL_NULLPTR)
+      {
+        (*p_wait_function)(waits);
+      }
+
+      ++waits;
+    }
+
+    //*************************************************************************
+    /// Checks that a slot has not changed since 'current' was read.
+    /// The fence stops the preceding copies from being reordered after the check.
+    //*************************************************************************
+    static bool is_unchanged(const slot_type& slot, uint32_t current)
+    {
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      return slot.control.load(etl::memory_order_relaxed) == current;
+    }
+
+    //*************************************************************************
+    /// Checks that the copies of a slot's key and current value, made after
+    /// 'current' was read, are valid.
+    /// A key is only overwritten after the slot has been erased and claimed
+    /// again, and the current value buffer only after two assignments. Either
+    /// takes at least two changes, so the copies are valid after one.
+    /// The fence stops the preceding copies from being reordered after the check.
+    //*************************************************************************
+    static bool is_copy_valid(const slot_type& slot, uint32_t current)
+    {
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      return state::changes(current, slot.control.load(etl::memory_order_relaxed)) <= 1U;
+    }
+
+    //*************************************************************************
+    /// Finds the slot holding the key.
+    ///\param index   Set to the index of the slot.
+    ///\param current Set to the state word of the slot.
+    ///\param settled If <b>true</b>, waits for an update of the slot to finish,
+    ///                so that the state is Full. Otherwise it may be Updating.
+    ///\return <b>true</b> if found, otherwise <b>false</b>.
+    //*************************************************************************
+    bool locate(const_key_reference key, size_t& index, uint32_t& current, bool settled) const
+    {
+      index = home_of(key);
+
+      size_t waits = 0U;
+
+      for (size_t probe = 0U; probe < number_of_slots;)
+      {
+        const slot_type& slot = pslots[index];
+        current               = slot.control.load(etl::memory_order_acquire);
+
+        switch (state::get(current))
+        {
+          case state::Empty:
+          {
+            return false;
+          }
+
+          case state::Full:
+          case state::Updating:
+          {
+            if (settled && (state::get(current) == state::Updating))
+            {
+              // Wait for the other writer to finish.
+              wait(waits);
+              continue;
+            }
+
+            // The key of an Updating slot is settled.
+            key_storage_t key_copy;
+            memcpy(&key_copy, &slot.key, sizeof(TKey));
+
+            const bool is_valid = settled ? is_unchanged(slot, current) : is_copy_valid(slot, current);
+
+            if (!is_valid)
+            {
+              // Read the slot again.
+              continue;
+            }
+
+            if (key_equal_function(key, *reinterpret_cast<const TKey*>(&key_copy)))
+            {
+              return true;
+            }
+
+            break;
+          }
+
+          default:
+          {
+            // Inserting, Pending, Deleted or Reclaiming.
+            break;
+          }
+        }
+
+        index = next_index(index);
+        ++probe;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Writes a new value to a Full slot.
+    ///\return <b>false</b> if the slot changed before it could be claimed.
+    //*************************************************************************
+    bool try_assign(size_t index, uint32_t current, const_mapped_reference value)
+    {
+      slot_type& slot = pslots[index];
+
+      const uint32_t updating = state::next(current, state::Updating);
+
+      if (!slot.control.compare_exchange_strong(current, updating))
+      {
+        return false;
+      }
+
+      // Write the buffer that is not current, then make it current.
+      memcpy(&slot.value[state::buffer(updating) ^ 1U], &value, sizeof(T));
+      slot.control.store(state::next(updating, state::Full) ^ state::Buffer, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Inserts, and optionally assigns.
+    /// The new element goes in the first tombstone or empty slot of the probe
+    /// run. It is written as Pending, and then the run is checked again for
+    /// a concurrent insert of the same key before the element is made visible.
+    //*************************************************************************
+    bool do_insert(const_key_reference key, const_mapped_reference value, bool assign_existing)
+    {
+      // Reserve space for the new element.
+      if (current_size.fetch_add(1U) >= maximum_size)
+      {
+        current_size.fetch_sub(1U);
+
+        // The key may still be assignable.
+        return assign_existing ? assign(key, value) : false;
+      }
+
+      const size_t home = home_of(key);
+
+      for (;;)
+      {
+        size_t   candidate       = number_of_slots;
+        uint32_t candidate_state = 0U;
+        size_t   existing        = number_of_slots;
+        uint32_t existing_state  = 0U;
+
+        scan_run(key, home, number_of_slots, candidate, candidate_state, existing, existing_state, true);
+
+        if (existing != number_of_slots)
+        {
+          // The key is already in the map.
+          current_size.fetch_sub(1U);
+
+          if (!assign_existing)
+          {
+            return false;
+          }
+
+          if (try_assign(existing, existing_state, value))
+          {
+            return true;
+          }
+
+          // The slot changed. Start again.
+          current_size.fetch_add(1U);
+          continue;
+        }
+
+        if (candidate == number_of_slots)
+        {
+          // Every slot is in use or being reclaimed.
+          current_size.fetch_sub(1U);
+          return false;
+        }
+
+        slot_type&     slot      = pslots[candidate];
+        const uint32_t inserting = state::next(candidate_state, state::Inserting);
+
+        if (!slot.control.compare_exchange_strong(candidate_state, inserting))
+        {
+          // Another thread changed the slot. Start again.
+          continue;
+        }
+
+        // When extending the run, is it still intact?
+        if ((state::get(candidate_state) == state::Empty) && (candidate != home) && !is_predecessor_in_use(candidate))
+        {
+          // A tombstone before this slot was reclaimed. Start again.
+          slot.control.store(state::next(inserting, state::Empty), etl::memory_order_release);
+          continue;
+        }
+
+        memcpy(&slot.key, &key, sizeof(TKey));
+        memcpy(&slot.value[state::buffer(inserting)], &value, sizeof(T));
+
+        const uint32_t pending = state::next(inserting, state::Pending);
+        slot.control.store(pending);
+
+        // Look for the same key inserted concurrently elsewhere in the run.
+        size_t   unused_candidate       = number_of_slots;
+        uint32_t unused_candidate_state = 0U;
+
+        scan_run(key, home, candidate, unused_candidate, unused_candidate_state, existing, existing_state, false);
+
+        if (existing != number_of_slots)
+        {
+          // Give way to the other insert and start again.
+          slot.control.store(state::next(pending, state::Deleted));
+          reclaim(candidate);
+          continue;
+        }
+
+        slot.control.store(state::next(pending, state::Full), etl::memory_order_release);
+
+        return true;
+      }
+    }
+
+    //*************************************************************************
+    /// Scans the probe run for the key, from home to the first empty slot.
+    ///\param own             The slot owned by the caller, which is skipped, or number_of_slots.
+    ///\param candidate       Set to the first tombstone or empty slot, if find_candidate is set.
+    ///\param candidate_state Set to the state word of the candidate.
+    ///\param existing        Set to the slot holding the key, or number_of_slots.
+    ///                       When checking a pending insert, also set if another pending
+    ///                       insert of the key is earlier in the run.
+    ///\param existing_state  Set to the state word of the existing slot.
+    //*************************************************************************
+    void scan_run(const_key_reference key, size_t home, size_t own, size_t& candidate, uint32_t& candidate_state, size_t& existing,
+                  uint32_t& existing_state, bool find_candidate) const
+    {
+      existing = number_of_slots;
+
+      size_t index = home;
+      size_t waits = 0U;
+
+      for (size_t probe = 0U; probe < number_of_slots;)
+      {
+        const slot_type& slot    = pslots[index];
+        const uint32_t   current = slot.control.load();
+
+        if (index != own)
+        {
+          switch (state::get(current))
+          {
+            case state::Empty:
+            {
+              if (find_candidate && (candidate == number_of_slots))
+              {
+                candidate       = index;
+                candidate_state = current;
+              }
+
+              return;
+            }
+
+            case state::Deleted:
+            {
+              if (find_candidate && (candidate == number_of_slots))
+              {
+                candidate       = index;
+                candidate_state = current;
+              }
+
+              break;
+            }
+
+            case state::Inserting:
+            {
+              // Wait for the key to be written.
+              wait(waits);
+              continue;
+            }
+
+            case state::Pending:
+            case state::Full:
+            case state::Updating:
+            {
+              key_storage_t key_copy;
+              memcpy(&key_copy, &slot.key, sizeof(TKey));
+
+              if (!is_unchanged(slot, current))
+              {
+                continue;
+              }
+
+              if (key_equal_function(key, *reinterpret_cast<const TKey*>(&key_copy)))
+              {
+                if (state::get(current) != state::Pending)
+                {
+                  existing       = index;
+                  existing_state = current;
+                  return;
+                }
+
+                if (find_candidate || (probe < distance(home, own)))
+                {
+                  // An earlier pending insert of the key wins.
+                  // A new insert waits to see the outcome.
+                  if (!find_candidate)
+                  {
+                    existing       = index;
+                    existing_state = current;
+                    return;
+                  }
+
+                  wait(waits);
+                  continue;
+                }
+
+                // A later pending insert of the key gives way to this one.
+                // Wait for it to do so.
+                wait(waits);
+                continue;
+              }
+
+              break;
+            }
+
+            default:
+            {
+              // Reclaiming.
+              break;
+            }
+          }
+        }
+
+        index = next_index(index);
+        ++probe;
+      }
+    }
+
+    //*************************************************************************
+    /// The distance of a slot along the probe run from home.
+    //*************************************************************************
+    size_t distance(size_t home, size_t index) const
+    {
+      return (index >= home) ? index - home : index + number_of_slots - home;
+    }
+
+    //*************************************************************************
+    /// Checks whether the slot before a newly claimed slot is still in use.
+    /// Waits for any reclamation of it to complete.
+    //*************************************************************************
+    bool is_predecessor_in_use(size_t index) const
+    {
+      const slot_type& predecessor = pslots[previous_index(index)];
+
+      uint32_t current = predecessor.control.load();
+      size_t   waits   = 0U;
+
+      while (state::get(current) == state::Reclaiming)
+      {
+        wait(waits);
+        current = predecessor.control.load();
+      }
+
+      return state::get(current) != state::Empty;
+    }
+
+    //*************************************************************************
+    /// Turns tombstones back into empty slots, working backwards from index,
+    /// while the following slot is empty.
+    /// Claiming a tombstone for reclamation before checking the following slot,
+    /// mirrors insert claiming a slot before checking the preceding one; one of
+    /// the two always sees the other.
+    //*************************************************************************
+    void reclaim(size_t index)
+    {
+      for (size_t n = 0U; n < number_of_slots; ++n)
+      {
+        slot_type& slot    = pslots[index];
+        uint32_t   current = slot.control.load();
+
+        if (state::get(current) != state::Deleted)
+        {
+          return;
+        }
+
+        const uint32_t reclaiming = state::next(current, state::Reclaiming);
+
+        if (!slot.control.compare_exchange_strong(current, reclaiming))
+        {
+          return;
+        }
+
+        if (state::get(pslots[next_index(index)].control.load()) != state::Empty)
+        {
+          slot.control.store(state::next(reclaiming, state::Deleted));
+          return;
+        }
+
+        slot.control.store(state::next(reclaiming, state::Empty));
+
+        index = previous_index(index);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iconcurrent_unordered_map(const iconcurrent_unordered_map&) ETL_DELETE;
+    iconcurrent_unordered_map& operator=(const iconcurrent_unordered_map&) ETL_DELETE;
+
+    /// The slots.
+    slot_type* pslots;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_type maximum_size;
+
+    /// The number of elements, including any reserved by inserts in progress.
+    etl::atomic<size_type> current_size;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// The function called by a waiting writer, or null.
+    const etl::ifunction<size_t>* p_wait_function;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_CONCURRENT_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iconcurrent_unordered_map() {}
+#else
+
+  protected:
+
+    ~iconcurrent_unordered_map() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// A fixed capacity concurrent_unordered_map.
+  /// The map has twice as many slots as its capacity, to keep probe runs short.
+  ///\tparam TKey         The key type.
+  ///\tparam T            The mapped type.
+  ///\tparam Max_Size     The maximum number of elements.
+  ///\tparam THash        The hash function.
+  ///\tparam TKeyEqual    The key equality function.
+  ///\tparam Memory_Model The memory model that determines the size type.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, const size_t Max_Size, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>,
+            const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class concurrent_unordered_map : public etl::iconcurrent_unordered_map<TKey, T, THash, TKeyEqual, Memory_Model>
+  {
+  private:
+
+    typedef etl::iconcurrent_unordered_map<TKey, T, THash, TKeyEqual, Memory_Model> base;
+
+  public:
+
+    typedef typename base::size_type size_type;
+
+    ETL_STATIC_ASSERT((Max_Size <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE  = size_type(Max_Size);
+    static ETL_CONSTANT size_t    MAX_SLOTS = 2U * Max_Size;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    concurrent_unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~concurrent_unordered_map() {}
+
+  private:
+
+    concurrent_unordered_map(const concurrent_unordered_map&) ETL_DELETE;
+    concurrent_unordered_map& operator=(const concurrent_unordered_map&) ETL_DELETE;
+
+    /// The slots.
+    typename base::slot_type slots[MAX_SLOTS];
+  };
+
+  template <typename TKey, typename T, const size_t Max_Size, typename THash, typename TKeyEqual, const size_t Memory_Model>
+  ETL_CONSTANT typename concurrent_unordered_map<TKey, T, Max_Size, THash, TKeyEqual, Memory_Model>::size_type
+    concurrent_unordered_map<TKey, T, Max_Size, THash, TKeyEqual, Memory_Model>::MAX_SIZE;
+
+  template <typename TKey, typename T, const size_t Max_Size, typename THash, typename TKeyEqual, const size_t Memory_Model>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, T, Max_Size, THash, TKeyEqual, Memory_Model>::MAX_SLOTS;
+
+  //***************************************************************************
+  /// A concurrent_unordered_map that uses an external array of slots.
+  /// As for concurrent_unordered_map, the maximum size is half the number of
+  /// slots, to keep probe runs short.
+  ///	param TKey         The key type.
+  ///	param T            The mapped type.
+  ///	param THash        The hash function.
+  ///	param TKeyEqual    The key equality function.
+  ///	param Memory_Model The memory model that determines the size type.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>,
+            const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class concurrent_unordered_map_ext : public etl::iconcurrent_unordered_map<TKey, T, THash, TKeyEqual, Memory_Model>
+  {
+  private:
+
+    typedef etl::iconcurrent_unordered_map<TKey, T, THash, TKeyEqual, Memory_Model> base;
+
+  public:
+
+    typedef typename base::size_type size_type;
+    typedef typename base::slot_type slot_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pslots_    The slots. Must not be used by anything else while the map exists.
+    ///\param max_slots_ The number of slots.
+    //*************************************************************************
+    concurrent_unordered_map_ext(slot_type* pslots_, size_t max_slots_, const THash& hash_ = THash(), const TKeyEqual& equal_ = TKeyEqual())
+      : base(pslots_, max_slots_, static_cast<size_type>(max_slots_ / 2U), hash_, equal_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~concurrent_unordered_map_ext() {}
+
+  private:
+
+    concurrent_unordered_map_ext(const concurrent_unordered_map_ext&) ETL_DELETE;
+    concurrent_unordered_map_ext& operator=(const concurrent_unordered_map_ext&) ETL_DELETE;
+  };
+} // namespace etl
+
+#endif
+#endif
@@ -0,0 +1,530 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_UNORDERED_MAP_INCLUDED
+#define ETL_CONST_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+
+#if ETL_NOT_USING_CPP14
+  #error NOT SUPPORTED FOR C++11 OR BELOW
+#endif
+
+#include "array.h"
+#include "functional.h"
+#include "nth_type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+#include "private/perfect_hash.h"
+
+///\defgroup const_unordered_map const_unordered_map
+/// A map that is built at compile time, with a minimal perfect hash.
+/// A lookup is one hash and one key comparison.
+///\ingroup containers
+
+namespace etl
+{
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  class iconst_unordered_map
+  {
+  public:
+
+    using key_type        = TKey;
+    using value_type      = ETL_OR_STD::pair<const TKey, TMapped>;
+    using mapped_type     = TMapped;
+    using hasher          = THash;
+    using key_equal       = TKeyEqual;
+    using const_reference = const value_type&;
+    using const_pointer   = const value_type*;
+    using const_iterator  = const value_type*;
+    using size_type       = size_t;
+
+    //*************************************************************************
+    /// Check that the elements are valid for a map.
+    /// The keys must be unique, and a perfect hash must have been found.
+    /// \return <b>true</b> if the elements are valid for the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const ETL_NOEXCEPT
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the beginning of the map.
+    /// The elements are in hash order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the beginning of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const ETL_NOEXCEPT
+    {
+      return element_list + element_count;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const ETL_NOEXCEPT
+    {
+      return element_list + element_count;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_pointer</code> to the beginning of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_pointer data() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Index operator.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the
+    /// index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& operator[](const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Key index operator.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the key
+    /// index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 const mapped_type& operator[](const K& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Gets the mapped value at the key index.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the
+    /// index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& at(const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Gets the mapped value at the key index.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the
+    /// index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 const mapped_type& at(const K& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Gets a const_iterator to the element with the key.
+    ///\param key The key of the element to find.
+    ///\return A <code>const_iterator</code> to the element, or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const ETL_NOEXCEPT
+    {
+      return find_key(key);
+    }
+
+    //*************************************************************************
+    ///\brief Gets a const_iterator to the element with the key.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element to find.
+    ///\return A <code>const_iterator</code> to the element, or end() if not found.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator find(const K& key) const ETL_NOEXCEPT
+    {
+      return find_key(key);
+    }
+
+    //*************************************************************************
+    ///\brief Checks if the map contains an element with key.
+    ///\param key The key of the element to check.
+    ///\return <b>true</b> if the map contains an element with key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    ///\brief Checks if the map contains an element with key.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element to check.
+    ///\return <b>true</b> if the map contains an element with key.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 bool contains(const K& key) const ETL_NOEXCEPT
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    ///\brief Counts the number of elements with key.
+    ///\param key The key of the element to count.
+    ///\return 0 or 1
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type count(const key_type& key) const ETL_NOEXCEPT
+    {
+      return contains(key) ? 1 : 0;
+    }
+
+    //*************************************************************************
+    ///\brief Counts the number of elements with key.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element to count.
+    ///\return 0 or 1
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 size_type count(const K& key) const ETL_NOEXCEPT
+    {
+      return contains(key) ? 1 : 0;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a range containing all elements with the key.
+    ///\param key The key of the element
+    ///\return etl::pair or std::pair containing a pair of iterators.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const ETL_NOEXCEPT
+    {
+      const_iterator itr = find(key);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(itr, (itr == end()) ? itr : itr + 1);
+    }
+
+    //*************************************************************************
+    ///\brief Returns a range containing all elements with the key.
+    /// Enabled for transparent key equality.
+    ///\param key The key of the element
+    ///\return etl::pair or std::pair containing a pair of iterators.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const ETL_NOEXCEPT
+    {
+      const_iterator itr = find(key);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(itr, (itr == end()) ? itr : itr + 1);
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    ///\return <b>true</b> if the map is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const ETL_NOEXCEPT
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is full.
+    ///\return <b>true</b> if the map is full.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool full() const ETL_NOEXCEPT
+    {
+      return (max_elements != 0) && (size() == max_elements);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the map.
+    ///\return The size of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const ETL_NOEXCEPT
+    {
+      return element_count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum size of the map.
+    ///\return The maximum size of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type max_size() const ETL_NOEXCEPT
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity of the map.
+    /// This is always equal to max_size().
+    ///\return The capacity of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type capacity() const ETL_NOEXCEPT
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    //*************************************************************************
+    ETL_CONSTEXPR14 hasher hash_function() const ETL_NOEXCEPT
+    {
+      return hasher();
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_equal key_eq() const ETL_NOEXCEPT
+    {
+      return key_equal();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Gets the key of an input element, for the perfect hash builder.
+    //*************************************************************************
+    struct key_of
+    {
+      static ETL_CONSTEXPR14 const key_type& key(const value_type& element) ETL_NOEXCEPT
+      {
+        return element.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ETL_CONSTEXPR14 iconst_unordered_map(const value_type* element_list_, const int32_t* displacement_, size_type size_, size_type max_elements_,
+                                         bool valid_) ETL_NOEXCEPT
+      : element_list(element_list_)
+      , displacement(displacement_)
+      , element_count(size_)
+      , max_elements(max_elements_)
+      , valid(valid_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the result of building the perfect hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void set_valid(bool valid_) ETL_NOEXCEPT
+    {
+      valid = valid_;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the only slot that the key can be in, and checks it.
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator find_key(const K& key) const ETL_NOEXCEPT
+    {
+      if (element_count == 0U)
+      {
+        return end();
+      }
+
+      const size_t slot = private_perfect_hash::slot_of(static_cast<uint64_t>(hasher()(key)), displacement, element_count);
+
+      return key_equal()(element_list[slot].first, key) ? element_list + slot : end();
+    }
+
+    const value_type* element_list;
+    const int32_t*    displacement;
+    size_type         element_count;
+    size_type         max_elements;
+    bool              valid;
+  };
+
+  //*********************************************************************
+  /// Unordered map type designed for constexpr.
+  /// A minimal perfect hash is built for the elements at compile time.
+  /// Use is_valid() to check that the keys were unique.
+  /// The template instantiation depth grows as log2(Size), so large tables
+  /// do not need -ftemplate-depth. They do take longer to evaluate, and may
+  /// reach the compiler's constexpr evaluation limit instead.
+  //*********************************************************************
+  template <typename TKey, typename TMapped, size_t Size, typename THash = etl::constexpr_hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>>
+  class const_unordered_map : public iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>
+  {
+  public:
+
+    using base_t = iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>;
+
+    using key_type        = typename base_t::key_type;
+    using value_type      = typename base_t::value_type;
+    using mapped_type     = typename base_t::mapped_type;
+    using hasher          = typename base_t::hasher;
+    using key_equal       = typename base_t::key_equal;
+    using const_reference = typename base_t::const_reference;
+    using const_pointer   = typename base_t::const_pointer;
+    using const_iterator  = typename base_t::const_iterator;
+    using size_type       = typename base_t::size_type;
+
+    static_assert((etl::is_default_constructible<key_type>::value), "key_type must be default constructible");
+    static_assert((etl::is_default_constructible<mapped_type>::value), "mapped_type must be default constructible");
+
+    //*************************************************************************
+    ///\brief Default construct a const_unordered_map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_unordered_map() ETL_NOEXCEPT
+      : base_t(storage.element_list, storage.displacement, 0U, Size, true)
+      , storage{}
+    {
+    }
+
+    //*************************************************************************
+    ///\brief Construct a const_unordered_map from a variadic list of elements.
+    /// Static asserts if the elements are not of type <code>value_type</code>.
+    /// Static asserts if the number of elements is greater than the capacity of
+    /// the const_unordered_map.
+    //*************************************************************************
+    template <typename... TElements>
+    ETL_CONSTEXPR14 explicit const_unordered_map(TElements&&... elements) ETL_NOEXCEPT
+      : base_t(storage.element_list, storage.displacement, sizeof...(TElements), Size, false)
+      , storage(make_storage(etl::array<value_type, sizeof...(TElements)>{{etl::forward<TElements>(elements)...}}))
+    {
+      static_assert((etl::are_all_same<value_type, etl::decay_t<TElements>...>::value), "All elements must be value_type");
+      static_assert(sizeof...(elements) <= Size, "Number of elements exceeds capacity");
+
+      this->set_valid(storage.valid);
+    }
+
+  private:
+
+    using table_t = private_perfect_hash::table<Size>;
+
+    //*************************************************************************
+    /// The elements in their slots, and the displacements for each bucket.
+    //*************************************************************************
+    struct storage_t
+    {
+      value_type element_list[table_t::Capacity];
+      int32_t    displacement[table_t::Capacity];
+      bool       valid;
+    };
+
+    //*************************************************************************
+    /// Builds the perfect hash for the elements.
+    //*************************************************************************
+    template <size_t N>
+    static ETL_CONSTEXPR14 storage_t make_storage(const etl::array<value_type, N>& inputs) ETL_NOEXCEPT
+    {
+      return make_storage(inputs, private_perfect_hash::build<Size, typename base_t::key_of, THash, TKeyEqual>(inputs),
+                          etl::make_index_sequence<table_t::Capacity>());
+    }
+
+    //*************************************************************************
+    /// Places the elements in their slots.
+    //*************************************************************************
+    template <size_t N, size_t... Indices>
+    static ETL_CONSTEXPR14 storage_t make_storage(const etl::array<value_type, N>& inputs, const table_t& table,
+                                                  etl::index_sequence<Indices...>) ETL_NOEXCEPT
+    {
+      return storage_t{{element_at<Indices>(inputs, table)...}, {table.displacement[Indices]...}, table.valid};
+    }
+
+    //*************************************************************************
+    template <size_t Index, size_t N>
+    static ETL_CONSTEXPR14 value_type element_at(const etl::array<value_type, N>& inputs, const table_t& table) ETL_NOEXCEPT
+    {
+      return (Index < N) ? inputs[table.owner[Index]] : value_type();
+    }
+
+    storage_t storage;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17
+  template <typename... TElements>
+  const_unordered_map(TElements...) -> const_unordered_map<typename etl::nth_type_t<0, TElements...>::first_type,
+                                                           typename etl::nth_type_t<0, TElements...>::second_type, sizeof...(TElements)>;
+#endif
+
+  //*************************************************************************
+  /// Equality test.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  ETL_CONSTEXPR14 bool operator==(const etl::iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>& lhs,
+                                  const etl::iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>& rhs) ETL_NOEXCEPT
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (auto itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      auto other = rhs.find(itr->first);
+
+      if ((other == rhs.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  /// Inequality test.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  ETL_CONSTEXPR14 bool operator!=(const etl::iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>& lhs,
+                                  const etl::iconst_unordered_map<TKey, TMapped, THash, TKeyEqual>& rhs) ETL_NOEXCEPT
+  {
+    return !(lhs == rhs);
+  }
+} // namespace etl
+
+#endif
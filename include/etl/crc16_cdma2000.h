@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc16_cdma2000_t<256U> crc16_cdma2000_t256;
-  typedef etl::crc16_cdma2000_t<16U>  crc16_cdma2000_t16;
-  typedef etl::crc16_cdma2000_t<4U>   crc16_cdma2000_t4;
-  typedef crc16_cdma2000_t256         crc16_cdma2000;
+  typedef etl::crc16_cdma2000_t<4096U> crc16_cdma2000_t4096;
+  typedef etl::crc16_cdma2000_t<2048U> crc16_cdma2000_t2048;
+  typedef etl::crc16_cdma2000_t<256U>  crc16_cdma2000_t256;
+  typedef etl::crc16_cdma2000_t<16U>   crc16_cdma2000_t16;
+  typedef etl::crc16_cdma2000_t<4U>    crc16_cdma2000_t4;
+  typedef crc16_cdma2000_t256          crc16_cdma2000;
 } // namespace etl
 #endif
@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc32_jamcrc_t<256U> crc32_jamcrc_t256;
-  typedef etl::crc32_jamcrc_t<16U>  crc32_jamcrc_t16;
-  typedef etl::crc32_jamcrc_t<4U>   crc32_jamcrc_t4;
-  typedef crc32_jamcrc_t256         crc32_jamcrc;
+  typedef etl::crc32_jamcrc_t<4096U> crc32_jamcrc_t4096;
+  typedef etl::crc32_jamcrc_t<2048U> crc32_jamcrc_t2048;
+  typedef etl::crc32_jamcrc_t<256U>  crc32_jamcrc_t256;
+  typedef etl::crc32_jamcrc_t<16U>   crc32_jamcrc_t16;
+  typedef etl::crc32_jamcrc_t<4U>    crc32_jamcrc_t4;
+  typedef crc32_jamcrc_t256          crc32_jamcrc;
 } // namespace etl
 #endif
@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc64_ecma_t<256U> crc64_ecma_t256;
-  typedef etl::crc64_ecma_t<16U>  crc64_ecma_t16;
-  typedef etl::crc64_ecma_t<4U>   crc64_ecma_t4;
-  typedef crc64_ecma_t256         crc64_ecma;
+  typedef etl::crc64_ecma_t<4096U> crc64_ecma_t4096;
+  typedef etl::crc64_ecma_t<2048U> crc64_ecma_t2048;
+  typedef etl::crc64_ecma_t<256U>  crc64_ecma_t256;
+  typedef etl::crc64_ecma_t<16U>   crc64_ecma_t16;
+  typedef etl::crc64_ecma_t<4U>    crc64_ecma_t4;
+  typedef crc64_ecma_t256          crc64_ecma;
 } // namespace etl
 #endif
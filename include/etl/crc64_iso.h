@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc64_iso_t<256U> crc64_iso_t256;
-  typedef etl::crc64_iso_t<16U>  crc64_iso_t16;
-  typedef etl::crc64_iso_t<4U>   crc64_iso_t4;
-  typedef crc64_iso_t256         crc64_iso;
+  typedef etl::crc64_iso_t<4096U> crc64_iso_t4096;
+  typedef etl::crc64_iso_t<2048U> crc64_iso_t2048;
+  typedef etl::crc64_iso_t<256U>  crc64_iso_t256;
+  typedef etl::crc64_iso_t<16U>   crc64_iso_t16;
+  typedef etl::crc64_iso_t<4U>    crc64_iso_t4;
+  typedef crc64_iso_t256          crc64_iso;
 } // namespace etl
 #endif
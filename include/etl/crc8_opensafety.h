@@ -67,10 +67,12 @@ namespace etl
   };
 #endif
 
-  typedef crc8_opensafety_t<256U> crc8_opensafety_t256;
-  typedef crc8_opensafety_t<16U>  crc8_opensafety_t16;
-  typedef crc8_opensafety_t<4U>   crc8_opensafety_t4;
-  typedef crc8_opensafety_t256    crc8_opensafety;
+  typedef crc8_opensafety_t<4096U> crc8_opensafety_t4096;
+  typedef crc8_opensafety_t<2048U> crc8_opensafety_t2048;
+  typedef crc8_opensafety_t<256U>  crc8_opensafety_t256;
+  typedef crc8_opensafety_t<16U>   crc8_opensafety_t16;
+  typedef crc8_opensafety_t<4U>    crc8_opensafety_t4;
+  typedef crc8_opensafety_t256     crc8_opensafety;
 } // namespace etl
 
 #endif
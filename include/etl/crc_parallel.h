@@ -0,0 +1,162 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_PARALLEL_INCLUDED
+#define ETL_CRC_PARALLEL_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_STL && ETL_USING_CPP11
+
+  #include <thread>
+
+///\defgroup crc_parallel Multi-threaded CRC calculation
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc_parallel
+  {
+    //*************************************************************************
+    /// The smallest block that a thread is given.
+    /// Smaller blocks are not worth the cost of starting a thread.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Min_Chunk_Size = 64U * 1024U;
+
+    //*************************************************************************
+    /// Joins the threads that are still running when it goes out of scope.
+    /// If starting a thread throws, those already started must be joined
+    /// before the exception leaves, or their destructors call std::terminate.
+    //*************************************************************************
+    class thread_joiner
+    {
+    public:
+
+      thread_joiner(std::thread* threads_, size_t count_)
+        : threads(threads_)
+        , count(count_)
+      {
+      }
+
+      ~thread_joiner()
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (threads[i].joinable())
+          {
+            threads[i].join();
+          }
+        }
+      }
+
+    private:
+
+      thread_joiner(const thread_joiner&) ETL_DELETE;
+      thread_joiner& operator=(const thread_joiner&) ETL_DELETE;
+
+      std::thread* threads;
+      size_t       count;
+    };
+  } // namespace private_crc_parallel
+
+  //***************************************************************************
+  /// Calculates the CRC of a block of bytes using up to Threads threads.
+  /// The block is split into chunks, the CRC of each chunk is calculated by a
+  /// separate thread, and the CRCs are merged with TCrc::combine.
+  /// The calling thread calculates the CRC of the first chunk.
+  /// Chunks are at least 64KB, so smaller blocks use fewer threads.
+  ///\tparam TCrc    The CRC type, such as etl::crc32.
+  ///\tparam Threads The maximum number of threads, including the calling thread.
+  ///\param begin    The start of the block.
+  ///\param end      The end of the block.
+  ///\ingroup crc_parallel
+  //***************************************************************************
+  template <typename TCrc, size_t Threads, typename TPointer>
+  typename TCrc::value_type crc_parallel(TPointer begin, TPointer end)
+  {
+    ETL_STATIC_ASSERT(Threads != 0U, "There must be at least one thread");
+    ETL_STATIC_ASSERT(etl::is_pointer<TPointer>::value, "The block must be a pointer range");
+    ETL_STATIC_ASSERT(sizeof(typename etl::remove_pointer<TPointer>::type) == 1U, "Type not supported");
+
+    typedef typename TCrc::value_type value_type;
+
+    const size_t length = static_cast<size_t>(end - begin);
+
+    size_t chunks = length / private_crc_parallel::Min_Chunk_Size;
+
+    if (chunks > Threads)
+    {
+      chunks = Threads;
+    }
+
+    if (chunks < 2U)
+    {
+      return TCrc(begin, end).value();
+    }
+
+    const size_t chunk_size = length / chunks;
+
+    value_type  crcs[Threads];
+    std::thread threads[Threads];
+
+    private_crc_parallel::thread_joiner joiner(threads, Threads);
+
+    // The last chunk takes the remainder.
+    for (size_t i = 1U; i < chunks; ++i)
+    {
+      const TPointer chunk_begin = begin + (i * chunk_size);
+      const TPointer chunk_end   = (i == (chunks - 1U)) ? end : chunk_begin + chunk_size;
+      value_type&    crc         = crcs[i];
+
+      threads[i] = std::thread([chunk_begin, chunk_end, &crc]() { crc = TCrc(chunk_begin, chunk_end).value(); });
+    }
+
+    value_type result = TCrc(begin, begin + chunk_size).value();
+
+    for (size_t i = 1U; i < chunks; ++i)
+    {
+      threads[i].join();
+
+      const size_t chunk_length = (i == (chunks - 1U)) ? (length - (i * chunk_size)) : chunk_size;
+
+      result = TCrc::combine(result, crcs[i], chunk_length);
+    }
+
+    return result;
+  }
+} // namespace etl
+
+#endif
+#endif
@@ -0,0 +1,931 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_ARRAY_INCLUDED
+#define ETL_EYTZINGER_ARRAY_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "memory.h"
+#include "parameter_type.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup eytzinger_array eytzinger_array
+/// A sorted set of values, with the capacity defined at compile time, stored
+/// in breadth first (Eytzinger) order. The children of the element at index
+/// 'k' are at '2k' and '2k + 1', counting from 1.
+/// A search reads the elements in the order of the array, so the elements
+/// for the next few steps are in one cache line and can be prefetched. Each
+/// step selects the next index without a branch.
+/// The set is built from a sorted range and is not modified afterwards.
+/// Has construction of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+/// The iterators visit the values in sorted order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the eytzinger_array.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  class eytzinger_array_exception : public etl::exception
+  {
+  public:
+
+    eytzinger_array_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the eytzinger_array.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  class eytzinger_array_full : public etl::eytzinger_array_exception
+  {
+  public:
+
+    eytzinger_array_full(string_type file_name_, numeric_type line_number_)
+      : etl::eytzinger_array_exception(ETL_ERROR_TEXT("eytzinger_array:full", ETL_EYTZINGER_ARRAY_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Unsorted exception for the eytzinger_array.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  class eytzinger_array_unsorted : public etl::eytzinger_array_exception
+  {
+  public:
+
+    eytzinger_array_unsorted(string_type file_name_, numeric_type line_number_)
+      : etl::eytzinger_array_exception(ETL_ERROR_TEXT("eytzinger_array:unsorted", ETL_EYTZINGER_ARRAY_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized eytzinger_arrays.
+  /// Can be used as a reference type for all eytzinger_arrays containing a
+  /// specific type.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T> >
+  class ieytzinger_array
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T                 key_type;
+    typedef TCompare          key_compare;
+    typedef TCompare          value_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// const_iterator.
+    /// Visits the values in sorted order, which is the in-order walk of the
+    /// implicit tree.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class ieytzinger_array;
+
+      const_iterator()
+        : p_values(ETL_NULLPTR)
+        , size(0U)
+        , index(0U)
+      {
+      }
+
+      const_reference operator*() const
+      {
+        return p_values[index - 1U];
+      }
+
+      const_pointer operator->() const
+      {
+        return &p_values[index - 1U];
+      }
+
+      const_iterator& operator++()
+      {
+        index = ieytzinger_array::next_index(index, size);
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        index = ieytzinger_array::next_index(index, size);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        index = ieytzinger_array::previous_index(index, size);
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        index = ieytzinger_array::previous_index(index, size);
+        return temp;
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_values == rhs.p_values) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const_pointer p_values_, size_type size_, size_type index_)
+        : p_values(p_values_)
+        , size(size_)
+        , index(index_)
+      {
+      }
+
+      const_pointer p_values;
+      size_type     size;
+      size_type     index; ///< Counting from 1. 0 is end().
+    };
+
+    typedef const_iterator                               iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the smallest value.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return make_iterator(first_index(current_size));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the smallest value.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to one past the largest value.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return make_iterator(0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to one past the largest value.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the largest value.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the largest value.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to one before the smallest value.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to one before the smallest value.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Assigns the values of a sorted range with no duplicates.
+    /// If asserts or exceptions are enabled, emits eytzinger_array_full if
+    /// there is not enough space, and, in a debug build,
+    /// eytzinger_array_unsorted if the range is not sorted.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      const size_type n = size_type(etl::distance(first, last));
+
+      ETL_ASSERT_OR_RETURN(n <= CAPACITY, ETL_ERROR(eytzinger_array_full));
+#if ETL_IS_DEBUG_BUILD
+      ETL_ASSERT_OR_RETURN(etl::is_unique_sorted(first, last, compare), ETL_ERROR(eytzinger_array_unsorted));
+#endif
+
+      clear();
+
+      // The in-order walk of the tree visits the positions of the values in
+      // sorted order.
+      size_type index = first_index(n);
+
+      while (first != last)
+      {
+        ::new (p_buffer + index - 1U) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        ++current_size;
+        ++first;
+
+        index = next_index(index, n);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds a value.
+    ///\param key The value to search for.
+    ///\return An iterator to the value, or end() if not found.
+    //*************************************************************************
+    const_iterator find(parameter_t key) const
+    {
+      return make_iterator(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return make_iterator(find_index(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks if the set contains a value.
+    //*************************************************************************
+    bool contains(parameter_t key) const
+    {
+      return find_index(key) != 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Counts the values equal to the key. 0 or 1.
+    //*************************************************************************
+    size_type count(parameter_t key) const
+    {
+      return (find_index(key) != 0U) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find_index(key) != 0U) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first value not less than the key.
+    ///\return An iterator to the value, or end() if there is none.
+    //*************************************************************************
+    const_iterator lower_bound(parameter_t key) const
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first value greater than the key.
+    ///\return An iterator to the value, or end() if there is none.
+    //*************************************************************************
+    const_iterator upper_bound(parameter_t key) const
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the range of values equal to the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Clears the eytzinger_array.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_buffer, p_buffer + current_size);
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Returns the values in breadth first order.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the eytzinger_array is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the eytzinger_array is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two values.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ieytzinger_array& operator=(const ieytzinger_array& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_container(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ieytzinger_array(T* p_buffer_, size_type max_size_)
+      : p_buffer(p_buffer_)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the values of another eytzinger_array. The layout is the same.
+    //*************************************************************************
+    void copy_container(const ieytzinger_array& other)
+    {
+      ETL_ASSERT_OR_RETURN(other.size() <= CAPACITY, ETL_ERROR(eytzinger_array_full));
+
+      clear();
+
+      etl::uninitialized_copy(other.p_buffer, other.p_buffer + other.current_size, p_buffer);
+      current_size = other.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Elements per cache line, rounded down to a power of two.
+    /// The descendants of 'k', four levels down for 32 bit values, start at
+    /// 'k * Prefetch_Stride' and fill one cache line.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Cache_Line_Size = 64U;
+    static ETL_CONSTANT size_t Prefetch_Stride = (sizeof(T) <= (Cache_Line_Size / 16U))  ? 16U
+                                                 : (sizeof(T) <= (Cache_Line_Size / 8U)) ? 8U
+                                                 : (sizeof(T) <= (Cache_Line_Size / 4U)) ? 4U
+                                                 : (sizeof(T) <= (Cache_Line_Size / 2U)) ? 2U
+                                                                                          : 1U;
+
+    //*************************************************************************
+    /// The index of the first value in sorted order, the leftmost node.
+    //*************************************************************************
+    static size_type first_index(size_type n)
+    {
+      size_type index = (n == 0U) ? 0U : 1U;
+
+      while ((index != 0U) && ((2U * index) <= n))
+      {
+        index = 2U * index;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The index of the last value in sorted order, the rightmost node.
+    //*************************************************************************
+    static size_type last_index(size_type n)
+    {
+      size_type index = (n == 0U) ? 0U : 1U;
+
+      while ((index != 0U) && ((2U * index + 1U) <= n))
+      {
+        index = 2U * index + 1U;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The index of the next value in sorted order, or 0 for the end.
+    /// The leftmost node of the right subtree, if there is one, otherwise the
+    /// first ancestor that this node is in the left subtree of.
+    //*************************************************************************
+    static size_type next_index(size_type index, size_type n)
+    {
+      if ((2U * index + 1U) <= n)
+      {
+        index = 2U * index + 1U;
+
+        while ((2U * index) <= n)
+        {
+          index = 2U * index;
+        }
+      }
+      else
+      {
+        // Up past the right children, then one more.
+        while ((index & 1U) != 0U)
+        {
+          index >>= 1U;
+        }
+
+        index >>= 1U;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The index of the previous value in sorted order. From the end it is
+    /// the last value.
+    //*************************************************************************
+    static size_type previous_index(size_type index, size_type n)
+    {
+      if (index == 0U)
+      {
+        return last_index(n);
+      }
+
+      if ((2U * index) <= n)
+      {
+        index = 2U * index;
+
+        while ((2U * index + 1U) <= n)
+        {
+          index = 2U * index + 1U;
+        }
+      }
+      else
+      {
+        // Up past the left children, then one more.
+        while ((index & 1U) == 0U)
+        {
+          index >>= 1U;
+        }
+
+        index >>= 1U;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The index of the node where a search path last went left, or 0 if it
+    /// never did. That is the path with the trailing right turns, and the
+    /// left turn before them, removed.
+    //*************************************************************************
+    static size_type last_left_turn(size_type index)
+    {
+      return index >> (etl::count_trailing_ones(index) + 1U);
+    }
+
+    //*************************************************************************
+    /// The index of the first value not less than the key, or 0.
+    /// Goes left or right on every step by adding the result of the
+    /// comparison to the index, so there is no branch to mispredict.
+    //*************************************************************************
+    template <typename K>
+    size_type lower_bound_index(const K& key) const
+    {
+      size_type index = 1U;
+
+      while (index <= current_size)
+      {
+        // The descendants a few levels down. This must be in the loop, as
+        // GCC removes a call to a function that only prefetches.
+        const size_type descendant = index * Prefetch_Stride;
+
+        if (descendant <= current_size)
+        {
+          ETL_PREFETCH(p_buffer + descendant - 1U);
+        }
+
+        index = (2U * index) + (compare(p_buffer[index - 1U], key) ? 1U : 0U);
+      }
+
+      return last_left_turn(index);
+    }
+
+    //*************************************************************************
+    /// The index of the first value greater than the key, or 0.
+    //*************************************************************************
+    template <typename K>
+    size_type upper_bound_index(const K& key) const
+    {
+      size_type index = 1U;
+
+      while (index <= current_size)
+      {
+        const size_type descendant = index * Prefetch_Stride;
+
+        if (descendant <= current_size)
+        {
+          ETL_PREFETCH(p_buffer + descendant - 1U);
+        }
+
+        index = (2U * index) + (compare(key, p_buffer[index - 1U]) ? 0U : 1U);
+      }
+
+      return last_left_turn(index);
+    }
+
+    //*************************************************************************
+    /// The index of the value equal to the key, or 0.
+    //*************************************************************************
+    template <typename K>
+    size_type find_index(const K& key) const
+    {
+      const size_type index = lower_bound_index(key);
+
+      return ((index != 0U) && !compare(key, p_buffer[index - 1U])) ? index : 0U;
+    }
+
+    //*************************************************************************
+    const_iterator make_iterator(size_type index) const
+    {
+      return const_iterator(p_buffer, current_size, index);
+    }
+
+    // Disable copy construction.
+    ieytzinger_array(const ieytzinger_array&);
+
+    T*              p_buffer;
+    size_type       current_size;
+    const size_type CAPACITY;
+    key_compare     compare;
+
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_EYTZINGER_ARRAY) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ieytzinger_array() {}
+#else
+
+  protected:
+
+    ~ieytzinger_array() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  template <typename T, typename TCompare>
+  bool operator==(const etl::ieytzinger_array<T, TCompare>& lhs, const etl::ieytzinger_array<T, TCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  template <typename T, typename TCompare>
+  bool operator!=(const etl::ieytzinger_array<T, TCompare>& lhs, const etl::ieytzinger_array<T, TCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// An eytzinger_array with the capacity defined at compile time.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\tparam TCompare  The type to compare values. Default = etl::less<T>
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class eytzinger_array : public etl::ieytzinger_array<T, TCompare>
+  {
+  private:
+
+    typedef etl::ieytzinger_array<T, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    eytzinger_array()
+      : base(buffer.begin(), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    eytzinger_array(const eytzinger_array& other)
+      : base(buffer.begin(), MAX_SIZE)
+    {
+      base::copy_container(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range with no duplicates.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    eytzinger_array(TIterator first, TIterator last)
+      : base(buffer.begin(), MAX_SIZE)
+    {
+      base::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from a sorted initializer_list with no duplicates.
+    //*************************************************************************
+    eytzinger_array(std::initializer_list<T> init)
+      : base(buffer.begin(), MAX_SIZE)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~eytzinger_array()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    eytzinger_array& operator=(const eytzinger_array& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    /// The values in breadth first order.
+    etl::uninitialized_buffer_of<T, MAX_SIZE_> buffer;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t eytzinger_array<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// An eytzinger_array that uses an external buffer.
+  /// The buffer must hold max_size values.
+  ///\tparam T        The value type.
+  ///\tparam TCompare The type to compare values. Default = etl::less<T>
+  ///\ingroup eytzinger_array
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T> >
+  class eytzinger_array_ext : public etl::ieytzinger_array<T, TCompare>
+  {
+  private:
+
+    typedef etl::ieytzinger_array<T, TCompare> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    eytzinger_array_ext(void* buffer, size_t max_size)
+      : base(reinterpret_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    eytzinger_array_ext(const eytzinger_array_ext& other, void* buffer, size_t max_size)
+      : base(reinterpret_cast<T*>(buffer), max_size)
+    {
+      base::copy_container(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range with no duplicates.
+    //*************************************************************************
+    template <typename TIterator>
+    eytzinger_array_ext(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : base(reinterpret_cast<T*>(buffer), max_size)
+    {
+      base::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~eytzinger_array_ext()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    eytzinger_array_ext& operator=(const eytzinger_array_ext& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction without a buffer.
+    eytzinger_array_ext(const eytzinger_array_ext&) ETL_DELETE;
+  };
+} // namespace etl
+
+#endif
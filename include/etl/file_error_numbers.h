@@ -111,4 +111,10 @@ SOFTWARE.
 #define ETL_SIGNAL_FILE_ID                         "78"
 #define ETL_FORMAT_FILE_ID                         "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID               "80"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID             "81"
+#define ETL_BTREE_FILE_ID                          "82"
+#define ETL_SOA_FLAT_MAP_FILE_ID                   "83"
+#define ETL_EYTZINGER_ARRAY_FILE_ID                "84"
+#define ETL_KWAY_MERGE_FILE_ID                     "85"
+#define ETL_BLOOM_FILTER_FILE_ID                   "86"
 #endif
@@ -330,10 +330,30 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted and free of
+    /// duplicate keys to the flat_map.
+    /// No comparisons are made.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the
+    /// flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(flat_map_full));
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
         ++first;
       }
     }
@@ -412,20 +432,46 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The values are appended, sorted and merged in place with the existing
+    /// ones, without allocating, in O(N log N) rather than O(N) per value.
+    /// The unused capacity is the scratch space for the sort. If less than
+    /// half of the range fits, it is up to O(N log^2 N).
+    /// If a key is repeated in the range then the first one is inserted.
     /// If asserts or exceptions are enabled, emits flat_map_full if the
     /// flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      size_type n_sorted = size();
+
       while (first != last)
       {
-        insert(*first);
+        if (full())
+        {
+          // Make room by dropping the appended values with duplicate keys.
+          release_last(refmap_t::merge_appended(n_sorted));
+          n_sorted = size();
+
+          if (full())
+          {
+            // Only a value with a key that is already present can be accepted.
+            ETL_ASSERT_OR_RETURN(find((*first).first) != end(), ETL_ERROR(flat_map_full));
+            ++first;
+            continue;
+          }
+        }
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
         ++first;
       }
+
+      release_last(refmap_t::merge_appended(n_sorted));
     }
 
     //*************************************************************************
@@ -912,7 +958,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign(etl::sorted_unique_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -1009,13 +1055,16 @@ namespace etl
         etl::iflat_map<TKey, TMapped, TKeyCompare>::iterator first = rhs.begin();
         etl::iflat_map<TKey, TMapped, TKeyCompare>::iterator last  = rhs.end();
 
-        // Move all of the elements.
+        // Move all of the elements. They are already in order.
         while (first != last)
         {
           typename etl::iflat_map<TKey, TMapped, TKeyCompare>::iterator temp = first;
           ++temp;
 
-          this->insert(etl::move(*first));
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(etl::move(*first));
+          ETL_INCREMENT_DEBUG_COUNT;
+          refmap_t::append(*pvalue);
           first = temp;
         }
       }
@@ -1034,6 +1083,14 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
 
+    //*************************************************************************
+    /// Destroys and removes the last 'n' values.
+    //*************************************************************************
+    void release_last(size_type n)
+    {
+      erase(etl::prev(cend(), difference_type(n)), cend());
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     template <typename TValueType>
@@ -1158,7 +1215,7 @@ namespace etl
     flat_map(const flat_map& other)
       : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign(etl::sorted_unique_t(), other.cbegin(), other.cend());
     }
 
 #if ETL_USING_CPP11
@@ -1188,6 +1245,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and free of
+    /// duplicate keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->assign(tag, first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1214,7 +1285,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign(etl::sorted_unique_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
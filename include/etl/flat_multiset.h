@@ -220,10 +220,29 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted to the flat_multiset.
+    /// No comparisons are made.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the
+    /// flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(flat_multiset_full));
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
         ++first;
       }
     }
@@ -302,20 +321,38 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multiset.
+    /// The values are appended, sorted and merged in place with the existing
+    /// ones, without allocating, in O(N log N) rather than O(N) per value.
+    /// The unused capacity is the scratch space for the sort. If less than
+    /// half of the range fits, it is up to O(N log^2 N). Equivalent values keep
+    /// their order and are placed after those already present.
     /// If asserts or exceptions are enabled, emits flat_multiset_full if the
     /// flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_type n_sorted = size();
+
       while (first != last)
       {
-        insert(*first);
+        if (full())
+        {
+          refset_t::merge_appended(n_sorted);
+          ETL_ASSERT_FAIL(ETL_ERROR(flat_multiset_full));
+          return;
+        }
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
         ++first;
       }
+
+      refset_t::merge_appended(n_sorted);
     }
 
     //*************************************************************************
@@ -743,7 +780,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign(etl::sorted_equivalent_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -840,13 +877,16 @@ namespace etl
         etl::iflat_multiset<T, TKeyCompare>::iterator first = rhs.begin();
         etl::iflat_multiset<T, TKeyCompare>::iterator last  = rhs.end();
 
-        // Move all of the elements.
+        // Move all of the elements. They are already in order.
         while (first != last)
         {
           typename etl::iflat_multiset<T, TKeyCompare>::iterator temp = first;
           ++temp;
 
-          this->insert(etl::move(*first));
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(etl::move(*first));
+          ETL_INCREMENT_DEBUG_COUNT;
+          refset_t::append(*pvalue);
           first = temp;
         }
       }
@@ -935,7 +975,7 @@ namespace etl
     flat_multiset(const flat_multiset& other)
       : iflat_multiset<T, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign(etl::sorted_equivalent_t(), other.cbegin(), other.cend());
     }
 
 #if ETL_USING_CPP11
@@ -965,6 +1005,19 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_multiset(etl::sorted_equivalent_t tag, TIterator first, TIterator last)
+      : iflat_multiset<T, TCompare>(lookup, storage)
+    {
+      this->assign(tag, first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -991,7 +1044,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign(etl::sorted_equivalent_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -218,10 +218,30 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted and free of
+    /// duplicates to the flat_set.
+    /// No comparisons are made.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the
+    /// flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(flat_set_full));
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
         ++first;
       }
     }
@@ -308,20 +328,46 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The values are appended, sorted and merged in place with the existing
+    /// ones, without allocating, in O(N log N) rather than O(N) per value.
+    /// The unused capacity is the scratch space for the sort. If less than
+    /// half of the range fits, it is up to O(N log^2 N).
+    /// If a key is repeated in the range then the first one is inserted.
     /// If asserts or exceptions are enabled, emits flat_set_full if the
     /// flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      size_type n_sorted = size();
+
       while (first != last)
       {
-        insert(*first);
+        if (full())
+        {
+          // Make room by dropping the appended values with duplicate keys.
+          release_last(refset_t::merge_appended(n_sorted));
+          n_sorted = size();
+
+          if (full())
+          {
+            // Only a value with a key that is already present can be accepted.
+            ETL_ASSERT_OR_RETURN(find(*first) != end(), ETL_ERROR(flat_set_full));
+            ++first;
+            continue;
+          }
+        }
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
         ++first;
       }
+
+      release_last(refset_t::merge_appended(n_sorted));
     }
 
     //*************************************************************************
@@ -836,6 +882,39 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Copies the values that are also in 'other' to d_first, in order.
+    /// When one set is much larger than the other, the larger is searched by
+    /// galloping rather than walked.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator set_intersection(const iflat_set& other, TOutputIterator d_first) const
+    {
+      return etl::set_intersection(begin(), end(), other.begin(), other.end(), d_first, compare);
+    }
+
+    //*************************************************************************
+    /// Copies the values that are in this set, 'other' or both to d_first,
+    /// in order.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator set_union(const iflat_set& other, TOutputIterator d_first) const
+    {
+      return etl::set_union(begin(), end(), other.begin(), other.end(), d_first, compare);
+    }
+
+    //*************************************************************************
+    /// Copies the values that are not in 'other' to d_first, in order.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator set_difference(const iflat_set& other, TOutputIterator d_first) const
+    {
+      return etl::set_difference(begin(), end(), other.begin(), other.end(), d_first, compare);
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -843,7 +922,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign(etl::sorted_unique_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -940,13 +1019,16 @@ namespace etl
         etl::iflat_set<T, TKeyCompare>::iterator first = rhs.begin();
         etl::iflat_set<T, TKeyCompare>::iterator last  = rhs.end();
 
-        // Move all of the elements.
+        // Move all of the elements. They are already in order.
         while (first != last)
         {
           typename etl::iflat_set<T, TKeyCompare>::iterator temp = first;
           ++temp;
 
-          this->insert(etl::move(*first));
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(etl::move(*first));
+          ETL_INCREMENT_DEBUG_COUNT;
+          refset_t::append(*pvalue);
           first = temp;
         }
       }
@@ -965,6 +1047,14 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
 
+    //*************************************************************************
+    /// Destroys and removes the last 'n' values.
+    //*************************************************************************
+    void release_last(size_type n)
+    {
+      erase(etl::prev(cend(), difference_type(n)), cend());
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1035,7 +1125,7 @@ namespace etl
     flat_set(const flat_set& other)
       : etl::iflat_set<T, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign(etl::sorted_unique_t(), other.cbegin(), other.cend());
     }
 
 #if ETL_USING_CPP11
@@ -1065,6 +1155,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and free of
+    /// duplicate values.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->assign(tag, first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1091,7 +1195,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign(etl::sorted_unique_t(), rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -0,0 +1,245 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLETCHER_INCLUDED
+#define ETL_FLETCHER_INCLUDED
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+#include "private/checksum_simd.h"
+
+#include <stdint.h>
+
+///\defgroup fletcher Fletcher checksum calculation
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// Fletcher checksum policy.
+  /// Sums words of TWord, modulo the largest TWord value.
+  /// Words are formed from the bytes in little endian order. A partial word
+  /// at the end is padded with zeros.
+  /// The two sums are held as (s2 << bits) | s1, which is also the checksum.
+  ///\tparam TValue The checksum type, twice the size of TWord.
+  ///\tparam TWord  The word type.
+  //***************************************************************************
+  template <typename TValue, typename TWord>
+  struct fletcher_policy
+  {
+    typedef TValue value_type;
+
+    ETL_STATIC_ASSERT(sizeof(TValue) == (2U * sizeof(TWord)), "The checksum must be twice the size of the word");
+
+    static ETL_CONSTANT size_t     Word_Bits = static_cast<size_t>(etl::integral_limits<TWord>::bits);
+    static ETL_CONSTANT value_type Modulus   = static_cast<value_type>(etl::integral_limits<TWord>::max);
+
+    value_type initial() const
+    {
+      word       = 0U;
+      word_bytes = 0U;
+
+      return 0U;
+    }
+
+    value_type add(value_type sums, uint8_t value) const
+    {
+      word = static_cast<TWord>(word | (static_cast<TWord>(value) << (8U * word_bytes)));
+      ++word_bytes;
+
+      if (word_bytes == sizeof(TWord))
+      {
+        sums       = add_word(sums, word);
+        word       = 0U;
+        word_bytes = 0U;
+      }
+
+      return sums;
+    }
+
+    value_type final(value_type sums) const
+    {
+      return (word_bytes == 0U) ? sums : add_word(sums, word);
+    }
+
+#if ETL_USING_SIMD_CHECKSUM
+    value_type add_range(value_type sums, const uint8_t* begin, const uint8_t* end) const
+    {
+      // Finish any partial word first.
+      while ((word_bytes != 0U) && (begin != end))
+      {
+        sums = add(sums, *begin);
+        ++begin;
+      }
+
+      uint64_t s1 = static_cast<uint64_t>(sums & Modulus);
+      uint64_t s2 = static_cast<uint64_t>(sums >> Word_Bits);
+
+      begin = etl::private_checksum_simd::add_words<sizeof(TWord)>(s1, s2, begin, end, Modulus);
+      sums  = static_cast<value_type>((s2 << Word_Bits) | s1);
+
+      while (begin != end)
+      {
+        sums = add(sums, *begin);
+        ++begin;
+      }
+
+      return sums;
+    }
+#endif
+
+    mutable TWord   word;
+    mutable uint8_t word_bytes;
+
+  private:
+
+    //*************************************************************************
+    /// Adds a word to both sums.
+    /// Neither sum can exceed twice the modulus, so one subtraction reduces it.
+    //*************************************************************************
+    static value_type add_word(value_type sums, TWord value)
+    {
+      value_type s1 = static_cast<value_type>((sums & Modulus) + value);
+      value_type s2 = static_cast<value_type>(sums >> Word_Bits);
+
+      s1 = (s1 >= Modulus) ? static_cast<value_type>(s1 - Modulus) : s1;
+      s2 = static_cast<value_type>(s2 + s1);
+      s2 = (s2 >= Modulus) ? static_cast<value_type>(s2 - Modulus) : s2;
+
+      return static_cast<value_type>((s2 << Word_Bits) | s1);
+    }
+  };
+
+  template <typename TValue, typename TWord>
+  ETL_CONSTANT size_t fletcher_policy<TValue, TWord>::Word_Bits;
+
+  template <typename TValue, typename TWord>
+  ETL_CONSTANT typename fletcher_policy<TValue, TWord>::value_type fletcher_policy<TValue, TWord>::Modulus;
+
+  typedef etl::fletcher_policy<uint16_t, uint8_t>  fletcher16_policy;
+  typedef etl::fletcher_policy<uint32_t, uint16_t> fletcher32_policy;
+#if ETL_USING_64BIT_TYPES
+  typedef etl::fletcher_policy<uint64_t, uint32_t> fletcher64_policy;
+#endif
+
+  //*************************************************************************
+  /// Fletcher-16 checksum.
+  /// Sums bytes modulo 255.
+  //*************************************************************************
+  class fletcher16 : public etl::frame_check_sequence<etl::fletcher16_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher16()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    fletcher16(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //*************************************************************************
+  /// Fletcher-32 checksum.
+  /// Sums little endian 16 bit words modulo 65535.
+  //*************************************************************************
+  class fletcher32 : public etl::frame_check_sequence<etl::fletcher32_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    fletcher32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //*************************************************************************
+  /// Fletcher-64 checksum.
+  /// Sums little endian 32 bit words modulo 4294967295.
+  //*************************************************************************
+  class fletcher64 : public etl::frame_check_sequence<etl::fletcher64_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher64()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    fletcher64(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+#endif
+} // namespace etl
+
+#endif
@@ -47,6 +47,8 @@ SOFTWARE.
 #include "type_traits.h"
 #include "utility.h"
 
+#include "private/list_sort.h"
+
 #include <stddef.h>
 
 #include "private/minmax_push.h"
@@ -1227,141 +1229,19 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Stable sort using in-place merge sort algorithm.
-    /// Copyright 2001 Simon Tatham.
-    ///
-    /// Permission is hereby granted, free of charge, to any person
-    /// obtaining a copy of this software and associated documentation
-    /// files (the "Software"), to deal in the Software without
-    /// restriction, including without limitation the rights to use,
-    /// copy, modify, merge, publish, distribute, sublicense, and/or
-    /// sell copies of the Software, and to permit persons to whom the
-    /// Software is furnished to do so, subject to the following
-    /// conditions:
-    ///
-    /// The above copyright notice and this permission notice shall be
-    /// included in all copies or substantial portions of the Software.
-    ///
-    /// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
-    /// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
-    /// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-    /// NONINFRINGEMENT.  IN NO EVENT SHALL SIMON TATHAM BE LIABLE FOR
-    /// ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
-    /// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-    /// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-    /// SOFTWARE.
+    /// Stable sort using an in-place bottom up merge sort.
+    /// Relinks the nodes. Does not move, copy or allocate any values.
+    /// O(N log N).
     //*************************************************************************
     template <typename TCompare>
     void sort(TCompare compare)
     {
-      iterator p_left;
-      iterator p_right;
-      iterator p_node;
-      iterator p_head;
-      iterator p_tail;
-      int      list_size = 1;
-      int      number_of_merges;
-      int      left_size;
-      int      right_size;
-
       if (is_trivial_list())
       {
         return;
       }
 
-      while (true)
-      {
-        p_left = begin();
-        p_head = before_begin();
-        p_tail = before_begin();
-
-        number_of_merges = 0; // Count the number of merges we do in this pass.
-
-        while (p_left != end())
-        {
-          ++number_of_merges; // There exists a merge to be done.
-          p_right   = p_left;
-          left_size = 0;
-
-          // Step 'list_size' places along from left
-          for (int i = 0; i < list_size; ++i)
-          {
-            ++left_size;
-
-            ++p_right;
-
-            if (p_right == end())
-            {
-              break;
-            }
-          }
-
-          // If right hasn't fallen off end, we have two lists to merge.
-          right_size = list_size;
-
-          // Now we have two lists. Merge them.
-          while (left_size > 0 || (right_size > 0 && p_right != end()))
-          {
-            // Decide whether the next node of merge comes from left or right.
-            if (left_size == 0)
-            {
-              // Left is empty. The node must come from right.
-              p_node = p_right;
-              ++p_right;
-              --right_size;
-            }
-            else if (right_size == 0 || p_right == end())
-            {
-              // Right is empty. The node must come from left.
-              p_node = p_left;
-              ++p_left;
-              --left_size;
-            }
-            else if (!compare(*p_right, *p_left))
-            {
-              // First node of left is lower or same. The node must come from
-              // left.
-              p_node = p_left;
-              ++p_left;
-              --left_size;
-            }
-            else
-            {
-              // First node of right is lower. The node must come from right.
-              p_node = p_right;
-              ++p_right;
-              --right_size;
-            }
-
-            // Add the next node to the merged head.
-            if (p_head == before_begin())
-            {
-              join(p_head.p_node, p_node.p_node);
-              p_head = p_node;
-              p_tail = p_node;
-            }
-            else
-            {
-              join(p_tail.p_node, p_node.p_node);
-              p_tail = p_node;
-            }
-
-            p_tail.p_node->next = ETL_NULLPTR;
-          }
-
-          // Now left has stepped `list_size' places along, and right has too.
-          p_left = p_right;
-        }
-
-        // If we have done only one merge, we're finished.
-        if (number_of_merges <= 1) // Allow for number_of_merges == 0, the empty head case
-        {
-          return;
-        }
-
-        // Otherwise repeat, merging lists twice the size
-        list_size *= 2;
-      }
+      start_node.next = private_list_sort::sort(start_node.next, static_cast<node_t*>(ETL_NULLPTR), &node_t::next, node_compare<TCompare>(compare));
     }
 
     //*************************************************************************
@@ -1560,6 +1440,25 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Compares the values of two nodes, for sort.
+    //*************************************************************************
+    template <typename TCompare>
+    struct node_compare
+    {
+      explicit node_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const node_t& lhs, const node_t& rhs)
+      {
+        return compare(data_cast(lhs).value, data_cast(rhs).value);
+      }
+
+      TCompare compare;
+    };
+
     //*************************************************************************
     /// Downcast a node_t* to a data_node_t*
     //*************************************************************************
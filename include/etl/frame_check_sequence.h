@@ -86,6 +86,33 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Detects whether a policy can add a block of bytes
+    /// with a member add_range(value, begin, end), rather
+    /// than one at a time.
+    //***************************************************
+    template <typename TPolicy>
+    struct has_add_range
+    {
+    private:
+
+      typedef char yes;
+      struct no
+      {
+        char dummy[2];
+      };
+
+      template <typename U>
+      static yes test(char (*)[sizeof(&U::add_range)]);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static const bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
   } // namespace private_frame_check_sequence
 
   //***************************************************************************
@@ -146,6 +173,20 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
+#if ETL_NOT_USING_CPP14 || ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      // Blocks of bytes may be added by the policy, but not in a constant expression.
+      typedef etl::integral_constant<bool, private_frame_check_sequence::has_add_range<TPolicy>::value && etl::is_pointer<TIterator>::value> use_add_range;
+
+      if ETL_IF_CONSTEXPR (use_add_range::value)
+      {
+        if (!etl::is_constant_evaluated())
+        {
+          add_range(begin, end, use_add_range());
+          return;
+        }
+      }
+#endif
+
       while (begin != end)
       {
         frame_check = policy.add(frame_check, static_cast<uint8_t>(*begin));
@@ -187,6 +228,23 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of bytes using the policy.
+    //*************************************************************************
+    template <typename TPointer>
+    void add_range(TPointer begin, TPointer end, etl::true_type)
+    {
+      frame_check = policy.add_range(frame_check, reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+    }
+
+    //*************************************************************************
+    /// Never called. The policy cannot add a range of bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator, TIterator, etl::false_type)
+    {
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -37,6 +37,9 @@ SOFTWARE.
 
   // The default hash calculation.
   #include "fnv_1.h"
+  #if defined(ETL_HASH_USE_WYHASH)
+    #include "wyhash.h"
+  #endif
   #include "math.h"
   #include "static_assert.h"
   #include "type_traits.h"
@@ -45,6 +48,10 @@ SOFTWARE.
   #include <stdlib.h>
 
   ///\defgroup hash Standard hash calculations
+  /// Define ETL_HASH_USE_WYHASH to hash strings and other byte ranges with
+  /// etl::wyhash instead of FNV-1a.
+  /// Define ETL_HASH_USE_INTEGRAL_MIXER to hash integral and enum types with
+  /// a single multiply, instead of returning the value unchanged.
   ///\ingroup maths
 
   #include "private/diagnostic_useless_cast_push.h"
@@ -60,7 +67,12 @@ namespace etl
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+  #if defined(ETL_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+      uint64_t h64 = wyhash(begin, end).value();
+      uint32_t h   = static_cast<uint32_t>(h64 ^ (h64 >> 32U));
+  #else
       uint32_t h = fnv_1a_32(begin, end);
+  #endif
 
       return static_cast<size_t>(h ^ (h >> 16U));
     }
@@ -72,7 +84,13 @@ namespace etl
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+  #if defined(ETL_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+      uint64_t h = wyhash(begin, end).value();
+
+      return static_cast<size_t>(h ^ (h >> 32U));
+  #else
       return fnv_1a_32(begin, end);
+  #endif
     }
 
   #if ETL_USING_64BIT_TYPES
@@ -83,10 +101,39 @@ namespace etl
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+    #if defined(ETL_HASH_USE_WYHASH)
+      return static_cast<size_t>(wyhash(begin, end).value());
+    #else
       return fnv_1a_64(begin, end);
+    #endif
     }
   #endif
 
+    //*************************************************************************
+    /// Mixes an integral value with a single multiply by the golden ratio.
+    /// The high half of the product is folded into the low half, so that
+    /// every bit of the value affects the low bits of the hash.
+    //*************************************************************************
+    template <typename T>
+    size_t mix_integral(T v)
+    {
+  #if ETL_USING_64BIT_TYPES
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      const uint64_t golden_ratio = 0x9E3779B97F4A7C15ULL;
+      const uint64_t x            = static_cast<uint64_t>(static_cast<unsigned_t>(v)) * golden_ratio;
+
+      return static_cast<size_t>(x ^ (x >> 32U));
+  #else
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      const uint32_t golden_ratio = 0x9E3779B9UL;
+      const uint32_t x            = static_cast<uint32_t>(static_cast<unsigned_t>(v)) * golden_ratio;
+
+      return static_cast<size_t>(x ^ (x >> 16U));
+  #endif
+    }
+
     //*************************************************************************
     /// Primary definition of base hash class, by default is poisoned
     //*************************************************************************
@@ -153,7 +200,11 @@ namespace etl
 
     size_t operator()(char v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       return static_cast<size_t>(v);
+  #endif
     }
   };
 
@@ -168,7 +219,11 @@ namespace etl
 
     size_t operator()(signed char v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       return static_cast<size_t>(v);
+  #endif
     }
   };
 
@@ -183,7 +238,11 @@ namespace etl
 
     size_t operator()(unsigned char v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       return static_cast<size_t>(v);
+  #endif
     }
   };
 
@@ -196,6 +255,9 @@ namespace etl
   {
     size_t operator()(wchar_t v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -206,6 +268,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -218,6 +281,9 @@ namespace etl
   {
     size_t operator()(short v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -228,6 +294,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -240,6 +307,9 @@ namespace etl
   {
     size_t operator()(unsigned short v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -250,6 +320,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -262,6 +333,9 @@ namespace etl
   {
     size_t operator()(int v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -272,6 +346,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -284,6 +359,9 @@ namespace etl
   {
     size_t operator()(unsigned int v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -294,6 +372,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -306,6 +385,9 @@ namespace etl
   {
     size_t operator()(long v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -316,6 +398,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -328,6 +411,9 @@ namespace etl
   {
     size_t operator()(long long v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -338,6 +424,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -350,6 +437,9 @@ namespace etl
   {
     size_t operator()(unsigned long v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -360,6 +450,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -372,6 +463,9 @@ namespace etl
   {
     size_t operator()(unsigned long long v) const
     {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+      return private_hash::mix_integral(v);
+  #else
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR (sizeof(size_t) >= sizeof(v))
       {
@@ -382,6 +476,7 @@ namespace etl
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
         return private_hash::generic_hash<size_t>(p, p + sizeof(v));
       }
+  #endif
     }
   };
 
@@ -527,6 +622,9 @@ namespace etl
     {
       size_t operator()(T v) const
       {
+  #if defined(ETL_HASH_USE_INTEGRAL_MIXER)
+        return private_hash::mix_integral(static_cast<unsigned long long>(v));
+  #else
         if (sizeof(size_t) >= sizeof(T))
         {
           return static_cast<size_t>(v);
@@ -535,6 +633,7 @@ namespace etl
         {
           return ::etl::hash<unsigned long long>()(static_cast<unsigned long long>(v));
         }
+  #endif
       }
     };
   } // namespace private_hash
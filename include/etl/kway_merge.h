@@ -0,0 +1,459 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_KWAY_MERGE_INCLUDED
+#define ETL_KWAY_MERGE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "functional.h"
+#include "iterator.h"
+#include "smallest.h"
+#include "span.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup kway_merge kway_merge
+/// Merges up to a compile time number of sorted runs into one sorted
+/// sequence, with a tournament (loser) tree.
+/// The tree holds the run that lost the match at each node, so replacing the
+/// smallest element replays one path from a leaf to the root. Each merged
+/// element costs about log2(k) comparisons for k runs.
+/// The elements are read from the runs in place. Nothing is buffered.
+/// The merge is stable. Equivalent elements are taken from the run that was
+/// added first.
+///\ingroup algorithm
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the kway_merger.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merger_exception : public etl::exception
+  {
+  public:
+
+    kway_merger_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the kway_merger.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merger_full : public etl::kway_merger_exception
+  {
+  public:
+
+    kway_merger_full(string_type file_name_, numeric_type line_number_)
+      : etl::kway_merger_exception(ETL_ERROR_TEXT("kway_merger:full", ETL_KWAY_MERGE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the kway_merger.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merger_empty : public etl::kway_merger_exception
+  {
+  public:
+
+    kway_merger_empty(string_type file_name_, numeric_type line_number_)
+      : etl::kway_merger_exception(ETL_ERROR_TEXT("kway_merger:empty", ETL_KWAY_MERGE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Merges sorted runs of elements, held as iterator ranges.
+  /// Runs may be added at any time, for example as new data arrives. Runs
+  /// are removed as soon as they are used up, so only runs with elements
+  /// left are in the loser tree and each match is a single comparison.
+  ///\tparam TIterator The iterator type of the runs.
+  ///\tparam MAX_RUNS_ The maximum number of runs that are being merged at once.
+  ///\tparam TCompare  The comparison for the elements.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <typename TIterator, size_t MAX_RUNS_, typename TCompare = etl::less<typename etl::iterator_traits<TIterator>::value_type> >
+  class kway_merger
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_RUNS_ > 0U, "Zero runs kway_merger is not valid");
+
+    static ETL_CONSTANT size_t MAX_RUNS = MAX_RUNS_;
+
+    typedef TIterator                                                 iterator;
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+    typedef typename etl::iterator_traits<TIterator>::reference       reference;
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+    typedef TCompare                                                  value_compare;
+    typedef size_t                                                    size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    kway_merger()
+      : compare()
+      , n_runs(0U)
+    {
+      tree[0] = 0U;
+    }
+
+    //*************************************************************************
+    /// Constructor, with a comparison object.
+    //*************************************************************************
+    explicit kway_merger(const TCompare& compare_)
+      : compare(compare_)
+      , n_runs(0U)
+    {
+      tree[0] = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a sorted run to the merge.
+    /// The run is merged with the elements that remain in the other runs.
+    /// If the merger is full then an etl::kway_merger_full is emitted and
+    /// the run is not added.
+    /// Empty runs are ignored.
+    //*************************************************************************
+    void add_run(TIterator first, TIterator last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      ETL_ASSERT_OR_RETURN(n_runs != MAX_RUNS, ETL_ERROR(kway_merger_full));
+
+      runs[n_runs].first  = first;
+      runs[n_runs].second = last;
+      ++n_runs;
+
+      rebuild();
+    }
+
+    //*************************************************************************
+    /// Adds a sorted run to the merge.
+    //*************************************************************************
+    void add_run(const ETL_OR_STD::pair<TIterator, TIterator>& run)
+    {
+      add_run(run.first, run.second);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no elements left to merge.
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_runs == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of runs that still have elements to merge.
+    //*************************************************************************
+    size_type size() const
+    {
+      return n_runs;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if no more runs can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return n_runs == MAX_RUNS;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of runs.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return MAX_RUNS;
+    }
+
+    //*************************************************************************
+    /// Returns the smallest element that remains.
+    //*************************************************************************
+    reference front() const
+    {
+      ETL_ASSERT_CHECK_EXTRA(!empty(), ETL_ERROR(kway_merger_empty));
+
+      return *runs[tree[0]].first;
+    }
+
+    //*************************************************************************
+    /// Moves past the smallest element that remains.
+    //*************************************************************************
+    void pop()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(kway_merger_empty));
+
+      next();
+    }
+
+    //*************************************************************************
+    /// Copies all of the remaining elements, in order, to d_first.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge(TOutputIterator d_first)
+    {
+      while (!empty())
+      {
+        *d_first = *runs[tree[0]].first;
+        ++d_first;
+        next();
+      }
+
+      return d_first;
+    }
+
+    //*************************************************************************
+    /// Copies up to 'n' of the remaining elements, in order, to d_first.
+    ///\return The end of the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge(TOutputIterator d_first, size_type n)
+    {
+      while ((n != 0U) && !empty())
+      {
+        *d_first = *runs[tree[0]].first;
+        ++d_first;
+        next();
+        --n;
+      }
+
+      return d_first;
+    }
+
+    //*************************************************************************
+    /// Removes all of the runs.
+    //*************************************************************************
+    void clear()
+    {
+      n_runs  = 0U;
+      tree[0] = 0U;
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<MAX_RUNS>::type index_type;
+
+    //*************************************************************************
+    /// Moves past the smallest element and finds the next.
+    //*************************************************************************
+    void next()
+    {
+      size_type winner = tree[0];
+
+      ++runs[winner].first;
+
+      if (runs[winner].first == runs[winner].second)
+      {
+        // This happens once per run, so the tree is simply rebuilt without it.
+        remove_used_runs();
+        rebuild();
+        return;
+      }
+
+      // Replay the matches from the winner's leaf to the root.
+      // The result of each match is unpredictable, so the swap is written
+      // as selects rather than as a branch.
+      for (size_type node = (n_runs + winner) / 2U; node != 0U; node /= 2U)
+      {
+        const size_type challenger = tree[node];
+        const bool      swap       = is_before(challenger, winner);
+
+        tree[node] = static_cast<index_type>(swap ? winner : challenger);
+        winner     = swap ? challenger : winner;
+      }
+
+      tree[0] = static_cast<index_type>(winner);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the next element of run 'a' is merged before
+    /// that of run 'b'. Both runs must have elements left. Equivalent
+    /// elements are taken from the run with the lower index.
+    //*************************************************************************
+    bool is_before(size_type a, size_type b) const
+    {
+      // Compare the lower index run against the higher, so that equivalent
+      // elements are taken from the lower.
+      const bool      a_is_lower = (a < b);
+      const size_type lower      = a_is_lower ? a : b;
+      const size_type higher     = a_is_lower ? b : a;
+
+      return !compare(*runs[higher].first, *runs[lower].first) == a_is_lower;
+    }
+
+    //*************************************************************************
+    /// Plays all of the matches again.
+    //*************************************************************************
+    void rebuild()
+    {
+      tree[0] = static_cast<index_type>((n_runs == 0U) ? 0U : build(1U));
+    }
+
+    //*************************************************************************
+    /// Plays the matches below a node.
+    /// Internal nodes are 1 to n_runs - 1. The leaf of run 'i' is n_runs + i.
+    ///\return The winner.
+    //*************************************************************************
+    size_type build(size_type node)
+    {
+      // n_runs is never more than MAX_RUNS. Testing both lets the compiler see
+      // that 'tree' is not written past its end.
+      if ((node >= n_runs) || (node >= MAX_RUNS))
+      {
+        return node - n_runs;
+      }
+
+      const size_type left  = build(2U * node);
+      const size_type right = build((2U * node) + 1U);
+
+      if (is_before(right, left))
+      {
+        tree[node] = static_cast<index_type>(left);
+        return right;
+      }
+      else
+      {
+        tree[node] = static_cast<index_type>(right);
+        return left;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the runs with no elements left, keeping the order of the others.
+    //*************************************************************************
+    void remove_used_runs()
+    {
+      size_type n = 0U;
+
+      for (size_type i = 0U; i < n_runs; ++i)
+      {
+        if (runs[i].first != runs[i].second)
+        {
+          runs[n] = runs[i];
+          ++n;
+        }
+      }
+
+      n_runs = n;
+    }
+
+    TCompare                                compare;
+    ETL_OR_STD::pair<TIterator, TIterator> runs[MAX_RUNS];
+    index_type                              tree[MAX_RUNS]; ///< The winner at 0 and the losers at 1 to n_runs - 1.
+    size_type                               n_runs;
+  };
+
+  template <typename TIterator, size_t MAX_RUNS_, typename TCompare>
+  ETL_CONSTANT size_t kway_merger<TIterator, MAX_RUNS_, TCompare>::MAX_RUNS;
+
+  //***************************************************************************
+  /// merge_k
+  /// Merges up to MAX_RANGES sorted ranges into one sorted range.
+  /// The ranges are given as a sequence of pairs of iterators.
+  /// Each element of the output costs about log2(k) comparisons for k ranges.
+  /// The merge is stable. Equivalent elements are taken from the earlier range.
+  /// If there are more than MAX_RANGES ranges then an etl::kway_merger_full
+  /// is emitted.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <size_t MAX_RANGES, typename TRangeIterator, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge_k(TRangeIterator ranges_first, TRangeIterator ranges_last, TOutputIterator d_first, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TRangeIterator>::value_type range_type;
+    typedef typename range_type::first_type                           iterator;
+
+    etl::kway_merger<iterator, MAX_RANGES, TCompare> merger(compare);
+
+    while (ranges_first != ranges_last)
+    {
+      merger.add_run(ranges_first->first, ranges_first->second);
+      ++ranges_first;
+    }
+
+    return merger.merge(d_first);
+  }
+
+  //***************************************************************************
+  /// merge_k
+  /// Uses operator< for comparison.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <size_t MAX_RANGES, typename TRangeIterator, typename TOutputIterator>
+  TOutputIterator merge_k(TRangeIterator ranges_first, TRangeIterator ranges_last, TOutputIterator d_first)
+  {
+    typedef typename etl::iterator_traits<TRangeIterator>::value_type range_type;
+    typedef typename range_type::first_type                           iterator;
+    typedef typename etl::iterator_traits<iterator>::value_type       value_type;
+
+    return etl::merge_k<MAX_RANGES>(ranges_first, ranges_last, d_first, etl::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// merge_k
+  /// Merges the sorted ranges in a span of pairs of iterators.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <size_t MAX_RANGES, typename TRange, size_t Extent, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge_k(etl::span<TRange, Extent> ranges, TOutputIterator d_first, TCompare compare)
+  {
+    return etl::merge_k<MAX_RANGES>(ranges.begin(), ranges.end(), d_first, compare);
+  }
+
+  //***************************************************************************
+  /// merge_k
+  /// Merges the sorted ranges in a span of pairs of iterators.
+  /// Uses operator< for comparison.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <size_t MAX_RANGES, typename TRange, size_t Extent, typename TOutputIterator>
+  TOutputIterator merge_k(etl::span<TRange, Extent> ranges, TOutputIterator d_first)
+  {
+    return etl::merge_k<MAX_RANGES>(ranges.begin(), ranges.end(), d_first);
+  }
+} // namespace etl
+
+#endif
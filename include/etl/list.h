@@ -47,6 +47,8 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 
+#include "private/list_sort.h"
+
 #include <stddef.h>
 
 #include "private/minmax_push.h"
@@ -1648,137 +1650,19 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Stable sort using in-place merge sort algorithm.
-    /// Copyright 2001 Simon Tatham.
-    ///
-    /// Permission is hereby granted, free of charge, to any person
-    /// obtaining a copy of this software and associated documentation
-    /// files (the "Software"), to deal in the Software without
-    /// restriction, including without limitation the rights to use,
-    /// copy, modify, merge, publish, distribute, sublicense, and/or
-    /// sell copies of the Software, and to permit persons to whom the
-    /// Software is furnished to do so, subject to the following
-    /// conditions:
-    ///
-    /// The above copyright notice and this permission notice shall be
-    /// included in all copies or substantial portions of the Software.
-    ///
-    /// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
-    /// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
-    /// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-    /// NONINFRINGEMENT.  IN NO EVENT SHALL SIMON TATHAM BE LIABLE FOR
-    /// ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
-    /// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-    /// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-    /// SOFTWARE.
+    /// Stable sort using an in-place bottom up merge sort.
+    /// Relinks the nodes. Does not move, copy or allocate any values.
+    /// O(N log N).
     //*************************************************************************
     template <typename TCompare>
     void sort(TCompare compare)
     {
-      iterator i_left;
-      iterator i_right;
-      iterator i_node;
-      iterator i_head;
-      iterator i_tail;
-      int      list_size = 1;
-      int      number_of_merges;
-      int      left_size;
-      int      right_size;
-
       if (is_trivial_list())
       {
         return;
       }
 
-      while (true)
-      {
-        i_left = begin();
-        i_head = end();
-        i_tail = end();
-
-        number_of_merges = 0; // Count the number of merges we do in this pass.
-
-        while (i_left != end())
-        {
-          ++number_of_merges; // There exists a merge to be done.
-          i_right   = i_left;
-          left_size = 0;
-
-          // Step 'list_size' places along from left
-          for (int i = 0; i < list_size; ++i)
-          {
-            ++left_size;
-            ++i_right;
-
-            if (i_right == end())
-            {
-              break;
-            }
-          }
-
-          // If right hasn't fallen off end, we have two lists to merge.
-          right_size = list_size;
-
-          // Now we have two lists. Merge them.
-          while (left_size > 0 || (right_size > 0 && i_right != end()))
-          {
-            // Decide whether the next node of merge comes from left or right.
-            if (left_size == 0)
-            {
-              // Left is empty. The node must come from right.
-              i_node = i_right++;
-              --right_size;
-            }
-            else if (right_size == 0 || i_right == end())
-            {
-              // Right is empty. The node must come from left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else if (!compare(*i_right, *i_left))
-            {
-              // First node of left is lower or same. The node must come from
-              // left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else
-            {
-              // First node of right is lower. The node must come from right.
-              i_node = i_right;
-              ++i_right;
-              --right_size;
-            }
-
-            // Add the next node to the merged head.
-            if (i_head == end())
-            {
-              join(*i_head.p_node, *i_node.p_node);
-              i_head = i_node;
-              i_tail = i_node;
-            }
-            else
-            {
-              join(*i_tail.p_node, *i_node.p_node);
-              i_tail = i_node;
-            }
-
-            join(*i_tail.p_node, terminal_node);
-          }
-
-          // Now left has stepped `list_size' places along, and right has too.
-          i_left = i_right;
-        }
-
-        // If we have done only one merge, we're finished.
-        if (number_of_merges <= 1) // Allow for number_of_merges == 0, the empty head case
-        {
-          return;
-        }
-
-        // Otherwise repeat, merging lists twice the size
-        list_size *= 2;
-      }
+      private_list_sort::sort(terminal_node, &node_t::next, &node_t::previous, node_compare<TCompare>(compare));
     }
 
     //*************************************************************************
@@ -1916,6 +1800,25 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Compares the values of two nodes, for sort.
+    //*************************************************************************
+    template <typename TCompare>
+    struct node_compare
+    {
+      explicit node_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const node_t& lhs, const node_t& rhs)
+      {
+        return compare(data_cast(lhs).value, data_cast(rhs).value);
+      }
+
+      TCompare compare;
+    };
+
     //*************************************************************************
     /// Moves an element from one position to another within the list.
     /// Moves the element at position 'from' to the position before 'to'.
@@ -542,6 +542,79 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Flattens the tree rooted at the node into an ordered list, linked
+    /// through the right children, and prepends it to the list provided.
+    //*************************************************************************
+    static Node* tree_to_list(Node* node, Node* list)
+    {
+      while (node)
+      {
+        node->children[kRight] = tree_to_list(node->children[kRight], list);
+        list                   = node;
+
+        Node* left            = node->children[kLeft];
+        node->children[kLeft] = ETL_NULLPTR;
+        node                  = left;
+      }
+
+      return list;
+    }
+
+    //*************************************************************************
+    /// Builds a perfectly balanced tree from the next 'count' nodes of an
+    /// ordered list linked through the right children.
+    /// The list is advanced past the nodes used.
+    //*************************************************************************
+    static Node* list_to_tree(size_type count, Node*& list)
+    {
+      if (count == 0U)
+      {
+        return ETL_NULLPTR;
+      }
+
+      // The left side takes any odd node, so is never the lighter side.
+      const size_type left_count  = count / 2U;
+      const size_type right_count = count - left_count - 1U;
+
+      Node* left = list_to_tree(left_count, list);
+      Node* node = list;
+      list       = list->children[kRight];
+
+      node->children[kLeft]  = left;
+      node->children[kRight] = list_to_tree(right_count, list);
+      node->dir              = uint_least8_t(kNeither);
+      node->weight           = (balanced_height(left_count) > balanced_height(right_count)) ? uint_least8_t(kLeft) : uint_least8_t(kNeither);
+
+      if (node->children[kLeft])
+      {
+        node->children[kLeft]->parent = node;
+      }
+
+      if (node->children[kRight])
+      {
+        node->children[kRight]->parent = node;
+      }
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// The height of a perfectly balanced tree of 'count' nodes.
+    //*************************************************************************
+    static size_type balanced_height(size_type count)
+    {
+      size_type height = 0U;
+
+      while (count != 0U)
+      {
+        ++height;
+        count >>= 1U;
+      }
+
+      return height;
+    }
+
     //*************************************************************************
     /// Find the node whose key would go before all the other keys from the
     /// position provided
@@ -1086,6 +1159,21 @@ namespace etl
       insert(first, last);
     }
 
+    //*********************************************************************
+    /// Assigns values to the multimap from a range that is already sorted.
+    /// The tree is built directly from the range in linear time.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap does not
+    /// have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      initialise();
+      insert_sorted(first, last);
+    }
+
     //*************************************************************************
     /// Clears the multimap.
     //*************************************************************************
@@ -1368,6 +1456,60 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a sorted range of values to the multimap.
+    /// The range is merged with the existing elements and the tree rebuilt
+    /// perfectly balanced, in O(size() + distance(first, last)) time.
+    /// New values are placed after any existing equivalent elements.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap does not
+    /// have enough free space. Values up to that point are inserted.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      Node  head;
+      Node* tail = &head;
+      Node* list = tree_to_list(root_node, ETL_NULLPTR);
+
+      while (first != last)
+      {
+        const_reference value = *first;
+
+        // Take the existing elements that do not go after the value.
+        while ((list != ETL_NULLPTR) && !node_comp(value.first, data_cast(*list)))
+        {
+          tail->children[kRight] = list;
+          tail                   = list;
+          list                   = list->children[kRight];
+        }
+
+        if (full())
+        {
+          break;
+        }
+
+        Data_Node& node = allocate_data_node(value);
+        ++current_size;
+
+        tail->children[kRight] = &node;
+        tail                   = &node;
+        ++first;
+      }
+
+      tail->children[kRight] = list;
+      list                   = head.children[kRight];
+      root_node              = list_to_tree(current_size, list);
+
+      if (root_node != ETL_NULLPTR)
+      {
+        root_node->parent = ETL_NULLPTR;
+      }
+
+      ETL_ASSERT(first == last, ETL_ERROR(multimap_full));
+    }
+
     //*********************************************************************
     /// Returns an iterator pointing to the first element in the container
     /// whose key is not considered to go before the key provided or end()
@@ -1535,12 +1677,18 @@ namespace etl
     //*************************************************************************
     void initialise()
     {
-      const_iterator item = begin();
+      // Tear down through the ordered list, without rebalancing.
+      Node* list = tree_to_list(root_node, ETL_NULLPTR);
 
-      while (item != end())
+      while (list != ETL_NULLPTR)
       {
-        item = erase(item);
+        Node* next = list->children[kRight];
+        destroy_data_node(data_cast(*list));
+        list = next;
       }
+
+      root_node    = ETL_NULLPTR;
+      current_size = 0U;
     }
 
   private:
@@ -2384,6 +2532,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is sorted.
+    /// The tree is built directly from the range in linear time.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    multimap(etl::sorted_equivalent_t, TIterator first, TIterator last)
+      : etl::imultimap<TKey, TValue, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->insert_sorted(first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Constructor, from an initializer_list.
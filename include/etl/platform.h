@@ -489,6 +489,14 @@ SOFTWARE.
   #define ETL_ASSUME ETL_DO_NOTHING
 #endif
 
+//*************************************
+// Prefetch the cache line at an address, for reading.
+#if ETL_USING_GCC_COMPILER || ETL_USING_CLANG_COMPILER
+  #define ETL_PREFETCH(address) __builtin_prefetch(address)
+#else
+  #define ETL_PREFETCH(address) ((void)(address))
+#endif
+
 //*************************************
 // Determine if the ETL can use char8_t type.
 #if ETL_NO_SMALL_CHAR_SUPPORT
@@ -629,6 +637,10 @@ typedef uint_least32_t char32_t;
 // Check for availability of certain builtins
 #include "profiles/determine_builtin_support.h"
 
+//*************************************
+// Check for availability of SIMD instruction sets
+#include "profiles/determine_simd_support.h"
+
 //*************************************
 // Sort out namespaces for STL/No STL options.
 #include "private/choose_namespace.h"
@@ -0,0 +1,925 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALGORITHM_SIMD_INCLUDED
+#define ETL_ALGORITHM_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../integral_limits.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_SIMD_ALGORITHMS
+
+  #if ETL_USING_AVX2
+    #include <immintrin.h>
+  #elif ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+
+//*****************************************************************************
+// SIMD versions of find, count, min_element, max_element, minmax_element,
+// equal and the unique set_intersection, for pointers to arithmetic values.
+// The vector width is 32 bytes for AVX2, and 16 bytes for SSE2 and NEON.
+// The algorithms in algorithm.h select these at compile time, and only when
+// they are not being evaluated in a constant expression.
+//*****************************************************************************
+// Floating point values are compared exactly, as the scalar algorithms do.
+  #include "diagnostic_float_equal_push.h"
+
+namespace etl
+{
+  namespace private_algorithm_simd
+  {
+    //*************************************************************************
+    /// Identifies how the lanes for a type are compared.
+    /// Integral lanes are compared bitwise. Floating point lanes use the
+    /// floating point rules, so that 0.0 == -0.0 and NaN != NaN.
+    //*************************************************************************
+    template <size_t Size, bool Is_Floating_Point>
+    struct lane_tag
+    {
+    };
+
+    template <typename T>
+    struct lane
+    {
+      typedef lane_tag<sizeof(T), etl::is_floating_point<T>::value> tag;
+
+      static ETL_CONSTANT bool Is_Integral = etl::is_integral<T>::value && ((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U));
+
+      static ETL_CONSTANT bool Is_Floating_Point = (etl::is_same<T, float>::value && (sizeof(float) == 4U)) ||
+                                                   (etl::is_same<T, double>::value && (sizeof(double) == 8U));
+
+      static ETL_CONSTANT bool Is_Supported = Is_Integral || Is_Floating_Point;
+    };
+
+    //*************************************************************************
+    /// The position of the lowest set bit of a non-zero mask.
+    //*************************************************************************
+    inline size_t lowest_bit(uint64_t mask)
+    {
+      return etl::count_trailing_zeros(mask);
+    }
+
+    //*************************************************************************
+    /// The position of the highest set bit of a non-zero mask.
+    //*************************************************************************
+    inline size_t highest_bit(uint64_t mask)
+    {
+      return (etl::integral_limits<uint64_t>::bits - 1U) - etl::count_leading_zeros(mask);
+    }
+
+  #if ETL_USING_AVX2
+    //*************************************************************************
+    /// AVX2 vector of 32 bytes.
+    /// The mask has one bit per byte.
+    //*************************************************************************
+    struct avx2_vector
+    {
+      typedef __m256i  type;
+      typedef uint32_t mask_type;
+
+      static ETL_CONSTANT size_t Size               = 32U;
+      static ETL_CONSTANT size_t Mask_Bits_Per_Byte = 1U;
+
+      static type load(const void* p)
+      {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+      }
+
+      static void store(void* p, type v)
+      {
+        _mm256_storeu_si256(static_cast<__m256i*>(p), v);
+      }
+
+      static type zero()
+      {
+        return _mm256_setzero_si256();
+      }
+
+      static mask_type mask(type m)
+      {
+        return static_cast<mask_type>(_mm256_movemask_epi8(m));
+      }
+
+      static mask_type full_mask()
+      {
+        return 0xFFFFFFFFUL;
+      }
+
+      static type bitwise_xor(type a, type b)
+      {
+        return _mm256_xor_si256(a, b);
+      }
+
+      /// Each byte of 'm' is all ones or all zeros.
+      static type select(type m, type a, type b)
+      {
+        return _mm256_blendv_epi8(b, a, m);
+      }
+
+      // Every byte of a matching lane is all ones, so subtracting counts
+      // each match once in every byte of its lane.
+      static type add_count(type counts, type m)
+      {
+        return _mm256_sub_epi8(counts, m);
+      }
+
+      static uint64_t sum_counts(type counts)
+      {
+        const __m256i sums   = _mm256_sad_epu8(counts, zero());
+        const __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+
+        return static_cast<uint64_t>(_mm_cvtsi128_si32(halves)) + static_cast<uint64_t>(_mm_cvtsi128_si32(_mm_srli_si128(halves, 8)));
+      }
+
+      static type splat(int8_t value, lane_tag<1, false>) { return _mm256_set1_epi8(value); }
+      static type splat(int16_t value, lane_tag<2, false>) { return _mm256_set1_epi16(value); }
+      static type splat(int32_t value, lane_tag<4, false>) { return _mm256_set1_epi32(value); }
+      static type splat(int64_t value, lane_tag<8, false>) { return _mm256_set1_epi64x(value); }
+      static type splat(float value, lane_tag<4, true>) { return _mm256_castps_si256(_mm256_set1_ps(value)); }
+      static type splat(double value, lane_tag<8, true>) { return _mm256_castpd_si256(_mm256_set1_pd(value)); }
+
+      static type equal(type a, type b, lane_tag<1, false>) { return _mm256_cmpeq_epi8(a, b); }
+      static type equal(type a, type b, lane_tag<2, false>) { return _mm256_cmpeq_epi16(a, b); }
+      static type equal(type a, type b, lane_tag<4, false>) { return _mm256_cmpeq_epi32(a, b); }
+      static type equal(type a, type b, lane_tag<8, false>) { return _mm256_cmpeq_epi64(a, b); }
+
+      static type equal(type a, type b, lane_tag<4, true>)
+      {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+      }
+
+      static type equal(type a, type b, lane_tag<8, true>)
+      {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+      }
+
+      static type greater_signed(type a, type b, lane_tag<1, false>) { return _mm256_cmpgt_epi8(a, b); }
+      static type greater_signed(type a, type b, lane_tag<2, false>) { return _mm256_cmpgt_epi16(a, b); }
+      static type greater_signed(type a, type b, lane_tag<4, false>) { return _mm256_cmpgt_epi32(a, b); }
+    };
+
+    typedef avx2_vector vector;
+  #elif ETL_USING_SSE2
+    //*************************************************************************
+    /// SSE2 vector of 16 bytes.
+    /// The mask has one bit per byte.
+    //*************************************************************************
+    struct sse2_vector
+    {
+      typedef __m128i  type;
+      typedef uint32_t mask_type;
+
+      static ETL_CONSTANT size_t Size               = 16U;
+      static ETL_CONSTANT size_t Mask_Bits_Per_Byte = 1U;
+
+      static type load(const void* p)
+      {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+      }
+
+      static void store(void* p, type v)
+      {
+        _mm_storeu_si128(static_cast<__m128i*>(p), v);
+      }
+
+      static type zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static mask_type mask(type m)
+      {
+        return static_cast<mask_type>(_mm_movemask_epi8(m));
+      }
+
+      static mask_type full_mask()
+      {
+        return 0xFFFFU;
+      }
+
+      static type bitwise_xor(type a, type b)
+      {
+        return _mm_xor_si128(a, b);
+      }
+
+      /// Each byte of 'm' is all ones or all zeros.
+      static type select(type m, type a, type b)
+      {
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+      }
+
+      // Every byte of a matching lane is all ones, so subtracting counts
+      // each match once in every byte of its lane.
+      static type add_count(type counts, type m)
+      {
+        return _mm_sub_epi8(counts, m);
+      }
+
+      static uint64_t sum_counts(type counts)
+      {
+        const __m128i sums = _mm_sad_epu8(counts, zero());
+
+        return static_cast<uint64_t>(_mm_cvtsi128_si32(sums)) + static_cast<uint64_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+      }
+
+      static type splat(int8_t value, lane_tag<1, false>) { return _mm_set1_epi8(value); }
+      static type splat(int16_t value, lane_tag<2, false>) { return _mm_set1_epi16(value); }
+      static type splat(int32_t value, lane_tag<4, false>) { return _mm_set1_epi32(value); }
+      static type splat(float value, lane_tag<4, true>) { return _mm_castps_si128(_mm_set1_ps(value)); }
+      static type splat(double value, lane_tag<8, true>) { return _mm_castpd_si128(_mm_set1_pd(value)); }
+
+      static type splat(int64_t value, lane_tag<8, false>)
+      {
+        const int32_t low  = static_cast<int32_t>(static_cast<uint64_t>(value) & 0xFFFFFFFFUL);
+        const int32_t high = static_cast<int32_t>(static_cast<uint64_t>(value) >> 32U);
+
+        return _mm_set_epi32(high, low, high, low);
+      }
+
+      static type equal(type a, type b, lane_tag<1, false>) { return _mm_cmpeq_epi8(a, b); }
+      static type equal(type a, type b, lane_tag<2, false>) { return _mm_cmpeq_epi16(a, b); }
+      static type equal(type a, type b, lane_tag<4, false>) { return _mm_cmpeq_epi32(a, b); }
+      static type equal(type a, type b, lane_tag<4, true>) { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+      static type equal(type a, type b, lane_tag<8, true>) { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))); }
+
+      /// SSE2 has no 64 bit compare. Both halves must be equal.
+      static type equal(type a, type b, lane_tag<8, false>)
+      {
+        const __m128i halves = _mm_cmpeq_epi32(a, b);
+
+        return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+      }
+
+      static type greater_signed(type a, type b, lane_tag<1, false>) { return _mm_cmpgt_epi8(a, b); }
+      static type greater_signed(type a, type b, lane_tag<2, false>) { return _mm_cmpgt_epi16(a, b); }
+      static type greater_signed(type a, type b, lane_tag<4, false>) { return _mm_cmpgt_epi32(a, b); }
+    };
+
+    typedef sse2_vector vector;
+  #elif ETL_USING_NEON
+    //*************************************************************************
+    /// AArch64 NEON vector of 16 bytes.
+    /// NEON has no movemask, so the mask has four bits per byte.
+    //*************************************************************************
+    struct neon_vector
+    {
+      typedef uint8x16_t type;
+      typedef uint64_t   mask_type;
+
+      static ETL_CONSTANT size_t Size               = 16U;
+      static ETL_CONSTANT size_t Mask_Bits_Per_Byte = 4U;
+
+      static type load(const void* p)
+      {
+        return vld1q_u8(static_cast<const uint8_t*>(p));
+      }
+
+      static void store(void* p, type v)
+      {
+        vst1q_u8(static_cast<uint8_t*>(p), v);
+      }
+
+      static type zero()
+      {
+        return vdupq_n_u8(0U);
+      }
+
+      static mask_type mask(type m)
+      {
+        const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+      }
+
+      static mask_type full_mask()
+      {
+        return 0xFFFFFFFFFFFFFFFFULL;
+      }
+
+      static type bitwise_xor(type a, type b)
+      {
+        return veorq_u8(a, b);
+      }
+
+      /// Each byte of 'm' is all ones or all zeros.
+      static type select(type m, type a, type b)
+      {
+        return vbslq_u8(m, a, b);
+      }
+
+      // Every byte of a matching lane is all ones, so subtracting counts
+      // each match once in every byte of its lane.
+      static type add_count(type counts, type m)
+      {
+        return vsubq_u8(counts, m);
+      }
+
+      static uint64_t sum_counts(type counts)
+      {
+        return static_cast<uint64_t>(vaddlvq_u8(counts));
+      }
+
+      static type splat(int8_t value, lane_tag<1, false>) { return vreinterpretq_u8_s8(vdupq_n_s8(value)); }
+      static type splat(int16_t value, lane_tag<2, false>) { return vreinterpretq_u8_s16(vdupq_n_s16(value)); }
+      static type splat(int32_t value, lane_tag<4, false>) { return vreinterpretq_u8_s32(vdupq_n_s32(value)); }
+      static type splat(int64_t value, lane_tag<8, false>) { return vreinterpretq_u8_s64(vdupq_n_s64(value)); }
+      static type splat(float value, lane_tag<4, true>) { return vreinterpretq_u8_f32(vdupq_n_f32(value)); }
+      static type splat(double value, lane_tag<8, true>) { return vreinterpretq_u8_f64(vdupq_n_f64(value)); }
+
+      static type equal(type a, type b, lane_tag<1, false>) { return vceqq_u8(a, b); }
+      static type equal(type a, type b, lane_tag<2, false>) { return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+      static type equal(type a, type b, lane_tag<4, false>) { return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+      static type equal(type a, type b, lane_tag<8, false>) { return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b))); }
+      static type equal(type a, type b, lane_tag<4, true>) { return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b))); }
+      static type equal(type a, type b, lane_tag<8, true>) { return vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(a), vreinterpretq_f64_u8(b))); }
+
+      static type greater_signed(type a, type b, lane_tag<1, false>) { return vcgtq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b)); }
+      static type greater_signed(type a, type b, lane_tag<2, false>) { return vreinterpretq_u8_u16(vcgtq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b))); }
+      static type greater_signed(type a, type b, lane_tag<4, false>) { return vreinterpretq_u8_u32(vcgtq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b))); }
+    };
+
+    typedef neon_vector vector;
+  #endif
+
+    //*************************************************************************
+    /// The type used to splat a value of T.
+    /// Integral values are splatted as the signed integral type of the same
+    /// size.
+    //*************************************************************************
+    template <typename T, bool Is_Floating_Point = etl::is_floating_point<T>::value>
+    struct splat_type
+    {
+      typedef T type;
+    };
+
+    template <typename T>
+    struct splat_type<T, false>
+    {
+      typedef typename etl::conditional<sizeof(T) == 1U, int8_t,
+                typename etl::conditional<sizeof(T) == 2U, int16_t,
+                  typename etl::conditional<sizeof(T) == 4U, int32_t, int64_t>::type>::type>::type type;
+    };
+
+    template <typename T>
+    typename vector::type splat(T value)
+    {
+      return vector::splat(static_cast<typename splat_type<T>::type>(value), typename lane<T>::tag());
+    }
+
+    //*************************************************************************
+    /// The element type of a pointer iterator, or not_an_element.
+    //*************************************************************************
+    struct not_an_element
+    {
+    };
+
+    template <typename TIterator>
+    struct element
+    {
+      typedef not_an_element type;
+    };
+
+    template <typename T>
+    struct element<T*>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+
+    //*************************************************************************
+    /// find and count for pointers to integral values, with integral values
+    /// to find, or pointers to floating point values with the same type.
+    //*************************************************************************
+    template <typename TIterator, typename TValue>
+    struct is_find_vectorisable
+    {
+      typedef typename element<TIterator>::type element_type;
+      typedef typename etl::remove_cv<TValue>::type value_type;
+
+      static ETL_CONSTANT bool value = lane<element_type>::Is_Supported && (lane<element_type>::Is_Integral ? etl::is_integral<value_type>::value
+                                                                                                            : etl::is_same<element_type, value_type>::value);
+    };
+
+    //*************************************************************************
+    /// equal for pointers to the same integral type.
+    /// Equal integral values have equal bytes.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_equal_vectorisable
+    {
+      typedef typename element<TIterator1>::type element_type;
+
+      static ETL_CONSTANT bool value = lane<element_type>::Is_Integral && etl::is_same<element_type, typename element<TIterator2>::type>::value;
+    };
+
+    //*************************************************************************
+    /// min_element, max_element and minmax_element for pointers to 8, 16 or
+    /// 32 bit integral values.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_minmax_vectorisable
+    {
+      typedef typename element<TIterator>::type element_type;
+
+      static ETL_CONSTANT bool value = lane<element_type>::Is_Integral && (sizeof(element_type) <= 4U);
+    };
+
+    //*************************************************************************
+    /// set_intersection of unique ranges for pointers to the same 32 bit
+    /// integral type.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_intersect_vectorisable
+    {
+      typedef typename element<TIterator1>::type element_type;
+
+      static ETL_CONSTANT bool value = lane<element_type>::Is_Integral && (sizeof(element_type) == 4U) &&
+                                       etl::is_same<element_type, typename element<TIterator2>::type>::value;
+    };
+
+    //*************************************************************************
+    /// Finds the first element equal to the value.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first(const T* first, const T* last, T value)
+    {
+      const size_t               Lanes  = vector::Size / sizeof(T);
+      const typename vector::type target = splat(value);
+
+      // Two vectors at a time.
+      while (size_t(last - first) >= (2U * Lanes))
+      {
+        const typename vector::mask_type mask0 = vector::mask(vector::equal(vector::load(first), target, typename lane<T>::tag()));
+        const typename vector::mask_type mask1 = vector::mask(vector::equal(vector::load(first + Lanes), target, typename lane<T>::tag()));
+
+        if ((mask0 | mask1) != 0U)
+        {
+          return (mask0 != 0U) ? first + (lowest_bit(mask0) / (vector::Mask_Bits_Per_Byte * sizeof(T)))
+                               : first + Lanes + (lowest_bit(mask1) / (vector::Mask_Bits_Per_Byte * sizeof(T)));
+        }
+
+        first += 2U * Lanes;
+      }
+
+      while ((first != last) && !(*first == value))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last element equal to the value, or 'last' if there is none.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last(const T* first, const T* last, T value)
+    {
+      const size_t               Lanes  = vector::Size / sizeof(T);
+      const typename vector::type target = splat(value);
+      const T*                   end    = last;
+
+      while (size_t(last - first) >= Lanes)
+      {
+        last -= Lanes;
+
+        const typename vector::mask_type mask = vector::mask(vector::equal(vector::load(last), target, typename lane<T>::tag()));
+
+        if (mask != 0U)
+        {
+          return last + (highest_bit(mask) / (vector::Mask_Bits_Per_Byte * sizeof(T)));
+        }
+      }
+
+      while (first != last)
+      {
+        --last;
+
+        if (*last == value)
+        {
+          return last;
+        }
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Counts the elements equal to the value.
+    //*************************************************************************
+    template <typename T>
+    size_t count(const T* first, const T* last, T value)
+    {
+      const size_t               Lanes  = vector::Size / sizeof(T);
+      const typename vector::type target = splat(value);
+
+      uint64_t matched_bytes = 0U;
+
+      // Blocks of at most 255 vectors, so that the byte counters cannot overflow.
+      while (size_t(last - first) >= Lanes)
+      {
+        size_t rounds = size_t(last - first) / Lanes;
+        rounds        = (rounds > 255U) ? 255U : rounds;
+
+        typename vector::type counts = vector::zero();
+
+        for (size_t i = 0U; i < rounds; ++i)
+        {
+          counts = vector::add_count(counts, vector::equal(vector::load(first), target, typename lane<T>::tag()));
+          first += Lanes;
+        }
+
+        matched_bytes += vector::sum_counts(counts);
+      }
+
+      size_t n = static_cast<size_t>(matched_bytes / sizeof(T));
+
+      while (first != last)
+      {
+        if (*first == value)
+        {
+          ++n;
+        }
+
+        ++first;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The index of the first element that differs, or 'size'.
+    /// Compares the bytes.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch(const T* first1, const T* first2, size_t size)
+    {
+      const uint8_t* p1    = reinterpret_cast<const uint8_t*>(first1);
+      const uint8_t* p2    = reinterpret_cast<const uint8_t*>(first2);
+      const size_t   bytes = size * sizeof(T);
+      size_t         i     = 0U;
+
+      while ((bytes - i) >= vector::Size)
+      {
+        const typename vector::mask_type mask = vector::mask(vector::equal(vector::load(p1 + i), vector::load(p2 + i), lane_tag<1, false>()));
+
+        if (mask != vector::full_mask())
+        {
+          return (i + (lowest_bit(~mask & vector::full_mask()) / vector::Mask_Bits_Per_Byte)) / sizeof(T);
+        }
+
+        i += vector::Size;
+      }
+
+      // The vectors are a multiple of the element size.
+      for (i /= sizeof(T); i < size; ++i)
+      {
+        if (!(first1[i] == first2[i]))
+        {
+          return i;
+        }
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Finds the smallest and largest values in a non-empty range.
+    /// Unsigned values are compared as signed, with the top bit flipped.
+    //*************************************************************************
+    template <typename T>
+    void min_max_values(const T* first, const T* last, T& minimum, T& maximum)
+    {
+      typedef typename lane<T>::tag tag;
+
+      const size_t Lanes = vector::Size / sizeof(T);
+
+      minimum = *first;
+      maximum = *first;
+
+      if (size_t(last - first) >= Lanes)
+      {
+        typedef typename splat_type<T>::type signed_type;
+
+        // The top bit of each lane.
+        const typename vector::type bias = etl::is_signed<T>::value ? vector::zero()
+                                                                    : vector::splat(static_cast<signed_type>(etl::integral_limits<signed_type>::min), tag());
+
+        typename vector::type vmin = vector::bitwise_xor(vector::load(first), bias);
+        typename vector::type vmax = vmin;
+
+        first += Lanes;
+
+        while (size_t(last - first) >= Lanes)
+        {
+          const typename vector::type v = vector::bitwise_xor(vector::load(first), bias);
+
+          vmin = vector::select(vector::greater_signed(vmin, v, tag()), v, vmin);
+          vmax = vector::select(vector::greater_signed(v, vmax, tag()), v, vmax);
+
+          first += Lanes;
+        }
+
+        T lanes_min[Lanes];
+        T lanes_max[Lanes];
+
+        vector::store(lanes_min, vector::bitwise_xor(vmin, bias));
+        vector::store(lanes_max, vector::bitwise_xor(vmax, bias));
+
+        minimum = lanes_min[0];
+        maximum = lanes_max[0];
+
+        for (size_t i = 1U; i < Lanes; ++i)
+        {
+          minimum = (lanes_min[i] < minimum) ? lanes_min[i] : minimum;
+          maximum = (maximum < lanes_max[i]) ? lanes_max[i] : maximum;
+        }
+      }
+
+      while (first != last)
+      {
+        minimum = (*first < minimum) ? *first : minimum;
+        maximum = (maximum < *first) ? *first : maximum;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Intersects two strictly increasing ranges of 32 bit values.
+    /// Each block of four from the first range is compared with the four
+    /// rotations of a block of four from the second. The block with the
+    /// smaller last value is then replaced, or both if they are equal.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    TOutputIterator intersect_unique(const T* first1, const T* last1, const T* first2, const T* last2, TOutputIterator d_first)
+    {
+      while ((size_t(last1 - first1) >= 4U) && (size_t(last2 - first2) >= 4U))
+      {
+  #if ETL_USING_SSE2 || ETL_USING_AVX2
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2));
+
+        const __m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(a, b), _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                           _mm_or_si128(_mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                        _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3)))));
+
+        uint64_t mask = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(match)));
+
+        const size_t Bits_Per_Lane = 1U;
+  #else
+        const uint32x4_t a = vld1q_u32(reinterpret_cast<const uint32_t*>(first1));
+        const uint32x4_t b = vld1q_u32(reinterpret_cast<const uint32_t*>(first2));
+
+        const uint32x4_t match = vorrq_u32(vorrq_u32(vceqq_u32(a, b), vceqq_u32(a, vextq_u32(b, b, 1))),
+                                           vorrq_u32(vceqq_u32(a, vextq_u32(b, b, 2)), vceqq_u32(a, vextq_u32(b, b, 3))));
+
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(match)), 0);
+
+        const size_t Bits_Per_Lane = 16U;
+  #endif
+
+        while (mask != 0U)
+        {
+          const size_t index = lowest_bit(mask) / Bits_Per_Lane;
+
+          *d_first = first1[index];
+          ++d_first;
+          mask &= ~(((uint64_t(1U) << Bits_Per_Lane) - 1U) << (index * Bits_Per_Lane));
+        }
+
+        const T last_value1 = first1[3];
+        const T last_value2 = first2[3];
+
+        first1 += (last_value1 <= last_value2) ? 4 : 0;
+        first2 += (last_value2 <= last_value1) ? 4 : 0;
+      }
+
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (*first1 < *first2)
+        {
+          ++first1;
+        }
+        else
+        {
+          if (!(*first2 < *first1))
+          {
+            *d_first = *first1;
+            ++d_first;
+            ++first1;
+          }
+
+          ++first2;
+        }
+      }
+
+      return d_first;
+    }
+
+    //*************************************************************************
+    // The entry points for the algorithms.
+    // Each dispatches on whether the iterator types can be vectorised. The
+    // overloads for etl::false_type are never called. They keep the calls in
+    // the generic algorithms well formed for all iterator types.
+    //*************************************************************************
+    template <typename T, typename TValue>
+    T* find(T* first, T* last, const TValue& value, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T>::type element_type;
+
+      if (lane<element_type>::Is_Integral && !(static_cast<element_type>(value) == value))
+      {
+        // No element can be equal to the value.
+        return last;
+      }
+
+      return first + (find_first<element_type>(first, last, static_cast<element_type>(value)) - first);
+    }
+
+    template <typename TIterator, typename TValue>
+    TIterator find(TIterator, TIterator last, const TValue&, etl::false_type)
+    {
+      return last;
+    }
+
+    //*************************************************************************
+    template <typename T, typename TValue>
+    ptrdiff_t count(T* first, T* last, const TValue& value, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T>::type element_type;
+
+      if (lane<element_type>::Is_Integral && !(static_cast<element_type>(value) == value))
+      {
+        return 0;
+      }
+
+      return static_cast<ptrdiff_t>(private_algorithm_simd::count<element_type>(first, last, static_cast<element_type>(value)));
+    }
+
+    template <typename TIterator, typename TValue>
+    ptrdiff_t count(TIterator, TIterator, const TValue&, etl::false_type)
+    {
+      return 0;
+    }
+
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool equal(T1* first1, T1* last1, T2* first2, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T1>::type element_type;
+
+      const size_t size = size_t(last1 - first1);
+
+      return private_algorithm_simd::mismatch<element_type>(first1, first2, size) == size;
+    }
+
+    template <typename TIterator1, typename TIterator2>
+    bool equal(TIterator1, TIterator1, TIterator2, etl::false_type)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool equal(T1* first1, T1* last1, T2* first2, T2* last2, etl::true_type)
+    {
+      return ((last1 - first1) == (last2 - first2)) && equal(first1, last1, first2, etl::true_type());
+    }
+
+    template <typename TIterator1, typename TIterator2>
+    bool equal(TIterator1, TIterator1, TIterator2, TIterator2, etl::false_type)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// The index of the first element that differs, or the size of the shorter
+    /// range.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    size_t mismatch(T1* first1, T1* last1, T2* first2, T2* last2, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T1>::type element_type;
+
+      const size_t size1 = size_t(last1 - first1);
+      const size_t size2 = size_t(last2 - first2);
+
+      return private_algorithm_simd::mismatch<element_type>(first1, first2, (size1 < size2) ? size1 : size2);
+    }
+
+    template <typename TIterator1, typename TIterator2>
+    size_t mismatch(TIterator1, TIterator1, TIterator2, TIterator2, etl::false_type)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The first smallest and the last largest elements, as minmax_element.
+    //*************************************************************************
+    template <typename T>
+    void minmax_element(T* first, T* last, T*& minimum, T*& maximum, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T>::type element_type;
+
+      if (first == last)
+      {
+        minimum = first;
+        maximum = first;
+        return;
+      }
+
+      element_type min_value;
+      element_type max_value;
+
+      min_max_values<element_type>(first, last, min_value, max_value);
+
+      minimum = first + (find_first<element_type>(first, last, min_value) - first);
+      maximum = first + (find_last<element_type>(first, last, max_value) - first);
+    }
+
+    template <typename TIterator>
+    void minmax_element(TIterator, TIterator, TIterator&, TIterator&, etl::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// The first smallest or the first largest element.
+    //*************************************************************************
+    template <typename T>
+    T* min_or_max_element(T* first, T* last, bool is_min, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T>::type element_type;
+
+      if (first == last)
+      {
+        return last;
+      }
+
+      element_type min_value;
+      element_type max_value;
+
+      min_max_values<element_type>(first, last, min_value, max_value);
+
+      return first + (find_first<element_type>(first, last, is_min ? min_value : max_value) - first);
+    }
+
+    template <typename TIterator>
+    TIterator min_or_max_element(TIterator, TIterator last, bool, etl::false_type)
+    {
+      return last;
+    }
+    //*************************************************************************
+    template <typename T1, typename T2, typename TOutputIterator>
+    TOutputIterator set_intersection(T1* first1, T1* last1, T2* first2, T2* last2, TOutputIterator d_first, etl::true_type)
+    {
+      typedef typename etl::remove_cv<T1>::type element_type;
+
+      return intersect_unique<element_type>(first1, last1, first2, last2, d_first);
+    }
+
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+    TOutputIterator set_intersection(TIterator1, TIterator1, TIterator2, TIterator2, TOutputIterator d_first, etl::false_type)
+    {
+      return d_first;
+    }
+  } // namespace private_algorithm_simd
+} // namespace etl
+
+  #include "diagnostic_pop.h"
+
+#endif
+#endif
@@ -0,0 +1,103 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BLOOM_FILTER_SIMD_INCLUDED
+#define ETL_BLOOM_FILTER_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_SIMD_BLOOM_FILTER
+  #include <immintrin.h>
+#endif
+
+//*****************************************************************************
+// Batched bit tests for etl::blocked_bloom_filter.
+// The keys are tested eight at a time, one key in each 32 bit lane, with a
+// gather of the word holding the next bit for each key. There is no branch
+// for each key, so a missing bit is not a mispredicted branch.
+// AVX2 only, as SSE2 and NEON have no gather.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_bloom_filter
+  {
+#if ETL_USING_SIMD_BLOOM_FILTER
+    //*************************************************************************
+    /// Tests eight keys.
+    /// The bits follow the same sequence as blocked_bloom_filter::exists_hash.
+    /// As x86 is little endian, bit n of a block is bit (n % 32) of its
+    /// 32 bit word (n / 32).
+    ///\param words      The filter, as 32 bit words.
+    ///\param h          The first bit step for each key.
+    ///\param h2         The second bit step for each key.
+    ///\param offsets    The index of the first 32 bit word of each key's block.
+    ///\param hash_count The number of bits for each key.
+    ///\return A bit mask, with bit n set if key n exists.
+    //*************************************************************************
+    inline uint32_t exists_8(const uint32_t* words, const uint32_t* h, const uint32_t* h2, const uint32_t* offsets, size_t hash_count)
+    {
+      const __m256i one         = _mm256_set1_epi32(1);
+      const __m256i bit_mask    = _mm256_set1_epi32(31);
+      const int*    base        = reinterpret_cast<const int*>(words);
+      __m256i       step        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h));
+      __m256i       step2       = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h2));
+      const __m256i block_start = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets));
+      __m256i       found       = one;
+
+      for (size_t i = 0U; i < hash_count; ++i)
+      {
+        const __m256i bit   = _mm256_srli_epi32(step, 23);
+        const __m256i index = _mm256_add_epi32(block_start, _mm256_srli_epi32(bit, 5));
+
+        // Only gather for the keys that are still found.
+        const __m256i word = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, index, _mm256_cmpeq_epi32(found, one), 4);
+
+        found = _mm256_and_si256(found, _mm256_srlv_epi32(word, _mm256_and_si256(bit, bit_mask)));
+
+        if (_mm256_testz_si256(found, one))
+        {
+          return 0U;
+        }
+
+        step  = _mm256_add_epi32(step, step2);
+        step2 = _mm256_add_epi32(step2, _mm256_set1_epi32(static_cast<int>((static_cast<uint32_t>(i) << 23U) + 0x9E3779B9UL)));
+      }
+
+      return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(found, 31))));
+    }
+#endif
+  } // namespace private_bloom_filter
+} // namespace etl
+
+#endif
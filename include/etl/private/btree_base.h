@@ -0,0 +1,1883 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../iterator.h"
+#include "../memory.h"
+#include "../nullptr.h"
+#include "../placement_new.h"
+#include "../pool.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+/// The size, in bytes, that the B+ tree nodes are designed to fit.
+/// The default is four 64 byte cache lines.
+//*****************************************************************************
+#if !defined(ETL_DEFAULT_BTREE_NODE_SIZE)
+  #define ETL_DEFAULT_BTREE_NODE_SIZE 256
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the B+ tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the B+ tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:full", ETL_BTREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the B+ tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_BTREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The common header of leaf and inner nodes.
+    //*************************************************************************
+    struct node
+    {
+      size_t count; ///< The number of elements in a leaf, or keys in an inner node.
+    };
+
+    //*************************************************************************
+    /// A leaf node.
+    /// The keys are held in their own contiguous array, so that a search
+    /// within the node only touches the keys.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf, size_t Capacity, bool Separate_Keys = !etl::is_same<TKey, TValue>::value>
+    struct leaf_node : public node
+    {
+      leaf_node* prev;
+      leaf_node* next;
+
+      etl::uninitialized_buffer_of<TKey, Capacity>   key_buffer;
+      etl::uninitialized_buffer_of<TValue, Capacity> value_buffer;
+
+      const TKey& key(size_t i) const
+      {
+        return key_buffer.begin()[i];
+      }
+
+      TValue& value(size_t i)
+      {
+        return value_buffer.begin()[i];
+      }
+
+      const TValue& value(size_t i) const
+      {
+        return value_buffer.begin()[i];
+      }
+
+      void create(size_t i, const TValue& v)
+      {
+        ::new (value_buffer.begin() + i) TValue(v);
+        ::new (key_buffer.begin() + i) TKey(TKeyOf()(value(i)));
+      }
+
+#if ETL_USING_CPP11
+      void create(size_t i, TValue&& v)
+      {
+        ::new (value_buffer.begin() + i) TValue(etl::move(v));
+        ::new (key_buffer.begin() + i) TKey(TKeyOf()(value(i)));
+      }
+#endif
+
+      /// Moves element 'j' of 'from' to the unconstructed element 'i'.
+      void relocate(size_t i, leaf_node& from, size_t j)
+      {
+#if ETL_USING_CPP11
+        ::new (value_buffer.begin() + i) TValue(etl::move(from.value(j)));
+        ::new (key_buffer.begin() + i) TKey(etl::move(from.key_buffer.begin()[j]));
+#else
+        ::new (value_buffer.begin() + i) TValue(from.value(j));
+        ::new (key_buffer.begin() + i) TKey(from.key(j));
+#endif
+        from.destroy(j);
+      }
+
+      void destroy(size_t i)
+      {
+        value_buffer.begin()[i].~TValue();
+        key_buffer.begin()[i].~TKey();
+      }
+    };
+
+    //*************************************************************************
+    /// A leaf node, where the values are the keys.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf, size_t Capacity>
+    struct leaf_node<TKey, TValue, TKeyOf, Capacity, false> : public node
+    {
+      leaf_node* prev;
+      leaf_node* next;
+
+      etl::uninitialized_buffer_of<TValue, Capacity> value_buffer;
+
+      const TKey& key(size_t i) const
+      {
+        return value_buffer.begin()[i];
+      }
+
+      TValue& value(size_t i)
+      {
+        return value_buffer.begin()[i];
+      }
+
+      const TValue& value(size_t i) const
+      {
+        return value_buffer.begin()[i];
+      }
+
+      void create(size_t i, const TValue& v)
+      {
+        ::new (value_buffer.begin() + i) TValue(v);
+      }
+
+#if ETL_USING_CPP11
+      void create(size_t i, TValue&& v)
+      {
+        ::new (value_buffer.begin() + i) TValue(etl::move(v));
+      }
+#endif
+
+      /// Moves element 'j' of 'from' to the unconstructed element 'i'.
+      void relocate(size_t i, leaf_node& from, size_t j)
+      {
+#if ETL_USING_CPP11
+        ::new (value_buffer.begin() + i) TValue(etl::move(from.value(j)));
+#else
+        ::new (value_buffer.begin() + i) TValue(from.value(j));
+#endif
+        from.destroy(j);
+      }
+
+      void destroy(size_t i)
+      {
+        value_buffer.begin()[i].~TValue();
+      }
+    };
+
+    //*************************************************************************
+    /// An inner node.
+    /// Child 'i' holds the keys less than key 'i' and not less than key 'i - 1'.
+    //*************************************************************************
+    template <typename TKey, size_t Capacity>
+    struct inner_node : public node
+    {
+      etl::uninitialized_buffer_of<TKey, Capacity> key_buffer;
+      node*                                        children[Capacity + 1U];
+
+      TKey& key(size_t i)
+      {
+        return key_buffer.begin()[i];
+      }
+
+      const TKey& key(size_t i) const
+      {
+        return key_buffer.begin()[i];
+      }
+
+      void create_key(size_t i, const TKey& k)
+      {
+        ::new (key_buffer.begin() + i) TKey(k);
+      }
+
+      /// Moves key 'j' of 'from' to the unconstructed key 'i'.
+      void relocate_key(size_t i, inner_node& from, size_t j)
+      {
+#if ETL_USING_CPP11
+        ::new (key_buffer.begin() + i) TKey(etl::move(from.key(j)));
+#else
+        ::new (key_buffer.begin() + i) TKey(from.key(j));
+#endif
+        from.destroy_key(j);
+      }
+
+      void destroy_key(size_t i)
+      {
+        key_buffer.begin()[i].~TKey();
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of_pair
+    {
+      const TKey& operator()(const TValue& value) const
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      const TKey& operator()(const TKey& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The number of elements or keys that fit in a node of
+    /// ETL_DEFAULT_BTREE_NODE_SIZE bytes.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct node_capacity
+    {
+      static ETL_CONSTANT size_t Element_Size = sizeof(TValue) + (etl::is_same<TKey, TValue>::value ? 0U : sizeof(TKey));
+      static ETL_CONSTANT size_t Leaf_Space   = ETL_DEFAULT_BTREE_NODE_SIZE - sizeof(node) - (2U * sizeof(void*));
+      static ETL_CONSTANT size_t Inner_Space  = ETL_DEFAULT_BTREE_NODE_SIZE - sizeof(node) - sizeof(void*);
+
+      /// At least 4 elements, so that a split leaf holds at least 2.
+      static ETL_CONSTANT size_t Leaf = ((Leaf_Space / Element_Size) < 4U) ? 4U : (Leaf_Space / Element_Size);
+
+      /// At least 5 keys, so that an inner node has at least 3 children.
+      static ETL_CONSTANT size_t Inner = ((Inner_Space / (sizeof(TKey) + sizeof(void*))) < 5U) ? 5U : (Inner_Space / (sizeof(TKey) + sizeof(void*)));
+    };
+
+    //*************************************************************************
+    /// The number of inner nodes needed above a level of N nodes, where each
+    /// inner node, other than the root, has at least Fanout children.
+    //*************************************************************************
+    template <size_t N, size_t Fanout, bool Is_Root = (N <= 1U)>
+    struct inner_node_count
+    {
+      static ETL_CONSTANT size_t Level = (N / Fanout) + 1U;
+      static ETL_CONSTANT size_t value = Level + inner_node_count<Level, Fanout>::value;
+    };
+
+    template <size_t N, size_t Fanout>
+    struct inner_node_count<N, Fanout, true>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+  } // namespace private_btree
+
+  //***************************************************************************
+  /// The base class for the B+ tree containers.
+  /// The elements are held in fixed capacity leaf nodes, which are linked in
+  /// order. Inner nodes hold only keys and child pointers, so that a lookup
+  /// touches one node per level. Every node, other than the root, is kept at
+  /// least half full.
+  /// Keys are copied into the inner nodes, so must be copy constructible.
+  /// Inserting or erasing elements invalidates all iterators.
+  ///\ingroup btree
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+  class ibtree
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TValue            value_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const key_type& const_key_reference;
+
+    static ETL_CONSTANT size_t Leaf_Capacity  = private_btree::node_capacity<TKey, TValue>::Leaf;
+    static ETL_CONSTANT size_t Inner_Capacity = private_btree::node_capacity<TKey, TValue>::Inner;
+
+    /// The node types, for declaring external pools.
+    typedef private_btree::leaf_node<TKey, TValue, TKeyOf, Leaf_Capacity> leaf_type;
+    typedef private_btree::inner_node<TKey, Inner_Capacity>                inner_type;
+
+    //*************************************************************************
+    /// The number of nodes needed in the pools for Max_Size elements.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct pool_size
+    {
+      static ETL_CONSTANT size_t Leaves = (Max_Size / (Leaf_Capacity / 2U)) + 1U;
+      static ETL_CONSTANT size_t Inner_Nodes_Needed = private_btree::inner_node_count<Leaves, ((Inner_Capacity - 1U) / 2U) + 1U>::value;
+      static ETL_CONSTANT size_t Inner_Nodes = (Inner_Nodes_Needed == 0U) ? 1U : Inner_Nodes_Needed;
+    };
+
+  protected:
+
+    typedef private_btree::node node_type;
+
+    static ETL_CONSTANT size_t Min_Leaf_Elements = Leaf_Capacity / 2U;
+    static ETL_CONSTANT size_t Min_Inner_Keys    = (Inner_Capacity - 1U) / 2U;
+
+    //*************************************************************************
+    /// The location of an element.
+    //*************************************************************************
+    struct position
+    {
+      position()
+        : p_leaf(ETL_NULLPTR)
+        , element(0U)
+      {
+      }
+
+      position(leaf_type* p_leaf_, size_t element_)
+        : p_leaf(p_leaf_)
+        , element(element_)
+      {
+      }
+
+      leaf_type* p_leaf;
+      size_t     element;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , element(0U)
+      {
+      }
+
+      iterator(ibtree& tree, position pos)
+        : p_tree(&tree)
+        , p_leaf(pos.p_leaf)
+        , element(pos.element)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , element(other.element)
+      {
+      }
+
+      iterator& operator++()
+      {
+        p_tree->next(p_leaf, element);
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        p_tree->next(p_leaf, element);
+        return temp;
+      }
+
+      iterator& operator--()
+      {
+        p_tree->previous(p_leaf, element);
+        return *this;
+      }
+
+      iterator operator--(int)
+      {
+        iterator temp(*this);
+        p_tree->previous(p_leaf, element);
+        return temp;
+      }
+
+      iterator& operator=(const iterator& other)
+      {
+        p_tree  = other.p_tree;
+        p_leaf  = other.p_leaf;
+        element = other.element;
+        return *this;
+      }
+
+      reference operator*() const
+      {
+        return p_leaf->value(element);
+      }
+
+      pointer operator&() const
+      {
+        return &(p_leaf->value(element));
+      }
+
+      pointer operator->() const
+      {
+        return &(p_leaf->value(element));
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_tree == rhs.p_tree) && (lhs.p_leaf == rhs.p_leaf) && (lhs.element == rhs.element);
+      }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // The tree associated with this iterator.
+      ibtree* p_tree;
+
+      // The leaf and element for this iterator. The leaf is null at the end.
+      leaf_type* p_leaf;
+      size_t     element;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , element(0U)
+      {
+      }
+
+      const_iterator(const ibtree& tree, position pos)
+        : p_tree(&tree)
+        , p_leaf(pos.p_leaf)
+        , element(pos.element)
+      {
+      }
+
+      const_iterator(const typename ibtree::iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , element(other.element)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , element(other.element)
+      {
+      }
+
+      const_iterator& operator++()
+      {
+        p_tree->next(p_leaf, element);
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        p_tree->next(p_leaf, element);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        p_tree->previous(p_leaf, element);
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        p_tree->previous(p_leaf, element);
+        return temp;
+      }
+
+      const_iterator& operator=(const const_iterator& other)
+      {
+        p_tree  = other.p_tree;
+        p_leaf  = other.p_leaf;
+        element = other.element;
+        return *this;
+      }
+
+      const_reference operator*() const
+      {
+        return p_leaf->value(element);
+      }
+
+      const_pointer operator&() const
+      {
+        return &(p_leaf->value(element));
+      }
+
+      const_pointer operator->() const
+      {
+        return &(p_leaf->value(element));
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_tree == rhs.p_tree) && (lhs.p_leaf == rhs.p_leaf) && (lhs.element == rhs.element);
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // The tree associated with this iterator.
+      const ibtree* p_tree;
+
+      // The leaf and element for this iterator. The leaf is null at the end.
+      leaf_type* p_leaf;
+      size_t     element;
+    };
+
+    friend class const_iterator;
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the container.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the container.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the container.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the container.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the container.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the container.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, position());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets the size of the container.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the container.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the container is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the container is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the container.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels in the tree. Zero when empty.
+    //*************************************************************************
+    size_t height() const
+    {
+      return tree_height;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the container.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        destroy_subtree(p_root, tree_height);
+      }
+
+      p_root       = ETL_NULLPTR;
+      p_first      = ETL_NULLPTR;
+      p_last       = ETL_NULLPTR;
+      tree_height  = 0U;
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(const_key_reference key) const
+    {
+      return (find_position(key).p_leaf != ETL_NULLPTR) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find_position(key).p_leaf != ETL_NULLPTR) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, lower_bound_position(key)),
+                                                       iterator(*this, upper_bound_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, lower_bound_position(key)),
+                                                       iterator(*this, upper_bound_position(key)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, lower_bound_position(key)),
+                                                                   const_iterator(*this, upper_bound_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, lower_bound_position(key)),
+                                                                   const_iterator(*this, upper_bound_position(key)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element that followed the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position_)
+    {
+      // The elements move between nodes, so find the next one by key.
+      const key_type key = position_.p_leaf->key(position_.element);
+
+      erase_key(key);
+
+      return iterator(*this, lower_bound_position(key));
+    }
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element that followed the erased one.
+    //*************************************************************************
+    iterator erase(iterator position_)
+    {
+      return erase(const_iterator(position_));
+    }
+
+    //*************************************************************************
+    /// Erases the key specified.
+    //*************************************************************************
+    size_type erase(const_key_reference key)
+    {
+      return erase_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      return erase_key(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      difference_type n = etl::distance(first, last);
+
+      iterator itr(*this, position(first.p_leaf, first.element));
+
+      while (n-- > 0)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return iterator(*this, find_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return iterator(*this, find_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_iterator(*this, find_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_iterator(*this, find_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// is already full and does not contain the key.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      if (full())
+      {
+        // Only an existing key may be 'inserted' when full.
+        const position existing = find_position(TKeyOf()(value));
+        ETL_ASSERT(existing.p_leaf != ETL_NULLPTR, ETL_ERROR(btree_full));
+
+        return ETL_OR_STD::make_pair(iterator(*this, existing), false);
+      }
+
+      bool     inserted;
+      position pos = make_slot(TKeyOf()(value), inserted);
+
+      if (inserted)
+      {
+        pos.p_leaf->create(pos.element, value);
+        ++current_size;
+      }
+
+      return ETL_OR_STD::make_pair(iterator(*this, pos), inserted);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// is already full and does not contain the key.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      if (full())
+      {
+        // Only an existing key may be 'inserted' when full.
+        const position existing = find_position(TKeyOf()(value));
+        ETL_ASSERT(existing.p_leaf != ETL_NULLPTR, ETL_ERROR(btree_full));
+
+        return ETL_OR_STD::make_pair(iterator(*this, existing), false);
+      }
+
+      bool     inserted;
+      position pos = make_slot(TKeyOf()(value), inserted);
+
+      if (inserted)
+      {
+        pos.p_leaf->create(pos.element, etl::move(value));
+        ++current_size;
+      }
+
+      return ETL_OR_STD::make_pair(iterator(*this, pos), inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the container.
+    /// If asserts or exceptions are enabled, emits btree_full if the container
+    /// does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return iterator(*this, lower_bound_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_iterator(*this, lower_bound_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return iterator(*this, upper_bound_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, upper_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_iterator(*this, upper_bound_position(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, upper_bound_position(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return kcompare;
+    }
+
+    //*************************************************************************
+    /// Check if the container contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_position(key).p_leaf != ETL_NULLPTR;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_position(key).p_leaf != ETL_NULLPTR;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : p_root(ETL_NULLPTR)
+      , p_first(ETL_NULLPTR)
+      , p_last(ETL_NULLPTR)
+      , tree_height(0U)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+      , p_leaf_pool(&leaf_pool)
+      , p_inner_pool(&inner_pool)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ibtree() {}
+
+    //*************************************************************************
+    /// Finds the slot for a key, splitting full nodes on the way down.
+    /// If the key is new then a gap is opened for it, which the caller must
+    /// fill, and 'inserted' is set.
+    //*************************************************************************
+    position make_slot(const_key_reference key, bool& inserted)
+    {
+      inserted = false;
+
+      if (p_root == ETL_NULLPTR)
+      {
+        leaf_type* p_leaf = allocate_leaf();
+        p_root            = p_leaf;
+        p_first           = p_leaf;
+        p_last            = p_leaf;
+        tree_height       = 1U;
+      }
+      else if (is_full(p_root, tree_height))
+      {
+        // Grow a new root above the old one.
+        inner_type* p_inner = allocate_inner();
+        p_inner->children[0] = p_root;
+        p_root               = p_inner;
+        ++tree_height;
+
+        split_child(*p_inner, 0U, tree_height - 1U);
+      }
+
+      node_type* p_node = p_root;
+
+      for (size_t level = tree_height; level > 1U; --level)
+      {
+        inner_type& inner = *static_cast<inner_type*>(p_node);
+        size_t      i     = child_index(inner, key);
+
+        if (is_full(inner.children[i], level - 1U))
+        {
+          split_child(inner, i, level - 1U);
+
+          if (!kcompare(key, inner.key(i)))
+          {
+            ++i;
+          }
+        }
+
+        p_node = inner.children[i];
+      }
+
+      leaf_type&   leaf = *static_cast<leaf_type*>(p_node);
+      const size_t i    = leaf_lower_bound(leaf, key);
+
+      if ((i == leaf.count) || kcompare(key, leaf.key(i)))
+      {
+        // Open a gap.
+        for (size_t j = leaf.count; j > i; --j)
+        {
+          leaf.relocate(j, leaf, j - 1U);
+        }
+
+        ++leaf.count;
+        inserted = true;
+      }
+
+      return position(&leaf, i);
+    }
+
+    //*************************************************************************
+    /// Finds the element with the key, or the end.
+    //*************************************************************************
+    template <typename K>
+    position find_position(const K& key) const
+    {
+      leaf_type* p_leaf = find_leaf(key);
+
+      if (p_leaf != ETL_NULLPTR)
+      {
+        const size_t i = leaf_lower_bound(*p_leaf, key);
+
+        if ((i != p_leaf->count) && !kcompare(key, p_leaf->key(i)))
+        {
+          return position(p_leaf, i);
+        }
+      }
+
+      return position();
+    }
+
+    //*************************************************************************
+    /// Finds the first element not less than the key.
+    //*************************************************************************
+    template <typename K>
+    position lower_bound_position(const K& key) const
+    {
+      leaf_type* p_leaf = find_leaf(key);
+
+      if (p_leaf == ETL_NULLPTR)
+      {
+        return position();
+      }
+
+      return normalise(p_leaf, leaf_lower_bound(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// Finds the first element greater than the key.
+    //*************************************************************************
+    template <typename K>
+    position upper_bound_position(const K& key) const
+    {
+      leaf_type* p_leaf = find_leaf(key);
+
+      if (p_leaf == ETL_NULLPTR)
+      {
+        return position();
+      }
+
+      return normalise(p_leaf, leaf_upper_bound(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// Erases the element with the key, merging or rebalancing nodes that
+    /// would become less than half full on the way down.
+    //*************************************************************************
+    template <typename K>
+    size_type erase_key(const K& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return 0U;
+      }
+
+      node_type* p_node = p_root;
+      size_t     level  = tree_height;
+
+      while (level > 1U)
+      {
+        inner_type& inner = *static_cast<inner_type*>(p_node);
+        size_t      i     = child_index(inner, key);
+
+        if (inner.children[i]->count <= min_count(level - 1U))
+        {
+          i = fix_child(inner, i, level - 1U);
+
+          // A root that has lost its last key is replaced by its only child.
+          if ((p_node == p_root) && (inner.count == 0U))
+          {
+            p_root = inner.children[0];
+            release_inner(inner);
+            --tree_height;
+            p_node = p_root;
+            --level;
+            continue;
+          }
+        }
+
+        p_node = inner.children[i];
+        --level;
+      }
+
+      leaf_type&   leaf = *static_cast<leaf_type*>(p_node);
+      const size_t i    = leaf_lower_bound(leaf, key);
+
+      if ((i == leaf.count) || kcompare(key, leaf.key(i)))
+      {
+        return 0U;
+      }
+
+      leaf.destroy(i);
+
+      for (size_t j = i + 1U; j < leaf.count; ++j)
+      {
+        leaf.relocate(j - 1U, leaf, j);
+      }
+
+      --leaf.count;
+      --current_size;
+
+      if (leaf.count == 0U)
+      {
+        // Only the root may become empty.
+        release_leaf(leaf);
+        p_root      = ETL_NULLPTR;
+        p_first     = ETL_NULLPTR;
+        p_last      = ETL_NULLPTR;
+        tree_height = 0U;
+      }
+
+      return 1U;
+    }
+
+    key_compare kcompare;
+
+  private:
+
+    //*************************************************************************
+    /// Moves to the next element.
+    //*************************************************************************
+    void next(leaf_type*& p_leaf, size_t& element) const
+    {
+      if (++element == p_leaf->count)
+      {
+        p_leaf  = p_leaf->next;
+        element = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves to the previous element.
+    //*************************************************************************
+    void previous(leaf_type*& p_leaf, size_t& element) const
+    {
+      if (p_leaf == ETL_NULLPTR)
+      {
+        p_leaf  = p_last;
+        element = p_leaf->count;
+      }
+      else if (element == 0U)
+      {
+        p_leaf  = p_leaf->prev;
+        element = p_leaf->count;
+      }
+
+      --element;
+    }
+
+    //*************************************************************************
+    /// Moves a position past the end of a leaf to the start of the next.
+    //*************************************************************************
+    static position normalise(leaf_type* p_leaf, size_t element)
+    {
+      if (element == p_leaf->count)
+      {
+        return position(p_leaf->next, 0U);
+      }
+
+      return position(p_leaf, element);
+    }
+
+    //*************************************************************************
+    /// Descends to the leaf that would hold the key.
+    //*************************************************************************
+    template <typename K>
+    leaf_type* find_leaf(const K& key) const
+    {
+      node_type* p_node = p_root;
+
+      for (size_t level = tree_height; level > 1U; --level)
+      {
+        const inner_type& inner = *static_cast<const inner_type*>(p_node);
+        p_node                  = inner.children[child_index(inner, key)];
+      }
+
+      return static_cast<leaf_type*>(p_node);
+    }
+
+    //*************************************************************************
+    /// The child of an inner node to follow for a key.
+    /// The number of keys not greater than the key. The scan counts rather
+    /// than branches, so that the compiler may vectorise it.
+    //*************************************************************************
+    template <typename K>
+    size_t child_index(const inner_type& inner, const K& key) const
+    {
+      size_t i = 0U;
+
+      for (size_t j = 0U; j < inner.count; ++j)
+      {
+        i += kcompare(key, inner.key(j)) ? 0U : 1U;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The number of elements in a leaf less than the key.
+    //*************************************************************************
+    template <typename K>
+    size_t leaf_lower_bound(const leaf_type& leaf, const K& key) const
+    {
+      size_t i = 0U;
+
+      for (size_t j = 0U; j < leaf.count; ++j)
+      {
+        i += kcompare(leaf.key(j), key) ? 1U : 0U;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The number of elements in a leaf not greater than the key.
+    //*************************************************************************
+    template <typename K>
+    size_t leaf_upper_bound(const leaf_type& leaf, const K& key) const
+    {
+      size_t i = 0U;
+
+      for (size_t j = 0U; j < leaf.count; ++j)
+      {
+        i += kcompare(key, leaf.key(j)) ? 0U : 1U;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Is the node at the level full?
+    //*************************************************************************
+    static bool is_full(const node_type* p_node, size_t level)
+    {
+      return p_node->count == ((level == 1U) ? Leaf_Capacity : Inner_Capacity);
+    }
+
+    //*************************************************************************
+    /// The minimum count for a node at the level, other than the root.
+    //*************************************************************************
+    static size_t min_count(size_t level)
+    {
+      return (level == 1U) ? Min_Leaf_Elements : Min_Inner_Keys;
+    }
+
+    //*************************************************************************
+    /// Splits the full child 'i' of an inner node in two.
+    //*************************************************************************
+    void split_child(inner_type& parent, size_t i, size_t level)
+    {
+      if (level == 1U)
+      {
+        leaf_type&   left  = *static_cast<leaf_type*>(parent.children[i]);
+        leaf_type&   right = *allocate_leaf();
+        const size_t half  = left.count / 2U;
+
+        for (size_t j = half; j < left.count; ++j)
+        {
+          right.relocate(j - half, left, j);
+        }
+
+        right.count = left.count - half;
+        left.count  = half;
+
+        // Link the new leaf in after the old one.
+        right.prev = &left;
+        right.next = left.next;
+
+        if (left.next != ETL_NULLPTR)
+        {
+          left.next->prev = &right;
+        }
+        else
+        {
+          p_last = &right;
+        }
+
+        left.next = &right;
+
+        insert_child(parent, i, right.key(0U), &right);
+      }
+      else
+      {
+        inner_type&  left  = *static_cast<inner_type*>(parent.children[i]);
+        inner_type&  right = *allocate_inner();
+        const size_t half  = left.count / 2U;
+
+        // The middle key moves up to the parent.
+        for (size_t j = half + 1U; j < left.count; ++j)
+        {
+          right.relocate_key(j - half - 1U, left, j);
+        }
+
+        for (size_t j = half + 1U; j <= left.count; ++j)
+        {
+          right.children[j - half - 1U] = left.children[j];
+        }
+
+        right.count = left.count - half - 1U;
+        left.count  = half;
+
+        insert_child(parent, i, left.key(half), &right);
+        left.destroy_key(half);
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a key and the child to its right at index 'i'.
+    //*************************************************************************
+    static void insert_child(inner_type& parent, size_t i, const key_type& key, node_type* p_child)
+    {
+      for (size_t j = parent.count; j > i; --j)
+      {
+        parent.relocate_key(j, parent, j - 1U);
+        parent.children[j + 1U] = parent.children[j];
+      }
+
+      parent.create_key(i, key);
+      parent.children[i + 1U] = p_child;
+      ++parent.count;
+    }
+
+    //*************************************************************************
+    /// Removes key 'i' and the child to its right.
+    //*************************************************************************
+    static void remove_child(inner_type& parent, size_t i)
+    {
+      parent.destroy_key(i);
+
+      for (size_t j = i + 1U; j < parent.count; ++j)
+      {
+        parent.relocate_key(j - 1U, parent, j);
+        parent.children[j] = parent.children[j + 1U];
+      }
+
+      --parent.count;
+    }
+
+    //*************************************************************************
+    /// Gives child 'i' more than the minimum count, by borrowing from a
+    /// sibling or merging with one.
+    ///\return The index of the child that now covers the original child's keys.
+    //*************************************************************************
+    size_t fix_child(inner_type& parent, size_t i, size_t level)
+    {
+      if ((i > 0U) && (parent.children[i - 1U]->count > min_count(level)))
+      {
+        borrow_from_left(parent, i, level);
+        return i;
+      }
+
+      if ((i < parent.count) && (parent.children[i + 1U]->count > min_count(level)))
+      {
+        borrow_from_right(parent, i, level);
+        return i;
+      }
+
+      if (i < parent.count)
+      {
+        merge_children(parent, i, level);
+        return i;
+      }
+
+      merge_children(parent, i - 1U, level);
+      return i - 1U;
+    }
+
+    //*************************************************************************
+    /// Moves the last element of child 'i - 1' to child 'i'.
+    //*************************************************************************
+    void borrow_from_left(inner_type& parent, size_t i, size_t level)
+    {
+      if (level == 1U)
+      {
+        leaf_type& left  = *static_cast<leaf_type*>(parent.children[i - 1U]);
+        leaf_type& child = *static_cast<leaf_type*>(parent.children[i]);
+
+        for (size_t j = child.count; j > 0U; --j)
+        {
+          child.relocate(j, child, j - 1U);
+        }
+
+        child.relocate(0U, left, left.count - 1U);
+        --left.count;
+        ++child.count;
+
+        parent.key(i - 1U) = child.key(0U);
+      }
+      else
+      {
+        inner_type& left  = *static_cast<inner_type*>(parent.children[i - 1U]);
+        inner_type& child = *static_cast<inner_type*>(parent.children[i]);
+
+        child.children[child.count + 1U] = child.children[child.count];
+
+        for (size_t j = child.count; j > 0U; --j)
+        {
+          child.relocate_key(j, child, j - 1U);
+          child.children[j] = child.children[j - 1U];
+        }
+
+        // Rotate the keys through the parent.
+        child.create_key(0U, parent.key(i - 1U));
+        child.children[0] = left.children[left.count];
+        ++child.count;
+
+        parent.key(i - 1U) = left.key(left.count - 1U);
+        left.destroy_key(left.count - 1U);
+        --left.count;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the first element of child 'i + 1' to child 'i'.
+    //*************************************************************************
+    void borrow_from_right(inner_type& parent, size_t i, size_t level)
+    {
+      if (level == 1U)
+      {
+        leaf_type& child = *static_cast<leaf_type*>(parent.children[i]);
+        leaf_type& right = *static_cast<leaf_type*>(parent.children[i + 1U]);
+
+        child.relocate(child.count, right, 0U);
+        ++child.count;
+
+        for (size_t j = 1U; j < right.count; ++j)
+        {
+          right.relocate(j - 1U, right, j);
+        }
+
+        --right.count;
+
+        parent.key(i) = right.key(0U);
+      }
+      else
+      {
+        inner_type& child = *static_cast<inner_type*>(parent.children[i]);
+        inner_type& right = *static_cast<inner_type*>(parent.children[i + 1U]);
+
+        // Rotate the keys through the parent.
+        child.create_key(child.count, parent.key(i));
+        child.children[child.count + 1U] = right.children[0];
+        ++child.count;
+
+        parent.key(i) = right.key(0U);
+        right.destroy_key(0U);
+
+        for (size_t j = 1U; j < right.count; ++j)
+        {
+          right.relocate_key(j - 1U, right, j);
+          right.children[j - 1U] = right.children[j];
+        }
+
+        right.children[right.count - 1U] = right.children[right.count];
+        --right.count;
+      }
+    }
+
+    //*************************************************************************
+    /// Merges child 'i + 1' into child 'i'.
+    //*************************************************************************
+    void merge_children(inner_type& parent, size_t i, size_t level)
+    {
+      if (level == 1U)
+      {
+        leaf_type& left  = *static_cast<leaf_type*>(parent.children[i]);
+        leaf_type& right = *static_cast<leaf_type*>(parent.children[i + 1U]);
+
+        for (size_t j = 0U; j < right.count; ++j)
+        {
+          left.relocate(left.count + j, right, j);
+        }
+
+        left.count += right.count;
+        left.next = right.next;
+
+        if (right.next != ETL_NULLPTR)
+        {
+          right.next->prev = &left;
+        }
+        else
+        {
+          p_last = &left;
+        }
+
+        release_leaf(right);
+      }
+      else
+      {
+        inner_type& left  = *static_cast<inner_type*>(parent.children[i]);
+        inner_type& right = *static_cast<inner_type*>(parent.children[i + 1U]);
+
+        // The separating key moves down between the two.
+        left.create_key(left.count, parent.key(i));
+
+        for (size_t j = 0U; j < right.count; ++j)
+        {
+          left.relocate_key(left.count + 1U + j, right, j);
+        }
+
+        for (size_t j = 0U; j <= right.count; ++j)
+        {
+          left.children[left.count + 1U + j] = right.children[j];
+        }
+
+        left.count += right.count + 1U;
+
+        release_inner(right);
+      }
+
+      remove_child(parent, i);
+    }
+
+    //*************************************************************************
+    /// Destroys the elements and keys in a subtree and releases its nodes.
+    //*************************************************************************
+    void destroy_subtree(node_type* p_node, size_t level)
+    {
+      if (level == 1U)
+      {
+        leaf_type& leaf = *static_cast<leaf_type*>(p_node);
+
+        for (size_t j = 0U; j < leaf.count; ++j)
+        {
+          leaf.destroy(j);
+        }
+
+        release_leaf(leaf);
+      }
+      else
+      {
+        inner_type& inner = *static_cast<inner_type*>(p_node);
+
+        for (size_t j = 0U; j <= inner.count; ++j)
+        {
+          destroy_subtree(inner.children[j], level - 1U);
+        }
+
+        for (size_t j = 0U; j < inner.count; ++j)
+        {
+          inner.destroy_key(j);
+        }
+
+        release_inner(inner);
+      }
+    }
+
+    //*************************************************************************
+    /// Allocates an empty leaf.
+    //*************************************************************************
+    leaf_type* allocate_leaf()
+    {
+      leaf_type* p_leaf = p_leaf_pool->allocate<leaf_type>();
+      ::new (p_leaf) leaf_type;
+      p_leaf->count = 0U;
+      p_leaf->prev  = ETL_NULLPTR;
+      p_leaf->next  = ETL_NULLPTR;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    /// Allocates an empty inner node.
+    //*************************************************************************
+    inner_type* allocate_inner()
+    {
+      inner_type* p_inner = p_inner_pool->allocate<inner_type>();
+      ::new (p_inner) inner_type;
+      p_inner->count = 0U;
+
+      return p_inner;
+    }
+
+    //*************************************************************************
+    /// Releases a leaf. The elements must already have been destroyed.
+    //*************************************************************************
+    void release_leaf(leaf_type& leaf)
+    {
+      p_leaf_pool->release(&leaf);
+    }
+
+    //*************************************************************************
+    /// Releases an inner node. The keys must already have been destroyed.
+    //*************************************************************************
+    void release_inner(inner_type& inner)
+    {
+      p_inner_pool->release(&inner);
+    }
+
+    // Disable copy construction.
+    ibtree(const ibtree&);
+
+    node_type*      p_root;       ///< The root node. A leaf if the height is 1.
+    leaf_type*      p_first;      ///< The first leaf.
+    leaf_type*      p_last;       ///< The last leaf.
+    size_t          tree_height;  ///< The number of levels.
+    size_type       current_size; ///< The number of the used elements.
+    const size_type CAPACITY;     ///< The maximum number of elements.
+    etl::ipool*     p_leaf_pool;  ///< The pool of leaf nodes.
+    etl::ipool*     p_inner_pool; ///< The pool of inner nodes.
+  };
+
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, TKeyCompare>::Leaf_Capacity;
+
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, TKeyCompare>::Inner_Capacity;
+
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, TKeyCompare>::Min_Leaf_Elements;
+
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, TKeyCompare>::Min_Inner_Keys;
+} // namespace etl
+
+#endif
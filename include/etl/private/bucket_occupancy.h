@@ -0,0 +1,150 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_BUCKET_OCCUPANCY_INCLUDED
+#define ETL_BUCKET_OCCUPANCY_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// A bitset with one bit for each bucket of an unordered container, set
+    /// when the bucket holds at least one node.
+    /// Lets iteration and clear step over empty buckets a word at a time.
+    //*************************************************************************
+    struct bucket_occupancy
+    {
+      typedef size_t element_type;
+
+      static ETL_CONSTANT size_t Bits_Per_Element = etl::integral_limits<element_type>::bits;
+      static ETL_CONSTANT size_t npos             = etl::integral_limits<size_t>::max;
+
+      //*********************************************************************
+      /// The number of elements needed for a number of buckets.
+      //*********************************************************************
+      template <size_t Number_Of_Buckets>
+      struct buffer_size
+      {
+        static ETL_CONSTANT size_t value = (Number_Of_Buckets + Bits_Per_Element - 1U) / Bits_Per_Element;
+      };
+
+      //*********************************************************************
+      /// Marks a bucket as occupied.
+      //*********************************************************************
+      static void set(element_type* pbuffer, size_t index)
+      {
+        pbuffer[index / Bits_Per_Element] |= (element_type(1U) << (index % Bits_Per_Element));
+      }
+
+      //*********************************************************************
+      /// Marks a bucket as empty.
+      //*********************************************************************
+      static void reset(element_type* pbuffer, size_t index)
+      {
+        pbuffer[index / Bits_Per_Element] &= ~(element_type(1U) << (index % Bits_Per_Element));
+      }
+
+      //*********************************************************************
+      /// Marks all buckets as empty.
+      //*********************************************************************
+      static void reset_all(element_type* pbuffer, size_t number_of_buckets)
+      {
+        const size_t number_of_elements = (number_of_buckets + Bits_Per_Element - 1U) / Bits_Per_Element;
+
+        for (size_t i = 0U; i < number_of_elements; ++i)
+        {
+          pbuffer[i] = 0U;
+        }
+      }
+
+      //*********************************************************************
+      /// Finds the first occupied bucket at or after 'index'.
+      ///\return The index of the bucket, or npos if there are none.
+      //*********************************************************************
+      static size_t find_next(const element_type* pbuffer, size_t number_of_buckets, size_t index)
+      {
+        if (index >= number_of_buckets)
+        {
+          return npos;
+        }
+
+        const size_t number_of_elements = (number_of_buckets + Bits_Per_Element - 1U) / Bits_Per_Element;
+
+        size_t       element = index / Bits_Per_Element;
+        element_type bits    = pbuffer[element] & (~element_type(0U) << (index % Bits_Per_Element));
+
+        while (bits == 0U)
+        {
+          if (++element == number_of_elements)
+          {
+            return npos;
+          }
+
+          bits = pbuffer[element];
+        }
+
+        return (element * Bits_Per_Element) + etl::count_trailing_zeros(bits);
+      }
+
+      //*********************************************************************
+      /// Finds the last occupied bucket at or before 'index'.
+      ///\return The index of the bucket, or npos if there are none.
+      //*********************************************************************
+      static size_t find_previous(const element_type* pbuffer, size_t index)
+      {
+        size_t       element = index / Bits_Per_Element;
+        element_type bits    = pbuffer[element] & (~element_type(0U) >> (Bits_Per_Element - 1U - (index % Bits_Per_Element)));
+
+        while (bits == 0U)
+        {
+          if (element == 0U)
+          {
+            return npos;
+          }
+
+          bits = pbuffer[--element];
+        }
+
+        return (element * Bits_Per_Element) + ((Bits_Per_Element - 1U) - etl::count_leading_zeros(bits));
+      }
+    };
+  } // namespace private_unordered
+} // namespace etl
+
+#endif
@@ -0,0 +1,584 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHECKSUM_SIMD_INCLUDED
+#define ETL_CHECKSUM_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_SIMD_CHECKSUM
+
+  #if ETL_USING_AVX2
+    #include <immintrin.h>
+  #elif ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+
+//*****************************************************************************
+// SIMD block sums for the checksum, Adler-32 and Fletcher policies.
+// The vector width is 32 bytes for AVX2, and 16 bytes for SSE2 and NEON.
+//
+// Adler and Fletcher sum the words w[j] into s1, and each new s1 into s2.
+// Over a block of n words that is
+//   s2 += (n * s1) + sum((n - j) * w[j])
+//   s1 += sum(w[j])
+// so each vector only needs a plain and a weighted sum of its words.
+// x86 uses sum of absolute differences for the plain sums and multiply-add
+// for the weighted ones. NEON uses widening pairwise adds and multiplies.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_checksum_simd
+  {
+    //*************************************************************************
+    /// The size of the words summed by a Fletcher checksum.
+    //*************************************************************************
+    template <size_t Word_Size>
+    struct word_tag
+    {
+    };
+
+  #if ETL_USING_AVX2
+    //*************************************************************************
+    /// AVX2 vector of 32 bytes.
+    //*************************************************************************
+    struct avx2_vector
+    {
+      typedef __m256i data_type;
+      typedef __m256i sum_type;
+
+      static ETL_CONSTANT size_t Size = 32U;
+
+      static data_type load(const uint8_t* p)
+      {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+      }
+
+      static sum_type zero()
+      {
+        return _mm256_setzero_si256();
+      }
+
+      static sum_type add(sum_type a, sum_type b)
+      {
+        return _mm256_add_epi64(a, b);
+      }
+
+      /// Adds the words to 64 bit lanes.
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<1U>)
+      {
+        return _mm256_add_epi64(sum, _mm256_sad_epu8(v, _mm256_setzero_si256()));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<2U>)
+      {
+        const __m256i low  = _mm256_sad_epu8(_mm256_and_si256(v, _mm256_set1_epi16(0x00FF)), _mm256_setzero_si256());
+        const __m256i high = _mm256_sad_epu8(_mm256_srli_epi16(v, 8), _mm256_setzero_si256());
+
+        return _mm256_add_epi64(sum, _mm256_add_epi64(low, _mm256_slli_epi64(high, 8)));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<4U>)
+      {
+        sum = _mm256_add_epi64(sum, _mm256_unpacklo_epi32(v, _mm256_setzero_si256()));
+
+        return _mm256_add_epi64(sum, _mm256_unpackhi_epi32(v, _mm256_setzero_si256()));
+      }
+
+      /// Adds the words, weighted from 32 down to 1, to 32 bit lanes.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<1U>)
+      {
+        const __m256i low  = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v));
+        const __m256i high = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(low, _mm256_set_epi16(17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)));
+
+        return _mm256_add_epi32(sum, _mm256_madd_epi16(high, _mm256_set_epi16(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)));
+      }
+
+      /// Adds the words, weighted from 16 down to 1, to 32 bit lanes.
+      /// The high byte of each word is weighted 256 times the low byte.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<2U>)
+      {
+        const __m256i low  = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v));
+        const __m256i high = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(low, _mm256_set_epi16(2304, 9, 2560, 10, 2816, 11, 3072, 12, 3328, 13, 3584, 14, 3840, 15, 4096, 16)));
+
+        return _mm256_add_epi32(sum, _mm256_madd_epi16(high, _mm256_set_epi16(256, 1, 512, 2, 768, 3, 1024, 4, 1280, 5, 1536, 6, 1792, 7, 2048, 8)));
+      }
+
+      /// Adds the words, weighted from 8 down to 1, to 64 bit lanes.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<4U>)
+      {
+        sum = _mm256_add_epi64(sum, _mm256_mul_epu32(v, _mm256_set_epi32(0, 2, 0, 4, 0, 6, 0, 8)));
+
+        return _mm256_add_epi64(sum, _mm256_mul_epu32(_mm256_srli_epi64(v, 32), _mm256_set_epi32(0, 1, 0, 3, 0, 5, 0, 7)));
+      }
+
+      /// The total of the 64 bit lanes.
+      static uint64_t total(sum_type sum)
+      {
+        uint64_t lanes[4];
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sum);
+
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+      }
+
+      /// The total of the unsigned 32 bit lanes.
+      static uint64_t total_weighted(sum_type sum, word_tag<1U>)
+      {
+        return total_32(sum);
+      }
+
+      static uint64_t total_weighted(sum_type sum, word_tag<2U>)
+      {
+        return total_32(sum);
+      }
+
+      static uint64_t total_weighted(sum_type sum, word_tag<4U>)
+      {
+        return total(sum);
+      }
+
+      static data_type bitwise_xor(data_type a, data_type b)
+      {
+        return _mm256_xor_si256(a, b);
+      }
+
+      /// The XOR of all of the bytes.
+      static uint8_t xor_total(data_type v)
+      {
+        __m128i x = _mm_xor_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+        x = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+        x = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+
+        uint32_t result = static_cast<uint32_t>(_mm_cvtsi128_si32(x));
+
+        result ^= (result >> 16U);
+        result ^= (result >> 8U);
+
+        return static_cast<uint8_t>(result);
+      }
+
+    private:
+
+      static uint64_t total_32(sum_type sum)
+      {
+        uint32_t lanes[8];
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sum);
+
+        uint64_t result = 0U;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          result += lanes[i];
+        }
+
+        return result;
+      }
+    };
+
+    typedef avx2_vector vector;
+  #elif ETL_USING_SSE2
+    //*************************************************************************
+    /// SSE2 vector of 16 bytes.
+    //*************************************************************************
+    struct sse2_vector
+    {
+      typedef __m128i data_type;
+      typedef __m128i sum_type;
+
+      static ETL_CONSTANT size_t Size = 16U;
+
+      static data_type load(const uint8_t* p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+
+      static sum_type zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static sum_type add(sum_type a, sum_type b)
+      {
+        return _mm_add_epi64(a, b);
+      }
+
+      /// Adds the words to 64 bit lanes.
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<1U>)
+      {
+        return _mm_add_epi64(sum, _mm_sad_epu8(v, _mm_setzero_si128()));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<2U>)
+      {
+        const __m128i low  = _mm_sad_epu8(_mm_and_si128(v, _mm_set1_epi16(0x00FF)), _mm_setzero_si128());
+        const __m128i high = _mm_sad_epu8(_mm_srli_epi16(v, 8), _mm_setzero_si128());
+
+        return _mm_add_epi64(sum, _mm_add_epi64(low, _mm_slli_epi64(high, 8)));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<4U>)
+      {
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, _mm_setzero_si128()));
+
+        return _mm_add_epi64(sum, _mm_unpackhi_epi32(v, _mm_setzero_si128()));
+      }
+
+      /// Adds the words, weighted from 16 down to 1, to 32 bit lanes.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<1U>)
+      {
+        const __m128i low  = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+        const __m128i high = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(low, _mm_set_epi16(9, 10, 11, 12, 13, 14, 15, 16)));
+
+        return _mm_add_epi32(sum, _mm_madd_epi16(high, _mm_set_epi16(1, 2, 3, 4, 5, 6, 7, 8)));
+      }
+
+      /// Adds the words, weighted from 8 down to 1, to 32 bit lanes.
+      /// The high byte of each word is weighted 256 times the low byte.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<2U>)
+      {
+        const __m128i low  = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+        const __m128i high = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(low, _mm_set_epi16(1280, 5, 1536, 6, 1792, 7, 2048, 8)));
+
+        return _mm_add_epi32(sum, _mm_madd_epi16(high, _mm_set_epi16(256, 1, 512, 2, 768, 3, 1024, 4)));
+      }
+
+      /// Adds the words, weighted from 4 down to 1, to 64 bit lanes.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<4U>)
+      {
+        sum = _mm_add_epi64(sum, _mm_mul_epu32(v, _mm_set_epi32(0, 2, 0, 4)));
+
+        return _mm_add_epi64(sum, _mm_mul_epu32(_mm_srli_epi64(v, 32), _mm_set_epi32(0, 1, 0, 3)));
+      }
+
+      /// The total of the 64 bit lanes.
+      static uint64_t total(sum_type sum)
+      {
+        uint64_t lanes[2];
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+
+        return lanes[0] + lanes[1];
+      }
+
+      /// The total of the unsigned 32 bit lanes.
+      static uint64_t total_weighted(sum_type sum, word_tag<1U>)
+      {
+        return total_32(sum);
+      }
+
+      static uint64_t total_weighted(sum_type sum, word_tag<2U>)
+      {
+        return total_32(sum);
+      }
+
+      static uint64_t total_weighted(sum_type sum, word_tag<4U>)
+      {
+        return total(sum);
+      }
+
+      static data_type bitwise_xor(data_type a, data_type b)
+      {
+        return _mm_xor_si128(a, b);
+      }
+
+      /// The XOR of all of the bytes.
+      static uint8_t xor_total(data_type v)
+      {
+        v = _mm_xor_si128(v, _mm_srli_si128(v, 8));
+        v = _mm_xor_si128(v, _mm_srli_si128(v, 4));
+
+        uint32_t result = static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+
+        result ^= (result >> 16U);
+        result ^= (result >> 8U);
+
+        return static_cast<uint8_t>(result);
+      }
+
+    private:
+
+      static uint64_t total_32(sum_type sum)
+      {
+        uint32_t lanes[4];
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+
+        return static_cast<uint64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+      }
+    };
+
+    typedef sse2_vector vector;
+  #elif ETL_USING_NEON
+    //*************************************************************************
+    /// AArch64 NEON vector of 16 bytes.
+    /// Every sum is widened to 64 bit lanes as it is added.
+    //*************************************************************************
+    struct neon_vector
+    {
+      typedef uint8x16_t data_type;
+      typedef uint64x2_t sum_type;
+
+      static ETL_CONSTANT size_t Size = 16U;
+
+      static data_type load(const uint8_t* p)
+      {
+        return vld1q_u8(p);
+      }
+
+      static sum_type zero()
+      {
+        return vdupq_n_u64(0U);
+      }
+
+      static sum_type add(sum_type a, sum_type b)
+      {
+        return vaddq_u64(a, b);
+      }
+
+      /// Adds the words to 64 bit lanes.
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<1U>)
+      {
+        return vpadalq_u32(sum, vpaddlq_u16(vpaddlq_u8(v)));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<2U>)
+      {
+        return vpadalq_u32(sum, vpaddlq_u16(vreinterpretq_u16_u8(v)));
+      }
+
+      static sum_type add_sum(sum_type sum, data_type v, word_tag<4U>)
+      {
+        return vpadalq_u32(sum, vreinterpretq_u32_u8(v));
+      }
+
+      /// Adds the words, weighted from 16 down to 1.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<1U>)
+      {
+        static const uint8_t weights[16] = {16U, 15U, 14U, 13U, 12U, 11U, 10U, 9U, 8U, 7U, 6U, 5U, 4U, 3U, 2U, 1U};
+
+        const uint8x16_t w = vld1q_u8(weights);
+
+        uint16x8_t products = vmull_u8(vget_low_u8(v), vget_low_u8(w));
+        products            = vmlal_u8(products, vget_high_u8(v), vget_high_u8(w));
+
+        return vpadalq_u32(sum, vpaddlq_u16(products));
+      }
+
+      /// Adds the words, weighted from 8 down to 1.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<2U>)
+      {
+        static const uint16_t weights[8] = {8U, 7U, 6U, 5U, 4U, 3U, 2U, 1U};
+
+        const uint16x8_t w     = vld1q_u16(weights);
+        const uint16x8_t words = vreinterpretq_u16_u8(v);
+
+        uint32x4_t products = vmull_u16(vget_low_u16(words), vget_low_u16(w));
+        products            = vmlal_u16(products, vget_high_u16(words), vget_high_u16(w));
+
+        return vpadalq_u32(sum, products);
+      }
+
+      /// Adds the words, weighted from 4 down to 1.
+      static sum_type add_weighted(sum_type sum, data_type v, word_tag<4U>)
+      {
+        static const uint32_t weights[4] = {4U, 3U, 2U, 1U};
+
+        const uint32x4_t w     = vld1q_u32(weights);
+        const uint32x4_t words = vreinterpretq_u32_u8(v);
+
+        sum = vmlal_u32(sum, vget_low_u32(words), vget_low_u32(w));
+
+        return vmlal_u32(sum, vget_high_u32(words), vget_high_u32(w));
+      }
+
+      /// The total of the 64 bit lanes.
+      static uint64_t total(sum_type sum)
+      {
+        return vaddvq_u64(sum);
+      }
+
+      template <size_t Word_Size>
+      static uint64_t total_weighted(sum_type sum, word_tag<Word_Size>)
+      {
+        return vaddvq_u64(sum);
+      }
+
+      static data_type bitwise_xor(data_type a, data_type b)
+      {
+        return veorq_u8(a, b);
+      }
+
+      /// The XOR of all of the bytes.
+      static uint8_t xor_total(data_type v)
+      {
+        const uint8x8_t x = veor_u8(vget_low_u8(v), vget_high_u8(v));
+
+        uint64_t result = vget_lane_u64(vreinterpret_u64_u8(x), 0);
+
+        result ^= (result >> 32U);
+        result ^= (result >> 16U);
+        result ^= (result >> 8U);
+
+        return static_cast<uint8_t>(result);
+      }
+    };
+
+    typedef neon_vector vector;
+  #endif
+
+    //*************************************************************************
+    /// The most bytes summed before the lanes are totalled.
+    /// Stops the 32 bit weighted lanes from overflowing.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Block_Size = 32768U;
+
+    //*************************************************************************
+    /// Adds the little endian words in whole vectors from the range to the
+    /// Adler or Fletcher sums, modulo 'modulus'.
+    /// Returns the start of the bytes that are left over.
+    //*************************************************************************
+    template <size_t Word_Size>
+    const uint8_t* add_words(uint64_t& sum1, uint64_t& sum2, const uint8_t* begin, const uint8_t* end, uint64_t modulus)
+    {
+      typedef word_tag<Word_Size>  tag;
+      typedef vector::sum_type     sum_type;
+
+      const uint64_t Words_Per_Vector = vector::Size / Word_Size;
+
+      size_t length = static_cast<size_t>(end - begin);
+      length -= length % vector::Size;
+
+      while (length != 0U)
+      {
+        const size_t   block     = (length < Block_Size) ? length : Block_Size;
+        const uint8_t* block_end = begin + block;
+
+        sum_type sum      = vector::zero();
+        sum_type previous = vector::zero();
+        sum_type weighted = vector::zero();
+
+        // Each vector's words are also weighted by the number of vectors after it.
+        while (begin != block_end)
+        {
+          const vector::data_type v = vector::load(begin);
+
+          previous = vector::add(previous, sum);
+          sum      = vector::add_sum(sum, v, tag());
+          weighted = vector::add_weighted(weighted, v, tag());
+
+          begin += vector::Size;
+        }
+
+        const uint64_t words = block / Word_Size;
+
+        sum2 = (sum2 + (words * sum1) + (Words_Per_Vector * vector::total(previous)) + vector::total_weighted(weighted, tag())) % modulus;
+        sum1 = (sum1 + vector::total(sum)) % modulus;
+
+        length -= block;
+      }
+
+      return begin;
+    }
+
+    //*************************************************************************
+    /// The sum of the bytes in the range.
+    //*************************************************************************
+    inline uint64_t sum_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      vector::sum_type sum = vector::zero();
+
+      while (static_cast<size_t>(end - begin) >= vector::Size)
+      {
+        sum = vector::add_sum(sum, vector::load(begin), word_tag<1U>());
+        begin += vector::Size;
+      }
+
+      uint64_t result = vector::total(sum);
+
+      while (begin != end)
+      {
+        result += *begin;
+        ++begin;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The XOR of the bytes in the range.
+    //*************************************************************************
+    inline uint8_t xor_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      uint8_t result = 0U;
+
+      if (static_cast<size_t>(end - begin) >= vector::Size)
+      {
+        vector::data_type x = vector::load(begin);
+        begin += vector::Size;
+
+        while (static_cast<size_t>(end - begin) >= vector::Size)
+        {
+          x = vector::bitwise_xor(x, vector::load(begin));
+          begin += vector::Size;
+        }
+
+        result = vector::xor_total(x);
+      }
+
+      while (begin != end)
+      {
+        result ^= *begin;
+        ++begin;
+      }
+
+      return result;
+    }
+  } // namespace private_checksum_simd
+} // namespace etl
+
+#endif
+#endif
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "stdint.h"
 
 #include "crc_parameters.h"
+#include "crc_simd.h"
 
 #if defined(ETL_COMPILER_KEIL)
   #pragma diag_suppress 1300
@@ -164,6 +165,49 @@ namespace etl
     template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
     ETL_CONSTANT TAccumulator crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC of the byte Index followed by Slice zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous       = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+      static ETL_CONSTANT size_t       Previous_Index = Reflect ? size_t(Previous & 0xFFU) : size_t(Previous >> (Accumulator_Bits - 8U));
+      static ETL_CONSTANT TAccumulator Shifted        = Reflect ? TAccumulator(Previous >> 8U) : TAccumulator(Previous << 8U);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(Shifted ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Previous_Index, 8U>::value);
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT size_t crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous_Index;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Shifted;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::value;
+
+    //*********************************
+    // Slice 0 is the byte table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>::value;
+
     //*****************************************************************************
     /// CRC Update Chunk
     //*****************************************************************************
@@ -248,7 +292,7 @@ namespace etl
     {
       //*************************************************************************
 #if !ETL_USING_CPP11
-      TAccumulator add(TAccumulator crc, uint8_t value) const
+      static TAccumulator add(TAccumulator crc, uint8_t value)
       {
 #endif
         static ETL_CONSTANT TAccumulator table[4U] = {crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
@@ -256,7 +300,7 @@ namespace etl
                                               crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
                                               crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value};
 #if ETL_USING_CPP11
-        ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+        static ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value)
         {
 #endif
           if ETL_IF_CONSTEXPR (Reflect)
@@ -289,7 +333,7 @@ namespace etl
       {
         //*************************************************************************
 #if !ETL_USING_CPP11
-        TAccumulator add(TAccumulator crc, uint8_t value) const
+        static TAccumulator add(TAccumulator crc, uint8_t value)
         {
 #endif
           static
@@ -310,7 +354,7 @@ namespace etl
                                                  crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Chunk_Bits>::value,
                                                  crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Chunk_Bits>::value};
 #if ETL_USING_CPP11
-          ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+          static ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value)
           {
 #endif
             if ETL_IF_CONSTEXPR (Reflect)
@@ -339,7 +383,7 @@ namespace etl
         {
           //*************************************************************************
 #if !ETL_USING_CPP11
-          TAccumulator add(TAccumulator crc, uint8_t value) const
+          static TAccumulator add(TAccumulator crc, uint8_t value)
           {
 #endif
             static
@@ -600,7 +644,7 @@ namespace etl
                                                     crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Chunk_Bits>::value,
                                                     crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Chunk_Bits>::value};
 #if ETL_USING_CPP11
-            ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+            static ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value)
             {
 #endif
 
@@ -613,6 +657,359 @@ namespace etl
           template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
           ETL_CONSTANT TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>::table[256U];
 #endif
+
+          //*****************************************************************************
+          // CRC Slice Tables.
+          // Slicing by 8 or 16 adds 8 or 16 bytes at a time, with one lookup per
+          // byte in the table for its distance from the end of the group.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+          struct crc_slice_table
+          {
+            static const TAccumulator table[256U];
+          };
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+          const TAccumulator crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice>::table[256U] = {
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 17U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 18U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 19U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 20U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 21U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 22U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 23U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 24U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 25U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 26U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 27U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 28U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 29U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 30U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 31U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 32U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 33U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 34U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 35U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 36U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 37U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 38U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 39U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 40U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 41U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 42U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 43U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 44U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 45U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 46U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 47U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 48U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 49U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 50U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 51U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 52U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 53U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 54U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 55U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 56U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 57U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 58U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 59U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 60U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 61U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 62U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 63U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 64U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 65U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 66U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 67U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 68U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 69U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 70U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 71U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 72U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 73U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 74U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 75U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 76U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 77U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 78U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 79U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 80U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 81U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 82U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 83U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 84U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 85U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 86U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 87U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 88U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 89U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 90U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 91U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 92U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 93U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 94U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 95U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 96U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 97U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 98U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 99U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 100U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 101U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 102U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 103U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 104U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 105U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 106U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 107U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 108U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 109U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 110U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 111U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 112U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 113U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 114U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 115U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 116U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 117U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 118U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 119U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 120U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 121U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 122U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 123U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 124U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 125U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 126U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 127U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 129U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 130U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 131U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 132U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 133U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 134U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 135U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 136U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 137U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 138U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 139U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 140U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 141U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 142U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 143U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 144U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 145U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 146U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 147U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 148U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 149U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 150U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 151U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 152U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 153U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 154U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 155U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 156U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 157U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 158U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 159U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 160U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 161U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 162U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 163U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 164U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 165U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 166U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 167U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 168U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 169U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 170U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 171U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 172U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 173U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 174U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 175U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 176U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 177U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 178U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 179U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 180U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 181U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 182U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 183U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 184U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 185U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 186U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 187U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 188U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 189U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 190U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 191U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 192U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 193U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 194U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 195U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 196U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 197U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 198U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 199U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 200U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 201U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 202U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 203U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 204U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 205U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 206U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 207U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 208U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 209U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 210U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 211U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 212U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 213U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 214U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 215U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 216U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 217U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 218U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 219U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 220U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 221U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 222U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 223U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 224U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 225U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 226U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 227U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 228U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 229U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 230U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 231U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 232U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 233U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 234U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 235U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 236U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 237U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 238U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 239U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 240U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 241U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 242U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 243U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 244U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 245U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 246U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 247U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 248U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 249U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 250U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 251U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 252U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 253U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Slice>::value,
+        crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Slice>::value};
+
+          //*********************************
+          // The byte of the CRC that is added to the byte at position Byte in a group.
+          template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Byte>
+          uint8_t crc_slice_byte(TAccumulator crc)
+          {
+            static const bool   In_Crc = (Byte < (Accumulator_Bits / 8U));
+            static const size_t Shift  = In_Crc ? (Reflect ? (Byte * 8U) : (Accumulator_Bits - 8U - (Byte * 8U))) : 0U;
+
+            return In_Crc ? static_cast<uint8_t>(crc >> Shift) : uint8_t(0U);
+          }
+
+          //*********************************
+          // Sums the lookups for the bytes from position Byte to the end of a group.
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices, size_t Byte>
+          struct crc_slice_sum
+          {
+            static TAccumulator value(TAccumulator crc, const uint8_t* p)
+            {
+              const uint8_t index = static_cast<uint8_t>(p[Byte] ^ crc_slice_byte<TAccumulator, Accumulator_Bits, Reflect, Byte>(crc));
+
+              return TAccumulator(crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices - 1U - Byte>::table[index] ^
+                                  crc_slice_sum<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Byte + 1U>::value(crc, p));
+            }
+          };
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          struct crc_slice_sum<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Slices>
+          {
+            static TAccumulator value(TAccumulator, const uint8_t*)
+            {
+              return TAccumulator(0U);
+            }
+          };
+
+          //*********************************
+          // Adds the bytes in groups of Slices, then the rest one at a time.
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          TAccumulator crc_add_slices(TAccumulator crc, const uint8_t* begin, const uint8_t* end)
+          {
+            while (size_t(end - begin) >= Slices)
+            {
+              crc = crc_slice_sum<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, 0U>::value(crc, begin);
+              begin += Slices;
+            }
+
+            while (begin != end)
+            {
+              crc = crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, *begin, crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U>::table);
+              ++begin;
+            }
+
+            return crc;
+          }
+
+          //*********************************
+          // Table size of 2048. Slicing by 8.
+          // Single bytes use the 256 entry table.
+          template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+          struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 2048U>
+            : public crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>
+          {
+            //*************************************************************************
+            TAccumulator add_slices(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+            {
+              return crc_add_slices<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>(crc, begin, end);
+            }
+          };
+
+          //*********************************
+          // Table size of 4096. Slicing by 16.
+          // Single bytes use the 256 entry table.
+          template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+          struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 4096U>
+            : public crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>
+          {
+            //*************************************************************************
+            TAccumulator add_slices(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+            {
+              return crc_add_slices<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>(crc, begin, end);
+            }
+          };
+
           //*****************************************************************************
           // CRC Policies.
           //*****************************************************************************
@@ -640,6 +1037,14 @@ namespace etl
             {
               return crc ^ TCrcParameters::Xor_Out;
             }
+
+#if ETL_USING_SIMD_CRC
+            //*************************************************************************
+            accumulator_type add_range(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+            {
+              return etl::private_crc_simd::add_range<TCrcParameters, crc_policy>(crc, begin, end);
+            }
+#endif
           };
 
           //*********************************
@@ -663,6 +1068,14 @@ namespace etl
             {
               return crc ^ TCrcParameters::Xor_Out;
             }
+
+#if ETL_USING_SIMD_CRC
+            //*************************************************************************
+            accumulator_type add_range(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+            {
+              return etl::private_crc_simd::add_range<TCrcParameters, crc_policy>(crc, begin, end);
+            }
+#endif
           };
 
           //*********************************
@@ -686,7 +1099,174 @@ namespace etl
             {
               return crc ^ TCrcParameters::Xor_Out;
             }
+
+#if ETL_USING_SIMD_CRC
+            //*************************************************************************
+            accumulator_type add_range(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+            {
+              return etl::private_crc_simd::add_range<TCrcParameters, crc_policy>(crc, begin, end);
+            }
+#endif
+          };
+
+          //*********************************
+          // Policy for 2048 entry table, slicing by 8.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 2048U>
+            : public crc_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, 8U, 0xFFU, TCrcParameters::Polynomial,
+                               TCrcParameters::Reflect, 2048U>
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+
+            //*************************************************************************
+            accumulator_type add_range(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+            {
+#if ETL_USING_SIMD_CRC
+              if (etl::private_crc_simd::is_accelerated<TCrcParameters>::value)
+              {
+                return etl::private_crc_simd::add_range<TCrcParameters, crc_policy>(crc, begin, end);
+              }
+#endif
+
+              return this->add_slices(crc, begin, end);
+            }
+          };
+
+          //*********************************
+          // Policy for 4096 entry table, slicing by 16.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 4096U>
+            : public crc_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, 8U, 0xFFU, TCrcParameters::Polynomial,
+                               TCrcParameters::Reflect, 4096U>
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+
+            //*************************************************************************
+            accumulator_type add_range(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+            {
+#if ETL_USING_SIMD_CRC
+              if (etl::private_crc_simd::is_accelerated<TCrcParameters>::value)
+              {
+                return etl::private_crc_simd::add_range<TCrcParameters, crc_policy>(crc, begin, end);
+              }
+#endif
+
+              return this->add_slices(crc, begin, end);
+            }
           };
+
+          //*****************************************************************************
+          // CRC Combination.
+          //*****************************************************************************
+
+          //*********************************
+          // Multiplies two polynomials modulo the CRC polynomial.
+          // Bit i is the coefficient of x^i.
+          template <typename TCrcParameters>
+          ETL_CONSTEXPR14 typename TCrcParameters::accumulator_type crc_multiply(typename TCrcParameters::accumulator_type a,
+                                                                                 typename TCrcParameters::accumulator_type b)
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+            const accumulator_type top    = accumulator_type(accumulator_type(1U) << (TCrcParameters::Accumulator_Bits - 1U));
+            accumulator_type       result = 0U;
+
+            for (size_t i = TCrcParameters::Accumulator_Bits; i != 0U; --i)
+            {
+              const bool carry = (result & top) != 0U;
+
+              result = accumulator_type(result << 1U);
+
+              if (carry)
+              {
+                result = accumulator_type(result ^ TCrcParameters::Polynomial);
+              }
+
+              if (((b >> (i - 1U)) & 1U) != 0U)
+              {
+                result = accumulator_type(result ^ a);
+              }
+            }
+
+            return result;
+          }
+
+          //*********************************
+          // Advances a CRC register past a number of zero bytes, by multiplying
+          // it by x^(8 * length) modulo the CRC polynomial.
+          template <typename TCrcParameters>
+          ETL_CONSTEXPR14 typename TCrcParameters::accumulator_type crc_add_zeros(typename TCrcParameters::accumulator_type crc, size_t length)
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+            if (TCrcParameters::Reflect)
+            {
+              crc = etl::reverse_bits(crc);
+            }
+
+            // x^8
+            accumulator_type power = crc_multiply<TCrcParameters>(accumulator_type(1U << 4U), accumulator_type(1U << 4U));
+
+            while (length != 0U)
+            {
+              if ((length & 1U) != 0U)
+              {
+                crc = crc_multiply<TCrcParameters>(crc, power);
+              }
+
+              power = crc_multiply<TCrcParameters>(power, power);
+              length >>= 1U;
+            }
+
+            if (TCrcParameters::Reflect)
+            {
+              crc = etl::reverse_bits(crc);
+            }
+
+            return crc;
+          }
+
+          //*********************************
+          // The CRC of a block followed by a second block, from their CRCs.
+          // The register after the first block is advanced past the second, with
+          // the initial value removed, as that is already in the second CRC.
+          template <typename TCrcParameters>
+          ETL_CONSTEXPR14 typename TCrcParameters::accumulator_type crc_combine(typename TCrcParameters::accumulator_type crc1,
+                                                                                typename TCrcParameters::accumulator_type crc2, size_t length2)
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+            const accumulator_type initial =
+              TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+
+            return accumulator_type(crc_add_zeros<TCrcParameters>(accumulator_type(crc1 ^ TCrcParameters::Xor_Out ^ initial), length2) ^ crc2);
+          }
         }
 
         //*****************************************************************************
@@ -697,7 +1277,8 @@ namespace etl
         {
         public:
 
-          ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+          ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U),
+                            "Table size must be 4, 16, 256, 2048 or 4096");
 
           //*************************************************************************
           /// Default constructor.
@@ -718,6 +1299,19 @@ namespace etl
             this->reset();
             this->add(begin, end);
           }
+
+          //*************************************************************************
+          /// Combines the CRCs of two blocks into the CRC of the first block
+          /// followed by the second, without needing the data.
+          /// \param crc1    The CRC of the first block.
+          /// \param crc2    The CRC of the second block.
+          /// \param length2 The length of the second block, in bytes.
+          //*************************************************************************
+          static ETL_CONSTEXPR14 typename TCrcParameters::accumulator_type combine(typename TCrcParameters::accumulator_type crc1,
+                                                                                   typename TCrcParameters::accumulator_type crc2, size_t length2)
+          {
+            return private_crc::crc_combine<TCrcParameters>(crc1, crc2, length2);
+          }
         };
       }
 
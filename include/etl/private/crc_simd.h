@@ -0,0 +1,393 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_SIMD_INCLUDED
+#define ETL_CRC_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_SIMD_CRC
+
+  #include <nmmintrin.h>
+
+  #if ETL_USING_PCLMUL
+    #include <wmmintrin.h>
+  #endif
+
+//*****************************************************************************
+// SIMD versions of the CRC calculations, for blocks of bytes.
+// Blocks of 64 bytes or more are folded 64 bytes at a time with carry-less
+// multiplies, until there is one 16 byte block left, which is added along
+// with the remaining bytes using the table.
+// Without PCLMUL, and for shorter blocks, CRC-32C uses the SSE4.2 crc32
+// instruction.
+// The CRC policies select these at compile time, and only when they are not
+// being evaluated in a constant expression.
+//*****************************************************************************
+namespace etl
+{
+  namespace private_crc_simd
+  {
+    //*************************************************************************
+    /// Is the CRC the one calculated by the SSE4.2 crc32 instruction?
+    /// The initial and final values are applied by the policy, so only the
+    /// polynomial and reflection need to match.
+    //*************************************************************************
+    template <typename TCrcParameters>
+    struct is_crc32_c
+      : etl::integral_constant<bool, (TCrcParameters::Accumulator_Bits == 32U) && (TCrcParameters::Polynomial == 0x1EDC6F41UL) && TCrcParameters::Reflect>
+    {
+    };
+
+    //*************************************************************************
+    /// Can the CRC be calculated faster than with the table?
+    //*************************************************************************
+    template <typename TCrcParameters>
+    struct is_accelerated : etl::integral_constant<bool, (ETL_USING_PCLMUL == 1) || is_crc32_c<TCrcParameters>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Adds the bytes with the crc32 instruction.
+    //*************************************************************************
+    inline uint32_t add_crc32_c(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+    {
+  #if defined(__x86_64__) || defined(_M_X64)
+      uint64_t crc64 = crc;
+
+      while ((end - begin) >= 8)
+      {
+        uint64_t value;
+        memcpy(&value, begin, sizeof(value));
+        crc64 = _mm_crc32_u64(crc64, value);
+        begin += 8;
+      }
+
+      crc = static_cast<uint32_t>(crc64);
+  #else
+      while ((end - begin) >= 4)
+      {
+        uint32_t value;
+        memcpy(&value, begin, sizeof(value));
+        crc = _mm_crc32_u32(crc, value);
+        begin += 4;
+      }
+  #endif
+
+      while (begin != end)
+      {
+        crc = _mm_crc32_u8(crc, *begin);
+        ++begin;
+      }
+
+      return crc;
+    }
+
+  #if ETL_USING_PCLMUL
+    //*************************************************************************
+    /// x times a polynomial, modulo the CRC polynomial.
+    /// Bit i is the coefficient of x^i.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TCrcParameters::accumulator_type Value>
+    struct x_times_mod
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT accumulator_type value =
+        ((Value >> (TCrcParameters::Accumulator_Bits - 1U)) & 1U) != 0U ? static_cast<accumulator_type>(static_cast<accumulator_type>(Value << 1U) ^ TCrcParameters::Polynomial)
+                                                                       : static_cast<accumulator_type>(Value << 1U);
+    };
+
+    template <typename TCrcParameters, typename TCrcParameters::accumulator_type Value>
+    ETL_CONSTANT typename TCrcParameters::accumulator_type x_times_mod<TCrcParameters, Value>::value;
+
+    //*************************************************************************
+    /// x^8 times a polynomial, modulo the CRC polynomial.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TCrcParameters::accumulator_type Value>
+    struct x8_times_mod
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT accumulator_type value = x_times_mod<
+        TCrcParameters,
+        x_times_mod<TCrcParameters,
+                    x_times_mod<TCrcParameters,
+                                x_times_mod<TCrcParameters,
+                                            x_times_mod<TCrcParameters,
+                                                        x_times_mod<TCrcParameters,
+                                                                    x_times_mod<TCrcParameters, x_times_mod<TCrcParameters, Value>::value>::value>::value>::value>::value>::value>::value>::value;
+    };
+
+    template <typename TCrcParameters, typename TCrcParameters::accumulator_type Value>
+    ETL_CONSTANT typename TCrcParameters::accumulator_type x8_times_mod<TCrcParameters, Value>::value;
+
+    //*************************************************************************
+    /// x^N modulo the CRC polynomial, calculated at compile time.
+    /// Eight powers are taken at each step, to keep the recursion shallow.
+    //*************************************************************************
+    template <typename TCrcParameters, size_t N, bool Is_Large = (N >= 8U)>
+    struct x_power_mod;
+
+    template <typename TCrcParameters, size_t N>
+    struct x_power_mod<TCrcParameters, N, true>
+    {
+      static ETL_CONSTANT uint64_t value =
+        x8_times_mod<TCrcParameters, static_cast<typename TCrcParameters::accumulator_type>(x_power_mod<TCrcParameters, N - 8U>::value)>::value;
+    };
+
+    template <typename TCrcParameters, size_t N>
+    ETL_CONSTANT uint64_t x_power_mod<TCrcParameters, N, true>::value;
+
+    template <typename TCrcParameters, size_t N>
+    struct x_power_mod<TCrcParameters, N, false>
+    {
+      static ETL_CONSTANT uint64_t value =
+        x_times_mod<TCrcParameters, static_cast<typename TCrcParameters::accumulator_type>(x_power_mod<TCrcParameters, N - 1U>::value)>::value;
+    };
+
+    template <typename TCrcParameters, size_t N>
+    ETL_CONSTANT uint64_t x_power_mod<TCrcParameters, N, false>::value;
+
+    template <typename TCrcParameters>
+    struct x_power_mod<TCrcParameters, 0U, false>
+    {
+      static ETL_CONSTANT uint64_t value = 1U;
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t x_power_mod<TCrcParameters, 0U, false>::value;
+
+    //*************************************************************************
+    /// The multipliers that fold a 16 byte block forward by a distance in bits.
+    /// Reflected CRCs use bit reversed multipliers, less one power, as the
+    /// product of two reflected values is one bit short.
+    /// Low and High are the low and high 64 bits of the multipliers.
+    /// Calculated at compile time, so that there is no shared state to
+    /// initialise when several threads calculate CRCs.
+    //*************************************************************************
+    template <typename TCrcParameters, size_t Distance, bool Reflect = TCrcParameters::Reflect>
+    struct fold_multipliers;
+
+    template <typename TCrcParameters, size_t Distance>
+    struct fold_multipliers<TCrcParameters, Distance, true>
+    {
+      static ETL_CONSTANT uint64_t Low  = etl::reverse_bits_const<uint64_t, x_power_mod<TCrcParameters, Distance + 63U>::value>::value;
+      static ETL_CONSTANT uint64_t High = etl::reverse_bits_const<uint64_t, x_power_mod<TCrcParameters, Distance - 1U>::value>::value;
+    };
+
+    template <typename TCrcParameters, size_t Distance>
+    ETL_CONSTANT uint64_t fold_multipliers<TCrcParameters, Distance, true>::Low;
+
+    template <typename TCrcParameters, size_t Distance>
+    ETL_CONSTANT uint64_t fold_multipliers<TCrcParameters, Distance, true>::High;
+
+    template <typename TCrcParameters, size_t Distance>
+    struct fold_multipliers<TCrcParameters, Distance, false>
+    {
+      static ETL_CONSTANT uint64_t Low  = x_power_mod<TCrcParameters, Distance>::value;
+      static ETL_CONSTANT uint64_t High = x_power_mod<TCrcParameters, Distance + 64U>::value;
+    };
+
+    template <typename TCrcParameters, size_t Distance>
+    ETL_CONSTANT uint64_t fold_multipliers<TCrcParameters, Distance, false>::Low;
+
+    template <typename TCrcParameters, size_t Distance>
+    ETL_CONSTANT uint64_t fold_multipliers<TCrcParameters, Distance, false>::High;
+
+    //*************************************************************************
+    /// Makes the multipliers for a fold.
+    //*************************************************************************
+    template <typename TCrcParameters, size_t Distance>
+    inline __m128i make_fold_multipliers()
+    {
+      typedef fold_multipliers<TCrcParameters, Distance> multipliers;
+
+      return _mm_set_epi64x(static_cast<long long>(multipliers::High), static_cast<long long>(multipliers::Low));
+    }
+
+    //*************************************************************************
+    /// Reverses the order of the bytes in a block.
+    //*************************************************************************
+    inline __m128i reverse_bytes(__m128i block)
+    {
+      return _mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+
+    //*************************************************************************
+    /// Loads a 16 byte block. Non-reflected CRCs are byte reversed, so that
+    /// the first byte is the most significant.
+    //*************************************************************************
+    template <bool Reflect>
+    inline __m128i load_block(const uint8_t* p)
+    {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+      return Reflect ? block : reverse_bytes(block);
+    }
+
+    //*************************************************************************
+    /// Folds a block forward with the multipliers and adds the next block.
+    //*************************************************************************
+    inline __m128i fold_block(__m128i block, __m128i multipliers, __m128i next)
+    {
+      const __m128i low  = _mm_clmulepi64_si128(block, multipliers, 0x00);
+      const __m128i high = _mm_clmulepi64_si128(block, multipliers, 0x11);
+
+      return _mm_xor_si128(_mm_xor_si128(low, high), next);
+    }
+
+    //*************************************************************************
+    /// Adds at least 64 bytes by folding.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TPolicy>
+    typename TCrcParameters::accumulator_type add_folded(typename TCrcParameters::accumulator_type crc, const uint8_t* begin, const uint8_t* end)
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static const bool Reflect = TCrcParameters::Reflect;
+
+      // The multipliers that fold forward by 64 and 16 bytes.
+      const __m128i by_four = make_fold_multipliers<TCrcParameters, 512U>();
+      const __m128i by_one  = make_fold_multipliers<TCrcParameters, 128U>();
+
+      // The current CRC is added to the start of the data.
+      const __m128i initial = Reflect ? _mm_set_epi64x(0, static_cast<long long>(crc))
+                                      : _mm_set_epi64x(static_cast<long long>(static_cast<uint64_t>(crc) << (64U - TCrcParameters::Accumulator_Bits)), 0);
+
+      __m128i block0 = _mm_xor_si128(load_block<Reflect>(begin), initial);
+      __m128i block1 = load_block<Reflect>(begin + 16);
+      __m128i block2 = load_block<Reflect>(begin + 32);
+      __m128i block3 = load_block<Reflect>(begin + 48);
+      begin += 64;
+
+      while ((end - begin) >= 64)
+      {
+        block0 = fold_block(block0, by_four, load_block<Reflect>(begin));
+        block1 = fold_block(block1, by_four, load_block<Reflect>(begin + 16));
+        block2 = fold_block(block2, by_four, load_block<Reflect>(begin + 32));
+        block3 = fold_block(block3, by_four, load_block<Reflect>(begin + 48));
+        begin += 64;
+      }
+
+      block0 = fold_block(block0, by_one, block1);
+      block0 = fold_block(block0, by_one, block2);
+      block0 = fold_block(block0, by_one, block3);
+
+      while ((end - begin) >= 16)
+      {
+        block0 = fold_block(block0, by_one, load_block<Reflect>(begin));
+        begin += 16;
+      }
+
+      // The last block is added to an empty CRC, in the original byte order.
+      uint8_t last_block[16];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(last_block), Reflect ? block0 : reverse_bytes(block0));
+
+      crc = accumulator_type(0U);
+
+      for (size_t i = 0U; i < sizeof(last_block); ++i)
+      {
+        crc = TPolicy::add(crc, last_block[i]);
+      }
+
+      while (begin != end)
+      {
+        crc = TPolicy::add(crc, *begin);
+        ++begin;
+      }
+
+      return crc;
+    }
+  #endif
+
+    //*************************************************************************
+    /// CRC-32C.
+    /// Folding is faster than the crc32 instruction, which can only add
+    /// 8 bytes at a time, so it is used for the shorter blocks.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TPolicy>
+    typename TCrcParameters::accumulator_type add_range(typename TCrcParameters::accumulator_type crc, const uint8_t* begin, const uint8_t* end,
+                                                        etl::true_type)
+    {
+  #if ETL_USING_PCLMUL
+      if ((end - begin) >= 64)
+      {
+        return add_folded<TCrcParameters, TPolicy>(crc, begin, end);
+      }
+  #endif
+
+      return add_crc32_c(crc, begin, end);
+    }
+
+    //*************************************************************************
+    /// Other CRCs.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TPolicy>
+    typename TCrcParameters::accumulator_type add_range(typename TCrcParameters::accumulator_type crc, const uint8_t* begin, const uint8_t* end,
+                                                        etl::false_type)
+    {
+  #if ETL_USING_PCLMUL
+      if ((end - begin) >= 64)
+      {
+        return add_folded<TCrcParameters, TPolicy>(crc, begin, end);
+      }
+  #endif
+
+      while (begin != end)
+      {
+        crc = TPolicy::add(crc, *begin);
+        ++begin;
+      }
+
+      return crc;
+    }
+
+    //*************************************************************************
+    /// Adds a block of bytes to the CRC.
+    /// Bytes that are not folded are added with the static TPolicy::add, so
+    /// no policy object is needed.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TPolicy>
+    typename TCrcParameters::accumulator_type add_range(typename TCrcParameters::accumulator_type crc, const uint8_t* begin, const uint8_t* end)
+    {
+      return add_range<TCrcParameters, TPolicy>(crc, begin, end, etl::integral_constant<bool, is_crc32_c<TCrcParameters>::value>());
+    }
+  } // namespace private_crc_simd
+} // namespace etl
+
+#endif
+#endif
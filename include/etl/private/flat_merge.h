@@ -0,0 +1,159 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MERGE_INCLUDED
+#define ETL_FLAT_MERGE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Compares the values that two lookup pointers point to.
+    //*************************************************************************
+    template <typename TCompare>
+    struct indirect_compare
+    {
+      indirect_compare(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T* lhs, const T* rhs) const
+      {
+        return compare(*lhs, *rhs);
+      }
+
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Compares the keys of the pairs that two lookup pointers point to.
+    //*************************************************************************
+    template <typename TCompare>
+    struct indirect_key_compare
+    {
+      indirect_key_compare(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T* lhs, const T* rhs) const
+      {
+        return compare(lhs->first, rhs->first);
+      }
+
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last), using the
+    /// scratch buffer where the smaller range fits.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_sorted(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      // Already in order?
+      if ((first == middle) || (middle == last) || !compare(*middle, *(middle - 1)))
+      {
+        return;
+      }
+
+      private_algorithm::merge_adaptive(first, middle, last, difference_type(middle - first), difference_type(last - middle), buffer_first,
+                                        difference_type(buffer_last - buffer_first), compare);
+    }
+
+    //*************************************************************************
+    /// Merges the unsorted values in [middle, last) into the sorted, unique
+    /// values in [first, middle).
+    /// Values whose keys are already in [first, middle), or repeat the key of
+    /// an earlier value in [middle, last), are rejected and moved to the end
+    /// of the range. The first of a set of repeated keys is the one kept.
+    /// Does not allocate. The scratch buffer, such as the unused capacity of
+    /// the lookup, is used by the sort and the merge.
+    /// Complexity: O(N log N) for N = last - first, if the buffer holds at
+    /// least half of [middle, last). Up to O(N log^2 N) with a smaller buffer.
+    ///\return The number of rejected values.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    size_t merge_unique(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+    {
+      etl::stable_sort(middle, last, buffer_first, buffer_last, compare);
+
+      TIterator existing = first;
+      TIterator keep     = middle;
+
+      for (TIterator itr = middle; itr != last; ++itr)
+      {
+        existing = etl::lower_bound(existing, middle, *itr, compare);
+
+        const bool is_present  = (existing != middle) && !compare(*itr, *existing);
+        const bool is_repeated = (keep != middle) && !compare(*(keep - 1), *itr);
+
+        if (!is_present && !is_repeated)
+        {
+          etl::iter_swap(keep, itr);
+          ++keep;
+        }
+      }
+
+      merge_sorted(first, middle, keep, buffer_first, buffer_last, compare);
+
+      return size_t(last - keep);
+    }
+
+    //*************************************************************************
+    /// Merges the unsorted values in [middle, last) into the sorted values in
+    /// [first, middle).
+    /// Equivalent values keep their order, with those in [first, middle)
+    /// placed before those in [middle, last).
+    /// Does not allocate. See merge_unique for the scratch buffer and the
+    /// complexity.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_equivalent(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last,
+                          TCompare compare)
+    {
+      etl::stable_sort(middle, last, buffer_first, buffer_last, compare);
+      merge_sorted(first, middle, last, buffer_first, buffer_last, compare);
+    }
+  } // namespace private_flat
+} // namespace etl
+
+#endif
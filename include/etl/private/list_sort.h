@@ -0,0 +1,213 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#ifndef ETL_LIST_SORT_INCLUDED
+#define ETL_LIST_SORT_INCLUDED
+
+#include "../platform.h"
+
+#include <limits.h>
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_list_sort
+  {
+    //*************************************************************************
+    /// A sorted run of nodes.
+    //*************************************************************************
+    template <typename TNode>
+    struct run
+    {
+      TNode* head;
+      TNode* tail;
+    };
+
+    //*************************************************************************
+    /// How the nodes are linked.
+    //*************************************************************************
+    template <typename TNode>
+    struct links
+    {
+      TNode*          terminator; ///< The node, or null, that ends a chain.
+      TNode* TNode::* next;       ///< The link to the next node.
+      TNode* TNode::* previous;   ///< The link to the previous node, if Bidirectional.
+    };
+
+    //*************************************************************************
+    /// Merges two non-empty sorted runs, each ending at the terminator.
+    /// Nodes from 'left' come first when equal.
+    /// The previous links are written as the nodes are linked, if Bidirectional.
+    //*************************************************************************
+    template <bool Bidirectional, typename TNode, typename TCompare>
+    run<TNode> merge(run<TNode> left, run<TNode> right, const links<TNode>& chain, TCompare& compare)
+    {
+      run<TNode> result;
+      TNode**    p_link     = &result.head;
+      TNode*     p_previous = chain.terminator;
+
+      while (true)
+      {
+        TNode* p_node;
+
+        if (compare(*right.head, *left.head))
+        {
+          p_node     = right.head;
+          right.head = right.head->*chain.next;
+        }
+        else
+        {
+          p_node    = left.head;
+          left.head = left.head->*chain.next;
+        }
+
+        *p_link = p_node;
+
+        if ETL_IF_CONSTEXPR (Bidirectional)
+        {
+          p_node->*chain.previous = p_previous;
+          p_previous              = p_node;
+        }
+
+        p_link = &(p_node->*chain.next);
+
+        if (left.head == chain.terminator)
+        {
+          left       = right;
+          break;
+        }
+
+        if (right.head == chain.terminator)
+        {
+          break;
+        }
+      }
+
+      // Append the rest of the run that is left over.
+      *p_link = left.head;
+
+      if ETL_IF_CONSTEXPR (Bidirectional)
+      {
+        left.head->*chain.previous = p_previous;
+      }
+
+      result.tail = left.tail;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Stable bottom up merge sort of the chain of nodes from 'first' up to
+    /// the terminator.
+    /// Each node is visited once as it is taken from the chain. Bin 'i' holds
+    /// a sorted run of 2^i nodes, and a new node carries up through the full
+    /// bins like a binary counter. Merges work on recently used nodes, so the
+    /// sort stays in cache for longer than a pass based merge sort.
+    /// O(N log N) comparisons. Does not allocate.
+    //*************************************************************************
+    template <bool Bidirectional, typename TNode, typename TCompare>
+    run<TNode> merge_sort(TNode* first, const links<TNode>& chain, TCompare& compare)
+    {
+      run<TNode> bins[sizeof(size_t) * CHAR_BIT];
+      size_t     n_bins = 0U;
+
+      while (first != chain.terminator)
+      {
+        run<TNode> carry;
+        carry.head = first;
+        carry.tail = first;
+
+        first                   = first->*chain.next;
+        carry.tail->*chain.next = chain.terminator;
+
+        size_t i = 0U;
+
+        // Bins further up hold earlier nodes, so they are merged on the left.
+        while ((i < n_bins) && (bins[i].head != chain.terminator))
+        {
+          carry        = merge<Bidirectional>(bins[i], carry, chain, compare);
+          bins[i].head = chain.terminator;
+          ++i;
+        }
+
+        if (i == n_bins)
+        {
+          ++n_bins;
+        }
+
+        bins[i] = carry;
+      }
+
+      run<TNode> result;
+      result.head = chain.terminator;
+      result.tail = chain.terminator;
+
+      for (size_t i = 0U; i < n_bins; ++i)
+      {
+        if (bins[i].head != chain.terminator)
+        {
+          result = (result.head == chain.terminator) ? bins[i] : merge<Bidirectional>(bins[i], result, chain, compare);
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Sorts a singly linked chain of nodes.
+    /// Only the 'next' links are written.
+    ///\return The first node of the sorted chain, which ends at 'terminator'.
+    //*************************************************************************
+    template <typename TNode, typename TCompare>
+    TNode* sort(TNode* first, TNode* terminator, TNode* TNode::* next, TCompare compare)
+    {
+      links<TNode> chain = {terminator, next, next};
+
+      return merge_sort<false>(first, chain, compare).head;
+    }
+
+    //*************************************************************************
+    /// Sorts a circular doubly linked chain of nodes, through the terminator.
+    /// The 'previous' links are rebuilt during the merges.
+    //*************************************************************************
+    template <typename TNode, typename TCompare>
+    void sort(TNode& terminator, TNode* TNode::* next, TNode* TNode::* previous, TCompare compare)
+    {
+      links<TNode> chain = {&terminator, next, previous};
+
+      run<TNode> result = merge_sort<true>(terminator.*next, chain, compare);
+
+      terminator.*next       = result.head;
+      result.head->*previous = &terminator;
+      terminator.*previous   = result.tail;
+    }
+  } // namespace private_list_sort
+} // namespace etl
+
+#endif
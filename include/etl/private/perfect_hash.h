@@ -0,0 +1,307 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERFECT_HASH_INCLUDED
+#define ETL_PERFECT_HASH_INCLUDED
+
+#include "../platform.h"
+
+#if ETL_NOT_USING_CPP14
+  #error NOT SUPPORTED FOR C++11 OR BELOW
+#endif
+
+#include "../array.h"
+#include "../string_view.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A hash function that may be evaluated at compile time.
+  /// The default hash for the const unordered containers.
+  /// Defined for integral types, enumerations and string views.
+  //***************************************************************************
+  template <typename T, typename TEnable = void>
+  struct constexpr_hash;
+
+  //***************************************************************************
+  /// Specialisation for integral and enumeration types.
+  //***************************************************************************
+  template <typename T>
+  struct constexpr_hash<T, etl::enable_if_t<etl::is_integral<T>::value || etl::is_enum<T>::value>>
+  {
+    ETL_CONSTEXPR14 size_t operator()(T value) const ETL_NOEXCEPT
+    {
+      const uint64_t v = static_cast<uint64_t>(value);
+
+      // Fold the upper bits in, for when size_t is narrower than the key.
+      return static_cast<size_t>(v ^ (v >> 32U));
+    }
+  };
+
+  //***************************************************************************
+  /// Specialisation for string views. FNV-1a.
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  struct constexpr_hash<etl::basic_string_view<T, TTraits>, void>
+  {
+    ETL_CONSTEXPR14 size_t operator()(const etl::basic_string_view<T, TTraits>& text) const ETL_NOEXCEPT
+    {
+      uint64_t hash = 0xCBF29CE484222325ULL;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        hash ^= static_cast<uint64_t>(text[i]);
+        hash *= 0x00000100000001B3ULL;
+      }
+
+      return static_cast<size_t>(hash ^ (hash >> 32U));
+    }
+  };
+
+  namespace private_perfect_hash
+  {
+    /// The number of seeds tried for a bucket before giving up.
+    static ETL_CONSTANT uint32_t Max_Attempts = 65536U;
+
+    //*************************************************************************
+    /// Mixes a hash with a seed.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t mix(uint64_t hash, uint64_t seed) ETL_NOEXCEPT
+    {
+      uint64_t x = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+
+      x ^= x >> 32U;
+      x *= 0xD6E8FEB86659FD93ULL;
+      x ^= x >> 32U;
+      x *= 0xD6E8FEB86659FD93ULL;
+      x ^= x >> 32U;
+
+      return x;
+    }
+
+    //*************************************************************************
+    /// Maps a mixed hash to the range [0, n) with a multiply and shift.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline size_t reduce(uint64_t x, size_t n) ETL_NOEXCEPT
+    {
+      return static_cast<size_t>(((x & 0xFFFFFFFFULL) * static_cast<uint64_t>(n)) >> 32U);
+    }
+
+    //*************************************************************************
+    /// Gets the slot for a hash.
+    /// A negative displacement encodes the slot of a single element bucket.
+    /// Otherwise, it is the seed that places the bucket's elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline size_t slot_of(uint64_t hash, const int32_t* displacement, size_t n) ETL_NOEXCEPT
+    {
+      const int32_t d = displacement[reduce(mix(hash, 0U), n)];
+
+      return (d < 0) ? static_cast<size_t>(-(d + 1)) : reduce(mix(hash, static_cast<uint64_t>(d)), n);
+    }
+
+    //*************************************************************************
+    /// The result of building a minimal perfect hash for Size elements.
+    //*************************************************************************
+    template <size_t Size>
+    struct table
+    {
+      static ETL_CONSTANT size_t Capacity = (Size == 0U) ? 1U : Size;
+
+      size_t  owner[Capacity];        ///< The input element for each slot.
+      int32_t displacement[Capacity]; ///< The displacement for each bucket.
+      bool    valid;                  ///< False if there were duplicate keys, or no seed was found.
+    };
+
+    //*************************************************************************
+    /// Builds a minimal perfect hash, using 'hash and displace'.
+    /// Keys are split into as many buckets as there are keys. The buckets with
+    /// more than one key are placed first, largest first, by searching for a
+    /// seed that maps all of their keys to free slots. Single key buckets then
+    /// take the remaining slots directly.
+    ///\tparam Size   The capacity of the table.
+    ///\tparam TKeyOf Has a static member 'key' that gets the key from an input.
+    //*************************************************************************
+    template <size_t Size, typename TKeyOf, typename THash, typename TKeyEqual, typename TInput, size_t N>
+    ETL_CONSTEXPR14 table<Size> build(const etl::array<TInput, N>& inputs) ETL_NOEXCEPT
+    {
+      static_assert(N <= Size, "Number of elements exceeds capacity");
+
+      const size_t Capacity = table<Size>::Capacity;
+
+      table<Size> result = {};
+      result.valid       = true;
+
+      if (N == 0U)
+      {
+        return result;
+      }
+
+      const THash     hasher    = THash();
+      const TKeyEqual key_equal = TKeyEqual();
+
+      uint64_t hashes[Capacity]       = {};
+      size_t   bucket_of[Capacity]    = {};
+      size_t   bucket_start[Capacity + 1U] = {};
+      size_t   members[Capacity]      = {};
+      size_t   order[Capacity]        = {};
+      size_t   by_size[Capacity + 1U] = {};
+      size_t   candidate[Capacity]    = {};
+      bool     used[Capacity]         = {};
+
+      // Hash the keys and count the bucket sizes.
+      for (size_t i = 0U; i < N; ++i)
+      {
+        hashes[i]    = static_cast<uint64_t>(hasher(TKeyOf::key(inputs[i])));
+        bucket_of[i] = reduce(mix(hashes[i], 0U), N);
+        ++bucket_start[bucket_of[i] + 1U];
+      }
+
+      // Group the elements by bucket.
+      for (size_t b = 0U; b < N; ++b)
+      {
+        bucket_start[b + 1U] += bucket_start[b];
+      }
+
+      size_t cursor[Capacity] = {};
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        const size_t b = bucket_of[i];
+        members[bucket_start[b] + cursor[b]] = i;
+        ++cursor[b];
+      }
+
+      // Order the buckets by size, largest first.
+      for (size_t b = 0U; b < N; ++b)
+      {
+        ++by_size[N - (bucket_start[b + 1U] - bucket_start[b])];
+      }
+
+      for (size_t s = 0U; s < N; ++s)
+      {
+        by_size[s + 1U] += by_size[s];
+      }
+
+      for (size_t b = N; b > 0U; --b)
+      {
+        const size_t index = N - (bucket_start[b] - bucket_start[b - 1U]);
+        order[--by_size[index]] = b - 1U;
+      }
+
+      // Place the buckets.
+      size_t next_free = 0U;
+
+      for (size_t o = 0U; o < N; ++o)
+      {
+        const size_t b     = order[o];
+        const size_t first = bucket_start[b];
+        const size_t count = bucket_start[b + 1U] - first;
+
+        if (count == 0U)
+        {
+          break;
+        }
+
+        if (count == 1U)
+        {
+          while (used[next_free])
+          {
+            ++next_free;
+          }
+
+          used[next_free]              = true;
+          result.owner[next_free]      = members[first];
+          result.displacement[b]       = -static_cast<int32_t>(next_free) - 1;
+          continue;
+        }
+
+        // Duplicate keys always share a bucket.
+        for (size_t i = first; i < (first + count); ++i)
+        {
+          for (size_t j = i + 1U; j < (first + count); ++j)
+          {
+            if (key_equal(TKeyOf::key(inputs[members[i]]), TKeyOf::key(inputs[members[j]])))
+            {
+              result.valid = false;
+              return result;
+            }
+          }
+        }
+
+        bool placed = false;
+
+        for (uint32_t seed = 1U; !placed && (seed <= Max_Attempts); ++seed)
+        {
+          placed = true;
+
+          for (size_t i = 0U; placed && (i < count); ++i)
+          {
+            const size_t slot = reduce(mix(hashes[members[first + i]], seed), N);
+
+            placed = !used[slot];
+
+            for (size_t j = 0U; placed && (j < i); ++j)
+            {
+              placed = (candidate[j] != slot);
+            }
+
+            candidate[i] = slot;
+          }
+
+          if (placed)
+          {
+            for (size_t i = 0U; i < count; ++i)
+            {
+              used[candidate[i]]         = true;
+              result.owner[candidate[i]] = members[first + i];
+            }
+
+            result.displacement[b] = static_cast<int32_t>(seed);
+          }
+        }
+
+        if (!placed)
+        {
+          result.valid = false;
+          return result;
+        }
+      }
+
+      return result;
+    }
+  } // namespace private_perfect_hash
+} // namespace etl
+
+#endif
@@ -0,0 +1,487 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../integral_limits.h"
+#include "../iterator.h"
+#include "../memory.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Returned when the search fails.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// The number of character comparisons, per character of text scanned,
+    /// allowed before the search switches to the Two-Way algorithm.
+    //*************************************************************************
+    static ETL_CONSTANT ptrdiff_t Work_Factor = 4;
+
+    //*************************************************************************
+    /// Finds a character with memchr.
+    //*************************************************************************
+    template <typename T>
+    const T* find_character(const T* first, const T* last, T value, etl::true_type)
+    {
+      const char* begin  = reinterpret_cast<const char*>(first);
+      const char* result = etl::mem_char(begin, reinterpret_cast<const char*>(last), static_cast<char>(value));
+
+      return first + (result - begin);
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_character(const T* first, const T* last, T value, etl::false_type)
+    {
+      return etl::find(first, last, value);
+    }
+
+    //*************************************************************************
+    /// Finds a character in a range of characters.
+    /// Single byte characters use memchr at run time.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_character(const T* first, const T* last, T value)
+    {
+#if ETL_NOT_USING_CPP14 || ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      typedef etl::integral_constant<bool, etl::is_integral<T>::value && (sizeof(T) == 1U)> is_byte;
+
+      if ETL_IF_CONSTEXPR (is_byte::value)
+      {
+        if (!etl::is_constant_evaluated())
+        {
+          return find_character(first, last, value, is_byte());
+        }
+      }
+#endif
+
+      return etl::find(first, last, value);
+    }
+
+    //*************************************************************************
+    /// Finds a character in a range of reversed characters.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 TIterator find_character(TIterator first, TIterator last, T value)
+    {
+      return etl::find(first, last, value);
+    }
+
+    //*************************************************************************
+    /// Finds the maximal suffix of the pattern, for either the normal or the
+    /// reversed character ordering, and its period.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 ptrdiff_t maximal_suffix(TIterator pattern, ptrdiff_t length, bool reversed, ptrdiff_t& period)
+    {
+      ptrdiff_t suffix = -1;
+      ptrdiff_t j      = 0;
+      ptrdiff_t k      = 1;
+
+      period = 1;
+
+      while ((j + k) < length)
+      {
+        const typename etl::iterator_traits<TIterator>::value_type a = pattern[j + k];
+        const typename etl::iterator_traits<TIterator>::value_type b = pattern[suffix + k];
+
+        if (reversed ? (b < a) : (a < b))
+        {
+          j += k;
+          k      = 1;
+          period = j - suffix;
+        }
+        else if (a == b)
+        {
+          if (k != period)
+          {
+            ++k;
+          }
+          else
+          {
+            j += period;
+            k = 1;
+          }
+        }
+        else
+        {
+          suffix = j;
+          j      = suffix + 1;
+          k      = 1;
+          period = 1;
+        }
+      }
+
+      return suffix;
+    }
+
+    //*************************************************************************
+    /// Returns the first alignment, from j, that puts the character at offset
+    /// in the pattern over a matching character in the text, or last + 1.
+    /// The caller must stop on last + 1, as the alignment is past the text.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 ptrdiff_t skip_to(TIterator text, ptrdiff_t j, ptrdiff_t last, T value, ptrdiff_t offset)
+    {
+      const TIterator first = text + (j + offset);
+
+      return j + (find_character(first, text + (last + offset + 1), value) - first);
+    }
+
+    //*************************************************************************
+    /// The Two-Way algorithm of Crochemore and Perrin.
+    /// O(N + M) comparisons with constant extra space.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 size_t two_way_search(TIterator text, ptrdiff_t text_length, TIterator pattern, ptrdiff_t pattern_length)
+    {
+      // Find the critical factorisation, pattern = u.v where u = [0, split].
+      ptrdiff_t period         = 0;
+      ptrdiff_t reverse_period = 0;
+      ptrdiff_t split          = maximal_suffix(pattern, pattern_length, false, period);
+      ptrdiff_t reverse_split  = maximal_suffix(pattern, pattern_length, true, reverse_period);
+
+      if (reverse_split > split)
+      {
+        split  = reverse_split;
+        period = reverse_period;
+      }
+
+      const ptrdiff_t last = text_length - pattern_length;
+
+      if (etl::equal(pattern, pattern + split + 1, pattern + period))
+      {
+        // The pattern is periodic, so remember how much of the
+        // previous match of the prefix may be skipped.
+        ptrdiff_t memory = -1;
+        ptrdiff_t j      = 0;
+
+        while (j <= last)
+        {
+          if (memory < 0)
+          {
+            j = skip_to(text, j, last, pattern[split + 1], split + 1);
+
+            if (j > last)
+            {
+              break;
+            }
+          }
+
+          ptrdiff_t i = etl::max(split, memory) + 1;
+
+          while ((i < pattern_length) && (pattern[i] == text[i + j]))
+          {
+            ++i;
+          }
+
+          if (i >= pattern_length)
+          {
+            i = split;
+
+            while ((i > memory) && (pattern[i] == text[i + j]))
+            {
+              --i;
+            }
+
+            if (i <= memory)
+            {
+              return static_cast<size_t>(j);
+            }
+
+            j += period;
+            memory = pattern_length - period - 1;
+          }
+          else
+          {
+            j += i - split;
+            memory = -1;
+          }
+        }
+      }
+      else
+      {
+        period = etl::max(split + 1, pattern_length - split - 1) + 1;
+
+        ptrdiff_t j = 0;
+
+        while (j <= last)
+        {
+          j = skip_to(text, j, last, pattern[split + 1], split + 1);
+
+          if (j > last)
+          {
+            break;
+          }
+
+          ptrdiff_t i = split + 1;
+
+          while ((i < pattern_length) && (pattern[i] == text[i + j]))
+          {
+            ++i;
+          }
+
+          if (i >= pattern_length)
+          {
+            i = split;
+
+            while ((i >= 0) && (pattern[i] == text[i + j]))
+            {
+              --i;
+            }
+
+            if (i < 0)
+            {
+              return static_cast<size_t>(j);
+            }
+
+            j += period;
+          }
+          else
+          {
+            j += i - split;
+          }
+        }
+      }
+
+      return Npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern in the text.
+    /// Returns the offset of the match, or Npos.
+    /// Scans for the first character of the pattern and compares the rest.
+    /// This is the fastest search for most text, but is O(N * M) for
+    /// repetitive text, so once the comparisons exceed a linear budget the
+    /// rest of the text is searched with the Two-Way algorithm.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 size_t search(TIterator text, size_t text_length, TIterator pattern, size_t pattern_length)
+    {
+      if (pattern_length == 0U)
+      {
+        return 0U;
+      }
+
+      if (pattern_length > text_length)
+      {
+        return Npos;
+      }
+
+      const ptrdiff_t n    = static_cast<ptrdiff_t>(text_length);
+      const ptrdiff_t m    = static_cast<ptrdiff_t>(pattern_length);
+      const TIterator last = text + (n - m + 1);
+      TIterator       itr  = text;
+      ptrdiff_t       work = 0;
+
+      while (true)
+      {
+        itr = find_character(itr, last, *pattern);
+
+        if (itr == last)
+        {
+          return Npos;
+        }
+
+        ptrdiff_t i = 1;
+
+        while ((i < m) && (pattern[i] == itr[i]))
+        {
+          ++i;
+        }
+
+        if (i == m)
+        {
+          return static_cast<size_t>(itr - text);
+        }
+
+        work += i;
+
+        const ptrdiff_t position = itr - text;
+
+        if (work > (Work_Factor * (position + m)))
+        {
+          const size_t offset = two_way_search(itr, n - position, pattern, m);
+
+          return (offset == Npos) ? Npos : static_cast<size_t>(position) + offset;
+        }
+
+        ++itr;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the pattern in the text.
+    /// Searches the reversed text for the reversed pattern.
+    /// Returns the offset of the match, or Npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t reverse_search(const T* text, size_t text_length, const T* pattern, size_t pattern_length)
+    {
+      typedef etl::reverse_iterator<const T*> reverse_iterator;
+
+      const size_t position = search(reverse_iterator(text + text_length), text_length, reverse_iterator(pattern + pattern_length), pattern_length);
+
+      return (position == Npos) ? Npos : text_length - pattern_length - position;
+    }
+
+    //*************************************************************************
+    /// A set of characters.
+    /// Characters below 256 are held in a bit table, any others are found by
+    /// searching the original characters.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      //***********************************
+      ETL_CONSTEXPR14 character_set(const T* characters_, size_t length_)
+        : table()
+        , characters(characters_)
+        , length(length_)
+        , has_wide_characters(false)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const unsigned long long code = to_code(characters[i]);
+
+          if (code < 256U)
+          {
+            table[code / 32U] |= uint32_t(1U) << (code % 32U);
+          }
+          else
+          {
+            has_wide_characters = true;
+          }
+        }
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 bool contains(T c) const
+      {
+        const unsigned long long code = to_code(c);
+
+        if (code < 256U)
+        {
+          return (table[code / 32U] & (uint32_t(1U) << (code % 32U))) != 0U;
+        }
+
+        return has_wide_characters && (etl::find(characters, characters + length, c) != (characters + length));
+      }
+
+    private:
+
+      //***********************************
+      static ETL_CONSTEXPR14 unsigned long long to_code(T c)
+      {
+        return static_cast<unsigned long long>(static_cast<typename etl::make_unsigned<T>::type>(c));
+      }
+
+      uint32_t table[8];
+      const T* characters;
+      size_t   length;
+      bool     has_wide_characters;
+    };
+
+    //*************************************************************************
+    /// Finds the first character at or after position that is, or is not,
+    /// in the set. Returns the position, or Npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_of(const T* text, size_t text_length, size_t position, const T* characters, size_t length, bool is_in_set)
+    {
+      if (position >= text_length)
+      {
+        return Npos;
+      }
+
+      if (is_in_set && (length == 1U))
+      {
+        const T* itr = find_character(text + position, text + text_length, characters[0]);
+
+        return (itr == (text + text_length)) ? Npos : static_cast<size_t>(itr - text);
+      }
+
+      const character_set<T> set(characters, length);
+
+      for (size_t i = position; i < text_length; ++i)
+      {
+        if (set.contains(text[i]) == is_in_set)
+        {
+          return i;
+        }
+      }
+
+      return Npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before position that is, or is not,
+    /// in the set. Returns the position, or Npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_last_of(const T* text, size_t text_length, size_t position, const T* characters, size_t length, bool is_in_set)
+    {
+      if (text_length == 0U)
+      {
+        return Npos;
+      }
+
+      const character_set<T> set(characters, length);
+
+      size_t i = etl::min(position, text_length - 1U) + 1U;
+
+      while (i != 0U)
+      {
+        --i;
+
+        if (set.contains(text[i]) == is_in_set)
+        {
+          return i;
+        }
+      }
+
+      return Npos;
+    }
+  } // namespace private_string_search
+} // namespace etl
+
+#endif
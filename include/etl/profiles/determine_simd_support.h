@@ -0,0 +1,209 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DETERMINE_SIMD_SUPPORT_H_INCLUDED
+#define ETL_DETERMINE_SIMD_SUPPORT_H_INCLUDED
+
+//*****************************************************************************
+// Determines which SIMD instruction sets the ETL may use.
+// Each may be forced on or off by defining the macro as 1 or 0 in the profile.
+// Defining ETL_NO_SIMD disables all of them.
+//*****************************************************************************
+#if defined(ETL_NO_SIMD)
+  #if !defined(ETL_USING_SSE2)
+    #define ETL_USING_SSE2 0
+  #endif
+
+  #if !defined(ETL_USING_AVX2)
+    #define ETL_USING_AVX2 0
+  #endif
+
+  #if !defined(ETL_USING_SSE4_2)
+    #define ETL_USING_SSE4_2 0
+  #endif
+
+  #if !defined(ETL_USING_PCLMUL)
+    #define ETL_USING_PCLMUL 0
+  #endif
+
+  #if !defined(ETL_USING_NEON)
+    #define ETL_USING_NEON 0
+  #endif
+#endif
+
+//*************************************
+// x86 SSE2
+#if !defined(ETL_USING_SSE2)
+  #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_USING_SSE2 1
+  #else
+    #define ETL_USING_SSE2 0
+  #endif
+#endif
+
+//*************************************
+// x86 AVX2
+#if !defined(ETL_USING_AVX2)
+  #if defined(__AVX2__)
+    #define ETL_USING_AVX2 1
+  #else
+    #define ETL_USING_AVX2 0
+  #endif
+#endif
+
+//*************************************
+// x86 SSE4.2
+#if !defined(ETL_USING_SSE4_2)
+  #if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+    #define ETL_USING_SSE4_2 1
+  #else
+    #define ETL_USING_SSE4_2 0
+  #endif
+#endif
+
+//*************************************
+// x86 carry-less multiply
+#if !defined(ETL_USING_PCLMUL)
+  #if defined(__PCLMUL__) || (defined(_MSC_VER) && defined(__AVX__))
+    #define ETL_USING_PCLMUL 1
+  #else
+    #define ETL_USING_PCLMUL 0
+  #endif
+#endif
+
+//*************************************
+// ARM NEON
+#if !defined(ETL_USING_NEON)
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define ETL_USING_NEON 1
+  #else
+    #define ETL_USING_NEON 0
+  #endif
+#endif
+
+//*************************************
+// SIMD versions of the algorithms in algorithm.h.
+// NEON is only used on AArch64.
+// The algorithms must not use SIMD in constant expressions, so C++14 and
+// later need a way to tell whether they are being evaluated at compile time.
+// Defining ETL_NO_SIMD_ALGORITHMS disables them.
+#if !defined(ETL_USING_SIMD_ALGORITHMS)
+  #if defined(__aarch64__) || defined(_M_ARM64)
+    #define ETL_SIMD_ALGORITHMS_NEON ETL_USING_NEON
+  #else
+    #define ETL_SIMD_ALGORITHMS_NEON 0
+  #endif
+
+  #if !defined(ETL_NO_SIMD_ALGORITHMS) && ((ETL_USING_SSE2 == 1) || (ETL_USING_AVX2 == 1) || (ETL_SIMD_ALGORITHMS_NEON == 1)) && \
+    (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+    #define ETL_USING_SIMD_ALGORITHMS 1
+  #else
+    #define ETL_USING_SIMD_ALGORITHMS 0
+  #endif
+#endif
+
+//*************************************
+// SIMD versions of the CRC calculations in crc_implementation.h.
+// Long blocks are folded with carry-less multiplies, which need PCLMUL.
+// CRC-32C may also use the SSE4.2 crc32 instruction.
+// Like the algorithms, they must not be used in constant expressions.
+// Defining ETL_NO_SIMD_CRC disables them.
+#if !defined(ETL_USING_SIMD_CRC)
+  #if !defined(ETL_NO_SIMD_CRC) && (ETL_USING_SSE4_2 == 1) && (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+    #define ETL_USING_SIMD_CRC 1
+  #else
+    #define ETL_USING_SIMD_CRC 0
+  #endif
+#endif
+
+//*************************************
+// SIMD versions of the checksums in checksum.h, adler32.h and fletcher.h.
+// NEON is only used on little endian AArch64, as the Fletcher words are
+// loaded as little endian lanes.
+// Like the algorithms, they must not be used in constant expressions.
+// Defining ETL_NO_SIMD_CHECKSUM disables them.
+#if !defined(ETL_USING_SIMD_CHECKSUM)
+  #if (defined(__aarch64__) && !defined(__AARCH64EB__)) || defined(_M_ARM64)
+    #define ETL_SIMD_CHECKSUM_NEON ETL_USING_NEON
+  #else
+    #define ETL_SIMD_CHECKSUM_NEON 0
+  #endif
+
+  #if !defined(ETL_NO_SIMD_CHECKSUM) && ((ETL_USING_SSE2 == 1) || (ETL_USING_AVX2 == 1) || (ETL_SIMD_CHECKSUM_NEON == 1)) && \
+    (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+    #define ETL_USING_SIMD_CHECKSUM 1
+  #else
+    #define ETL_USING_SIMD_CHECKSUM 0
+  #endif
+#endif
+
+//*************************************
+// SIMD batched bit tests for etl::blocked_bloom_filter.
+// AVX2 only, as they need a gather.
+// The filter is not constexpr, so there is no need to detect constant
+// evaluation.
+// Defining ETL_NO_SIMD_BLOOM_FILTER disables them.
+#if !defined(ETL_USING_SIMD_BLOOM_FILTER)
+  #if !defined(ETL_NO_SIMD_BLOOM_FILTER) && (ETL_USING_AVX2 == 1)
+    #define ETL_USING_SIMD_BLOOM_FILTER 1
+  #else
+    #define ETL_USING_SIMD_BLOOM_FILTER 0
+  #endif
+#endif
+
+#define ETL_NOT_USING_SSE2 (ETL_USING_SSE2 == 0)
+#define ETL_NOT_USING_AVX2 (ETL_USING_AVX2 == 0)
+#define ETL_NOT_USING_SSE4_2 (ETL_USING_SSE4_2 == 0)
+#define ETL_NOT_USING_PCLMUL (ETL_USING_PCLMUL == 0)
+#define ETL_NOT_USING_NEON (ETL_USING_NEON == 0)
+#define ETL_NOT_USING_SIMD_ALGORITHMS (ETL_USING_SIMD_ALGORITHMS == 0)
+#define ETL_NOT_USING_SIMD_CRC (ETL_USING_SIMD_CRC == 0)
+#define ETL_NOT_USING_SIMD_CHECKSUM (ETL_USING_SIMD_CHECKSUM == 0)
+#define ETL_NOT_USING_SIMD_BLOOM_FILTER (ETL_USING_SIMD_BLOOM_FILTER == 0)
+
+namespace etl
+{
+  namespace traits
+  {
+    // Documentation: https://www.etlcpp.com/etl_traits.html
+
+    static ETL_CONSTANT bool using_sse2              = (ETL_USING_SSE2 == 1);
+    static ETL_CONSTANT bool using_avx2              = (ETL_USING_AVX2 == 1);
+    static ETL_CONSTANT bool using_sse4_2            = (ETL_USING_SSE4_2 == 1);
+    static ETL_CONSTANT bool using_pclmul            = (ETL_USING_PCLMUL == 1);
+    static ETL_CONSTANT bool using_neon              = (ETL_USING_NEON == 1);
+    static ETL_CONSTANT bool using_simd_algorithms   = (ETL_USING_SIMD_ALGORITHMS == 1);
+    static ETL_CONSTANT bool using_simd_crc          = (ETL_USING_SIMD_CRC == 1);
+    static ETL_CONSTANT bool using_simd_checksum     = (ETL_USING_SIMD_CHECKSUM == 1);
+    static ETL_CONSTANT bool using_simd_bloom_filter = (ETL_USING_SIMD_BLOOM_FILTER == 1);
+  } // namespace traits
+} // namespace etl
+
+#endif
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "vector.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_merge.h"
 
 #include <stddef.h>
 
@@ -438,10 +439,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted to the
+    /// reference_flat_multiset. No comparisons are made.
+    /// If asserts or exceptions are enabled, emits reference_flat_multiset_full
+    /// if the reference_flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        ETL_ASSERT_OR_RETURN(!lookup.full(), ETL_ERROR(flat_multiset_full));
+        append(*first);
         ++first;
       }
     }
@@ -492,20 +509,35 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multiset.
+    /// The values are appended, sorted and merged in place with the existing
+    /// ones, without allocating, in O(N log N) rather than O(N) per value.
+    /// The unused capacity is the scratch space for the sort. If less than
+    /// half of the range fits, it is up to O(N log^2 N). Equivalent values keep
+    /// their order and are placed after those already present.
     /// If asserts or exceptions are enabled, emits reference_flat_multiset_full
     /// if the reference_flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_type n_sorted = size();
+
       while (first != last)
       {
-        insert(*first);
+        if (lookup.full())
+        {
+          merge_appended(n_sorted);
+          ETL_ASSERT_FAIL(ETL_ERROR(flat_multiset_full));
+          return;
+        }
+
+        append(*first);
         ++first;
       }
+
+      merge_appended(n_sorted);
     }
 
     //*********************************************************************
@@ -890,6 +922,30 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// Must be followed by a call to merge_appended.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n_sorted' and merges them
+    /// with those before.
+    //*********************************************************************
+    void merge_appended(size_type n_sorted)
+    {
+      typename lookup_t::iterator middle = lookup.begin() + difference_type(n_sorted);
+
+      // The unused capacity of the lookup is the scratch buffer.
+      typename lookup_t::pointer scratch = lookup.data() + lookup.size();
+
+      etl::private_flat::merge_equivalent(lookup.begin(), middle, lookup.end(), scratch, lookup.data() + lookup.capacity(),
+                                          etl::private_flat::indirect_compare<TKeyCompare>(compare));
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_set.
     ///\param i_element The place to insert.
@@ -991,6 +1047,20 @@ namespace etl
       ireference_flat_multiset<TKey, TKeyCompare>::assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted.
+    /// The values are referenced where they are, without sorting.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    reference_flat_multiset(etl::sorted_equivalent_t tag, TIterator first, TIterator last)
+      : ireference_flat_multiset<TKey, TKeyCompare>(lookup)
+    {
+      ireference_flat_multiset<TKey, TKeyCompare>::assign(tag, first, last);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
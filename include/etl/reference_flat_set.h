@@ -44,6 +44,7 @@ SOFTWARE.
 #include "vector.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_merge.h"
 
 #include <stddef.h>
 
@@ -434,10 +435,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted and free of
+    /// duplicates to the reference_flat_set. No comparisons are made.
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if
+    /// the reference_flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        ETL_ASSERT_OR_RETURN(!lookup.full(), ETL_ERROR(flat_set_full));
+        append(*first);
         ++first;
       }
     }
@@ -469,20 +486,43 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The values are appended, sorted and merged in place with the existing
+    /// ones, without allocating, in O(N log N) rather than O(N) per value.
+    /// The unused capacity is the scratch space for the sort. If less than
+    /// half of the range fits, it is up to O(N log^2 N).
+    /// If a key is repeated in the range then the first one is inserted.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if
     /// the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      size_type n_sorted = size();
+
       while (first != last)
       {
-        insert(*first);
+        if (lookup.full())
+        {
+          // Make room by dropping the appended values that are duplicates.
+          erase_last(merge_appended(n_sorted));
+          n_sorted = size();
+
+          if (lookup.full())
+          {
+            // Only a value that is already present can be accepted.
+            ETL_ASSERT_OR_RETURN(find(*first) != end(), ETL_ERROR(flat_set_full));
+            ++first;
+            continue;
+          }
+        }
+
+        append(*first);
         ++first;
       }
+
+      erase_last(merge_appended(n_sorted));
     }
 
     //*********************************************************************
@@ -870,6 +910,40 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// Must be followed by a call to merge_appended.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n_sorted' and merges them
+    /// with those before. Appended values that are already present, or that
+    /// repeat an earlier appended value, are moved to the end of the lookup.
+    ///\return The number of values moved to the end.
+    //*********************************************************************
+    size_type merge_appended(size_type n_sorted)
+    {
+      typename lookup_t::iterator middle = lookup.begin() + difference_type(n_sorted);
+
+      // The unused capacity of the lookup is the scratch buffer.
+      typename lookup_t::pointer scratch = lookup.data() + lookup.size();
+
+      return etl::private_flat::merge_unique(lookup.begin(), middle, lookup.end(), scratch, lookup.data() + lookup.capacity(),
+                                             etl::private_flat::indirect_compare<TKeyCompare>(compare));
+    }
+
+    //*********************************************************************
+    /// Removes the last 'n' values from the lookup.
+    //*********************************************************************
+    void erase_last(size_type n)
+    {
+      lookup.erase(lookup.end() - difference_type(n), lookup.end());
+    }
+
     //*********************************************************************
     /// Inserts a value to the reference_flat_set.
     ///\param i_element The place to insert.
@@ -975,6 +1049,20 @@ namespace etl
       ireference_flat_set<TKey, TKeyCompare>::assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and free of
+    /// duplicates. The values are referenced where they are, without sorting.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    reference_flat_set(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : ireference_flat_set<TKey, TKeyCompare>(lookup)
+    {
+      ireference_flat_set<TKey, TKeyCompare>::assign(tag, first, last);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
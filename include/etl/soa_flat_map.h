@@ -0,0 +1,1844 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_MAP_INCLUDED
+#define ETL_SOA_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "memory.h"
+#include "nth_type.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup soa_flat_map soa_flat_map
+/// A flat_map that stores the keys in one contiguous sorted array and the
+/// mapped values in a parallel array, with the capacity defined at compile
+/// time. Searches touch only the key array, and use a branch free binary
+/// search.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+/// The iterators return a proxy holding references to the key and the value.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_exception : public etl::exception
+  {
+  public:
+
+    soa_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_full : public etl::soa_flat_map_exception
+  {
+  public:
+
+    soa_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_flat_map_exception(ETL_ERROR_TEXT("soa_flat_map:full", ETL_SOA_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_out_of_bounds : public etl::soa_flat_map_exception
+  {
+  public:
+
+    soa_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::soa_flat_map_exception(ETL_ERROR_TEXT("soa_flat_map:bounds", ETL_SOA_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_flat_map
+  {
+    //*************************************************************************
+    /// The reference returned by the iterators.
+    /// Refers to a key and a value held in separate arrays.
+    //*************************************************************************
+    template <typename TFirst, typename TSecond>
+    struct pair_reference
+    {
+      pair_reference(TFirst& first_, TSecond& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      //*********************************
+      /// Converts to a copy of the element.
+      //*********************************
+      template <typename T1, typename T2>
+      operator ETL_OR_STD::pair<T1, T2>() const
+      {
+        return ETL_OR_STD::pair<T1, T2>(first, second);
+      }
+
+      TFirst&  first;
+      TSecond& second;
+
+    private:
+
+      pair_reference& operator=(const pair_reference&) ETL_DELETE;
+    };
+
+    //*************************************************************************
+    /// The pointer returned by the iterators.
+    /// Holds the reference, so that operator-> has something to point to.
+    //*************************************************************************
+    template <typename TReference>
+    class pointer_proxy
+    {
+    public:
+
+      explicit pointer_proxy(const TReference& reference_)
+        : reference(reference_)
+      {
+      }
+
+      const TReference* operator->() const
+      {
+        return &reference;
+      }
+
+    private:
+
+      TReference reference;
+    };
+  } // namespace private_soa_flat_map
+
+  //***************************************************************************
+  /// The base class for specifically sized soa_flat_maps.
+  /// Can be used as a reference type for all soa_flat_maps containing a
+  /// specific type.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class isoa_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+
+    typedef private_soa_flat_map::pair_reference<const TKey, TMapped>       reference;
+    typedef private_soa_flat_map::pair_reference<const TKey, const TMapped> const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef private_soa_flat_map::pointer_proxy<reference>       pointer;
+    typedef private_soa_flat_map::pointer_proxy<const_reference> const_pointer;
+    typedef size_t                                               size_type;
+    typedef ptrdiff_t                                            difference_type;
+
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, pointer, reference>
+    {
+    public:
+
+      friend class isoa_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      reference operator*() const
+      {
+        return reference(*p_key, *p_mapped);
+      }
+
+      pointer operator->() const
+      {
+        return pointer(operator*());
+      }
+
+      reference operator[](difference_type n) const
+      {
+        return reference(p_key[n], p_mapped[n]);
+      }
+
+      iterator& operator++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator--()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      iterator operator--(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator+=(difference_type n)
+      {
+        p_key += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      iterator& operator-=(difference_type n)
+      {
+        p_key -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend iterator operator+(iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      friend iterator operator+(difference_type n, iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      friend iterator operator-(iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      friend difference_type operator-(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key != rhs.p_key;
+      }
+
+      friend bool operator<(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator>(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs.p_key < lhs.p_key;
+      }
+
+      friend bool operator<=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs.p_key < lhs.p_key);
+      }
+
+      friend bool operator>=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs.p_key < rhs.p_key);
+      }
+
+    private:
+
+      iterator(TKey* p_key_, TMapped* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      TKey*    p_key;
+      TMapped* p_mapped;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class isoa_flat_map;
+
+      const_iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename isoa_flat_map::iterator& other)
+        : p_key(other.p_key)
+        , p_mapped(other.p_mapped)
+      {
+      }
+
+      const_reference operator*() const
+      {
+        return const_reference(*p_key, *p_mapped);
+      }
+
+      const_pointer operator->() const
+      {
+        return const_pointer(operator*());
+      }
+
+      const_reference operator[](difference_type n) const
+      {
+        return const_reference(p_key[n], p_mapped[n]);
+      }
+
+      const_iterator& operator++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator+=(difference_type n)
+      {
+        p_key += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      const_iterator& operator-=(difference_type n)
+      {
+        p_key -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend const_iterator operator+(const_iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      friend const_iterator operator+(difference_type n, const_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      friend const_iterator operator-(const_iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key != rhs.p_key;
+      }
+
+      friend bool operator<(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator>(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs.p_key < lhs.p_key;
+      }
+
+      friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs.p_key < lhs.p_key);
+      }
+
+      friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs.p_key < rhs.p_key);
+      }
+
+    private:
+
+      const_iterator(const TKey* p_key_, const TMapped* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      const TKey*    p_key;
+      const TMapped* p_mapped;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the soa_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(p_keys, p_mapped);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the soa_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(p_keys, p_mapped);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the soa_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(p_keys + current_size, p_mapped + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the soa_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(p_keys + current_size, p_mapped + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the soa_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the soa_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the soa_flat_map.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the
+    /// soa_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the soa_flat_map.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the soa_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the
+    /// soa_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the soa_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      size_type index = lower_bound_index(key);
+
+      // Doesn't already exist?
+      if ((index == current_size) || compare(key, p_keys[index]))
+      {
+        insert_at(index, etl::move(key), mapped_type());
+      }
+
+      return p_mapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      size_type index = lower_bound_index(key);
+
+      // Doesn't already exist?
+      if ((index == current_size) || compare(key, p_keys[index]))
+      {
+        insert_at(index, key, mapped_type());
+      }
+
+      return p_mapped[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::soa_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_type index = find_index(key);
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_bounds));
+
+      return p_mapped[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_type index = find_index(key);
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_bounds));
+
+      return p_mapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::soa_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_type index = find_index(key);
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_bounds));
+
+      return p_mapped[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_type index = find_index(key);
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_bounds));
+
+      return p_mapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(soa_flat_map_full));
+#endif
+
+      clear();
+
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Assigns values from a range that is already sorted and free of
+    /// duplicate keys to the soa_flat_map.
+    /// The keys and mapped values are copied to the end of the arrays, with
+    /// no searches or moves.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(soa_flat_map_full));
+
+        ::new (p_keys + current_size) key_type((*first).first);
+        ::new (p_mapped + current_size) mapped_type((*first).second);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      size_type index = lower_bound_index(value.first);
+
+      if ((index != current_size) && !compare(value.first, p_keys[index]))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      const bool inserted = insert_at(index, value.first, value.second);
+
+      return ETL_OR_STD::pair<iterator, bool>(inserted ? make_iterator(index) : end(), inserted);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      size_type index = lower_bound_index(value.first);
+
+      if ((index != current_size) && !compare(value.first, p_keys[index]))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      const bool inserted = insert_at(index, etl::move(const_cast<key_type&>(value.first)), etl::move(value.second));
+
+      return ETL_OR_STD::pair<iterator, bool>(inserted ? make_iterator(index) : end(), inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the
+    /// soa_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const value_type& value)
+    {
+      return insert(value);
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, Args&&... args)
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index != current_size) && !compare(key, p_keys[index]))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(soa_flat_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      make_gap(index);
+      ::new (p_keys + index) key_type(key);
+      ::new (p_mapped + index) mapped_type(etl::forward<Args>(args)...);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), true);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1)
+    {
+      return emplace_mapped(key, mapped_type(value1));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2)
+    {
+      return emplace_mapped(key, mapped_type(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace_mapped(key, mapped_type(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the soa_flat_map.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace_mapped(key, mapped_type(value1, value2, value3, value4));
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0;
+      }
+      else
+      {
+        erase_at(index, 1U);
+        return 1;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0;
+      }
+      else
+      {
+        erase_at(index, 1U);
+        return 1;
+      }
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      size_type index = size_type(i_element.p_key - p_keys);
+      erase_at(index, 1U);
+
+      return make_iterator(index);
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      size_type index = size_type(i_element.p_key - p_keys);
+      erase_at(index, 1U);
+
+      return make_iterator(index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including
+    /// the element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_type index = size_type(first.p_key - p_keys);
+      erase_at(index, size_type(last.p_key - first.p_key));
+
+      return make_iterator(index);
+    }
+
+    //*************************************************************************
+    /// Clears the soa_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_keys, p_keys + current_size);
+      etl::destroy(p_mapped, p_mapped + current_size);
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return make_iterator(find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_iterator(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return make_iterator(find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key) == current_size) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) == current_size) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return make_iterator(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return make_iterator(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<iterator, iterator>(make_iterator(first), make_iterator(last));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<iterator, iterator>(make_iterator(first), make_iterator(last));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(make_iterator(first), make_iterator(last));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(make_iterator(first), make_iterator(last));
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find_index(k) != current_size;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns a pointer to the sorted array of keys.
+    //*************************************************************************
+    const key_type* keys() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the array of mapped values, in key order.
+    //*************************************************************************
+    mapped_type* values()
+    {
+      return p_mapped;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the array of mapped values, in key order.
+    //*************************************************************************
+    const mapped_type* values() const
+    {
+      return p_mapped;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isoa_flat_map& operator=(const isoa_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_container(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    isoa_flat_map& operator=(isoa_flat_map&& rhs)
+    {
+      move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the soa_flat_map.
+    ///\return The current size of the soa_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the soa_flat_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the soa_flat_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the soa_flat_map.
+    ///\return The capacity of the soa_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the soa_flat_map.
+    ///\return The maximum size of the soa_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    isoa_flat_map(TKey* p_keys_, TMapped* p_mapped_, size_type max_size_)
+      : p_keys(p_keys_)
+      , p_mapped(p_mapped_)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy a soa_flat_map.
+    /// The keys are already in order, so are copied directly.
+    //*************************************************************************
+    void copy_container(const isoa_flat_map& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(soa_flat_map_full));
+
+      clear();
+
+      etl::uninitialized_copy(rhs.p_keys, rhs.p_keys + rhs.current_size, p_keys);
+      etl::uninitialized_copy(rhs.p_mapped, rhs.p_mapped + rhs.current_size, p_mapped);
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+    }
+
+    //*************************************************************************
+    /// Takes ownership of the first 'n' elements already constructed in the
+    /// key and mapped buffers. The keys must be sorted and unique.
+    //*************************************************************************
+    void adopt(size_type n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= CAPACITY, ETL_ERROR(soa_flat_map_full));
+
+      clear();
+
+      current_size = n;
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move a soa_flat_map.
+    /// The elements are moved and the source is cleared.
+    //*************************************************************************
+    void move_container(isoa_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(soa_flat_map_full));
+
+        clear();
+
+        for (size_type i = 0U; i < rhs.current_size; ++i)
+        {
+          ::new (p_keys + i) key_type(etl::move(rhs.p_keys[i]));
+          ::new (p_mapped + i) mapped_type(etl::move(rhs.p_mapped[i]));
+        }
+
+        current_size = rhs.current_size;
+        ETL_ADD_DEBUG_COUNT(current_size);
+        rhs.clear();
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    isoa_flat_map(const isoa_flat_map&);
+
+    //*********************************************************************
+    iterator make_iterator(size_type index)
+    {
+      return iterator(p_keys + index, p_mapped + index);
+    }
+
+    //*********************************************************************
+    const_iterator make_iterator(size_type index) const
+    {
+      return const_iterator(p_keys + index, p_mapped + index);
+    }
+
+    //*********************************************************************
+    /// The index of the first key not less than the key, searching only
+    /// the key array.
+    /// The search range is halved on every step whatever the result of the
+    /// comparison, so that the compiler can select the next base without
+    /// a branch.
+    //*********************************************************************
+    template <typename K>
+    size_type lower_bound_index(const K& key) const
+    {
+      const TKey* base = p_keys;
+      size_type   n    = current_size;
+
+      while (n > 1U)
+      {
+        const size_type half = n / 2U;
+        base                 = compare(base[half], key) ? base + half : base;
+        n -= half;
+      }
+
+      return size_type(base - p_keys) + (((n != 0U) && compare(*base, key)) ? 1U : 0U);
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than the key.
+    //*********************************************************************
+    template <typename K>
+    size_type upper_bound_index(const K& key) const
+    {
+      const TKey* base = p_keys;
+      size_type   n    = current_size;
+
+      while (n > 1U)
+      {
+        const size_type half = n / 2U;
+        base                 = compare(key, base[half]) ? base : base + half;
+        n -= half;
+      }
+
+      return size_type(base - p_keys) + (((n != 0U) && !compare(key, *base)) ? 1U : 0U);
+    }
+
+    //*********************************************************************
+    /// The index of the key, or size() if not found.
+    //*********************************************************************
+    template <typename K>
+    size_type find_index(const K& key) const
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index != current_size) && compare(key, p_keys[index]))
+      {
+        index = current_size;
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Opens an unconstructed slot at the index, in both arrays.
+    //*********************************************************************
+    void make_gap(size_type index)
+    {
+      if (index != current_size)
+      {
+        const size_type back = current_size - 1U;
+
+        ::new (p_keys + current_size) key_type(ETL_MOVE(p_keys[back]));
+        ::new (p_mapped + current_size) mapped_type(ETL_MOVE(p_mapped[back]));
+
+        etl::move_backward(p_keys + index, p_keys + back, p_keys + current_size);
+        etl::move_backward(p_mapped + index, p_mapped + back, p_mapped + current_size);
+
+        etl::destroy_at(p_keys + index);
+        etl::destroy_at(p_mapped + index);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename TK, typename TM>
+    bool insert_at(size_type index, TK&& key, TM&& mapped)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(soa_flat_map_full));
+        return false;
+      }
+
+      make_gap(index);
+      ::new (p_keys + index) key_type(etl::forward<TK>(key));
+      ::new (p_mapped + index) mapped_type(etl::forward<TM>(mapped));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return true;
+    }
+#else
+    //*********************************************************************
+    bool insert_at(size_type index, const_key_reference key, const mapped_type& mapped)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(soa_flat_map_full));
+        return false;
+      }
+
+      make_gap(index);
+      ::new (p_keys + index) key_type(key);
+      ::new (p_mapped + index) mapped_type(mapped);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return true;
+    }
+
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace_mapped(const_key_reference key, const mapped_type& mapped)
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index != current_size) && !compare(key, p_keys[index]))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      const bool inserted = insert_at(index, key, mapped);
+
+      return ETL_OR_STD::pair<iterator, bool>(inserted ? make_iterator(index) : end(), inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases 'n' elements from the index, closing the gap.
+    //*********************************************************************
+    void erase_at(size_type index, size_type n)
+    {
+      etl::move(p_keys + index + n, p_keys + current_size, p_keys + index);
+      etl::move(p_mapped + index + n, p_mapped + current_size, p_mapped + index);
+
+      etl::destroy(p_keys + current_size - n, p_keys + current_size);
+      etl::destroy(p_mapped + current_size - n, p_mapped + current_size);
+
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+    }
+
+    TKey*           p_keys;       ///< The sorted keys.
+    TMapped*        p_mapped;     ///< The mapped values, parallel to the keys.
+    size_type       current_size; ///< The number of elements.
+    const size_type CAPACITY;     ///< The maximum number of elements.
+    TKeyCompare     compare;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SOA_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~isoa_flat_map() {}
+#else
+
+  protected:
+
+    ~isoa_flat_map() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first soa_flat_map.
+  ///\param rhs Reference to the second soa_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator==(const etl::isoa_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::isoa_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first soa_flat_map.
+  ///\param rhs Reference to the second soa_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator!=(const etl::isoa_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::isoa_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A soa_flat_map implementation that uses fixed size buffers.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class soa_flat_map : public etl::isoa_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::isoa_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_map()
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_map(const soa_flat_map& other)
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+      base::copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_flat_map(soa_flat_map&& other)
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+      base::move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map(TIterator first, TIterator last)
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+      base::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and free of
+    /// duplicate keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+      base::assign(tag, first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    soa_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(key_buffer.begin(), mapped_buffer.begin(), MAX_SIZE)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_map& operator=(const soa_flat_map& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_flat_map& operator=(soa_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::uninitialized_buffer_of<TKey, MAX_SIZE_> key_buffer;
+
+    /// The mapped values.
+    etl::uninitialized_buffer_of<TValue, MAX_SIZE_> mapped_buffer;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t soa_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  soa_flat_map(TPairs...)
+    -> soa_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type, typename etl::nth_type_t<0, TPairs...>::second_type, sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_soa_flat_map(TPairs&&... pairs) -> etl::soa_flat_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+
+  //***************************************************************************
+  /// A soa_flat_map implementation that uses external buffers.
+  /// The key buffer must hold max_size keys and the mapped buffer max_size
+  /// mapped values.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The value type.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class soa_flat_map_ext : public etl::isoa_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::isoa_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_map_ext(void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_map_ext(const soa_flat_map_ext& other, void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_flat_map_ext(soa_flat_map_ext&& other, void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map_ext(TIterator first, TIterator last, void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and free of
+    /// duplicate keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map_ext(etl::sorted_unique_t tag, TIterator first, TIterator last, void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::assign(tag, first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, adopting the elements already in the buffers.
+    /// The first 'initial_size' keys and mapped values in the buffers must
+    /// already be constructed, with the keys sorted and unique. They are used
+    /// where they are, with no copies, and are destroyed by the map.
+    //*************************************************************************
+    soa_flat_map_ext(etl::sorted_unique_t, void* key_buffer, void* mapped_buffer, size_t initial_size, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::adopt(initial_size);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    soa_flat_map_ext(std::initializer_list<typename base::value_type> init, void* key_buffer, void* mapped_buffer, size_t max_size)
+      : base(reinterpret_cast<TKey*>(key_buffer), reinterpret_cast<TValue*>(mapped_buffer), max_size)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_map_ext()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_map_ext& operator=(const soa_flat_map_ext& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_flat_map_ext& operator=(soa_flat_map_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    // Disable copy construction without buffers.
+    soa_flat_map_ext(const soa_flat_map_ext&) ETL_DELETE;
+  };
+} // namespace etl
+
+#endif
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "iterator.h"
 #include "memory.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #if ETL_USING_STL && ETL_USING_CPP17
@@ -547,21 +548,14 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      if ((size() < view.size()))
+      if ((position > size()) || ((size() - position) < view.size()))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const size_type result = private_string_search::search(mbegin + position, size() - position, view.data(), view.size());
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return static_cast<size_type>(etl::distance(begin(), iposition));
-      }
+      return (result == private_string_search::Npos) ? npos : position + result;
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -589,18 +583,9 @@ namespace etl
         return npos;
       }
 
-      position = etl::min(position, size());
+      const size_type result = private_string_search::reverse_search(mbegin, etl::min(position, size()), view.data(), view.size());
 
-      const_iterator iposition = etl::find_end(begin(), begin() + position, view.begin(), view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return static_cast<size_type>(etl::distance(begin(), iposition));
-      }
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     ETL_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const ETL_NOEXCEPT
@@ -623,25 +608,9 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
+      const size_type result = private_string_search::find_first_of(mbegin, size(), position, view.data(), view.size(), true);
 
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -664,32 +633,9 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const ETL_NOEXCEPT
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<ptrdiff_t>(size() - position - 1);
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
+      const size_type result = private_string_search::find_last_of(mbegin, size(), position, view.data(), view.size(), true);
 
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const ETL_NOEXCEPT
@@ -712,33 +658,9 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
+      const size_type result = private_string_search::find_first_of(mbegin, size(), position, view.data(), view.size(), false);
 
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -761,40 +683,9 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const ETL_NOEXCEPT
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<ptrdiff_t>(size() - position - 1);
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-            break;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
+      const size_type result = private_string_search::find_last_of(mbegin, size(), position, view.data(), view.size(), false);
 
-      return npos;
+      return (result == private_string_search::Npos) ? npos : result;
     }
 
     ETL_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const ETL_NOEXCEPT
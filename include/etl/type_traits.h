@@ -2545,8 +2545,19 @@ namespace etl
 #if ETL_USING_CPP11
   //***************************************************************************
   /// are_all_same
+  /// Compares the results as one pack, rather than recursing over them, so
+  /// that long lists do not exceed the template instantiation depth.
+  namespace private_type_traits
+  {
+    template <bool...>
+    struct bool_pack
+    {
+    };
+  } // namespace private_type_traits
+
   template <typename T, typename... TRest>
-  struct are_all_same : etl::conjunction<etl::is_same<T, TRest>...>
+  struct are_all_same
+    : etl::is_same<private_type_traits::bool_pack<true, etl::is_same<T, TRest>::value...>, private_type_traits::bool_pack<etl::is_same<T, TRest>::value..., true>>
   {
   };
 #endif
@@ -0,0 +1,2191 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "functional.h"
+#include "hash.h"
+#include "initializer_list.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "memory.h"
+#include "nth_type.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_SSE2
+  #include <emmintrin.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Elements are stored inline in an array of slots. A parallel array of one
+/// byte control tags is probed a group at a time, using SSE2 or NEON where
+/// available, otherwise a portable SWAR implementation.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_iterator : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:iterator", ETL_UNORDERED_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_unordered_flat_map
+  {
+    //*************************************************************************
+    /// The values of the control bytes.
+    /// A template, so that the constants may be defined in the header.
+    //*************************************************************************
+    template <typename T = void>
+    struct control_values
+    {
+      static ETL_CONSTANT uint8_t Empty    = 0x80U;
+      static ETL_CONSTANT uint8_t Deleted  = 0xFEU;
+      static ETL_CONSTANT uint8_t Sentinel = 0xFFU; // Pads the last group. Never empty, deleted or full.
+    };
+
+    template <typename T>
+    ETL_CONSTANT uint8_t control_values<T>::Empty;
+
+    template <typename T>
+    ETL_CONSTANT uint8_t control_values<T>::Deleted;
+
+    template <typename T>
+    ETL_CONSTANT uint8_t control_values<T>::Sentinel;
+
+    //*************************************************************************
+    /// The control bytes.
+    /// A full slot holds the low seven bits of the hash, with the top bit clear.
+    //*************************************************************************
+    struct control : public control_values<>
+    {
+      static bool is_full(uint8_t c)
+      {
+        return (c & 0x80U) == 0U;
+      }
+    };
+
+    //*************************************************************************
+    /// A set of matching positions within a group.
+    /// Each position is represented by one set bit, every (1 << Shift) bits.
+    //*************************************************************************
+    template <typename TMask, int Shift>
+    class bitmask
+    {
+    public:
+
+      explicit bitmask(TMask mask_)
+        : mask(mask_)
+      {
+      }
+
+      /// Are there any matches?
+      bool any() const
+      {
+        return mask != 0U;
+      }
+
+      /// The position of the first match.
+      size_t lowest() const
+      {
+        return static_cast<size_t>(etl::count_trailing_zeros(mask) >> Shift);
+      }
+
+      /// Removes the first match.
+      void remove_lowest()
+      {
+        mask &= static_cast<TMask>(mask - 1U);
+      }
+
+      /// The raw mask value.
+      TMask value() const
+      {
+        return mask;
+      }
+
+    private:
+
+      TMask mask;
+    };
+
+    //*************************************************************************
+    /// Portable group, using SWAR techniques on a word of control bytes.
+    //*************************************************************************
+    template <typename TWord>
+    class portable_group
+    {
+    public:
+
+      static ETL_CONSTANT size_t Width = sizeof(TWord);
+
+      typedef bitmask<TWord, 3> mask_type;
+
+      //*********************************
+      explicit portable_group(const uint8_t* pcontrol)
+        : ctrl(0U)
+      {
+        // Assemble in little endian order, so that the lowest bit set is the first position.
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          ctrl |= static_cast<TWord>(pcontrol[i]) << (i * 8U);
+        }
+      }
+
+      //*********************************
+      /// Full positions with the matching hash.
+      /// May report false positives, which are always full slots.
+      //*********************************
+      mask_type match(uint8_t h2) const
+      {
+        const TWord x = ctrl ^ static_cast<TWord>(lsbs() * h2);
+
+        return mask_type(static_cast<TWord>((x - lsbs()) & ~x & msbs()));
+      }
+
+      //*********************************
+      mask_type match_empty() const
+      {
+        return mask_type(static_cast<TWord>(ctrl & ~(ctrl << 6U) & msbs()));
+      }
+
+      //*********************************
+      mask_type match_empty_or_deleted() const
+      {
+        return mask_type(static_cast<TWord>(ctrl & ~(ctrl << 7U) & msbs()));
+      }
+
+      //*********************************
+      mask_type match_full() const
+      {
+        return mask_type(static_cast<TWord>(~ctrl & msbs()));
+      }
+
+    private:
+
+      static TWord lsbs()
+      {
+        return static_cast<TWord>(~TWord(0U) / 0xFFU);
+      }
+
+      static TWord msbs()
+      {
+        return static_cast<TWord>(lsbs() << 7U);
+      }
+
+      TWord ctrl;
+    };
+
+    template <typename TWord>
+    ETL_CONSTANT size_t portable_group<TWord>::Width;
+
+#if ETL_USING_SSE2
+    //*************************************************************************
+    /// SSE2 group of sixteen control bytes.
+    //*************************************************************************
+    class sse2_group
+    {
+    public:
+
+      static ETL_CONSTANT size_t Width = 16U;
+
+      typedef bitmask<uint32_t, 0> mask_type;
+
+      //*********************************
+      explicit sse2_group(const uint8_t* pcontrol)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pcontrol)))
+      {
+      }
+
+      //*********************************
+      mask_type match(uint8_t h2) const
+      {
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl));
+      }
+
+      //*********************************
+      mask_type match_empty() const
+      {
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(control::Empty)), ctrl));
+      }
+
+      //*********************************
+      mask_type match_empty_or_deleted() const
+      {
+        // Empty and Deleted are the only signed values less than Sentinel.
+        return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(control::Sentinel)), ctrl));
+      }
+
+      //*********************************
+      mask_type match_full() const
+      {
+        return mask_type(static_cast<uint32_t>(~_mm_movemask_epi8(ctrl)) & 0xFFFFU);
+      }
+
+    private:
+
+      static mask_type to_mask(__m128i m)
+      {
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(m)));
+      }
+
+      __m128i ctrl;
+    };
+#endif
+
+#if ETL_USING_NEON
+    //*************************************************************************
+    /// NEON group of sixteen control bytes.
+    /// Each position is represented by a nibble in the 64 bit mask.
+    //*************************************************************************
+    class neon_group
+    {
+    public:
+
+      static ETL_CONSTANT size_t Width = 16U;
+
+      typedef bitmask<uint64_t, 2> mask_type;
+
+      //*********************************
+      explicit neon_group(const uint8_t* pcontrol)
+        : ctrl(vld1q_u8(pcontrol))
+      {
+      }
+
+      //*********************************
+      mask_type match(uint8_t h2) const
+      {
+        return to_mask(vceqq_u8(ctrl, vdupq_n_u8(h2)));
+      }
+
+      //*********************************
+      mask_type match_empty() const
+      {
+        return to_mask(vceqq_u8(ctrl, vdupq_n_u8(control::Empty)));
+      }
+
+      //*********************************
+      mask_type match_empty_or_deleted() const
+      {
+        return to_mask(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(-1)));
+      }
+
+      //*********************************
+      mask_type match_full() const
+      {
+        return to_mask(vcgeq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
+      }
+
+    private:
+
+      static mask_type to_mask(uint8x16_t m)
+      {
+        const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+
+        return mask_type(vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ull);
+      }
+
+      uint8x16_t ctrl;
+    };
+#endif
+
+    //*************************************************************************
+    /// The group implementation used by the containers.
+    //*************************************************************************
+#if ETL_USING_SSE2
+    typedef sse2_group group_type;
+#elif ETL_USING_NEON
+    typedef neon_group group_type;
+#elif ETL_USING_64BIT_TYPES
+    typedef portable_group<uint64_t> group_type;
+#else
+    typedef portable_group<uint32_t> group_type;
+#endif
+
+    //*************************************************************************
+    /// Mixes the user supplied hash, so that identity hashes of integral keys
+    /// do not cluster. The top seven bits become the control tag.
+    //*************************************************************************
+    template <size_t Size = sizeof(size_t)>
+    struct hash_mixer;
+
+    template <>
+    struct hash_mixer<2U>
+    {
+      static size_t mix(size_t h)
+      {
+        uint32_t x = static_cast<uint32_t>(h) * 0x9E37U;
+        return static_cast<size_t>((x ^ (x >> 16U)) & 0xFFFFU);
+      }
+    };
+
+    template <>
+    struct hash_mixer<4U>
+    {
+      static size_t mix(size_t h)
+      {
+        uint32_t x = static_cast<uint32_t>(h);
+        x ^= x >> 16U;
+        x *= 0x9E3779B9UL;
+        x ^= x >> 15U;
+        return static_cast<size_t>(x);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct hash_mixer<8U>
+    {
+      static size_t mix(size_t h)
+      {
+        uint64_t x = static_cast<uint64_t>(h);
+        x ^= x >> 32U;
+        x *= 0x9E3779B97F4A7C15ull;
+        x ^= x >> 29U;
+        return static_cast<size_t>(x);
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// The number of control bytes needed for Max_Slots slots.
+    //*************************************************************************
+    template <size_t Max_Slots>
+    struct control_size
+    {
+      static ETL_CONSTANT size_t value = ((Max_Slots + group_type::Width - 1U) / group_type::Width) * group_type::Width;
+    };
+
+    template <size_t Max_Slots>
+    ETL_CONSTANT size_t control_size<Max_Slots>::value;
+  } // namespace private_unordered_flat_map
+
+  //***************************************************************************
+  /// The number of control bytes required by an unordered_flat_map_ext with
+  /// Max_Slots slots.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <size_t Max_Slots>
+  struct unordered_flat_map_control_size : public etl::integral_constant<size_t, private_unordered_flat_map::control_size<Max_Slots>::value>
+  {
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a
+  /// specific type.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    typedef private_unordered_flat_map::control    control_t;
+    typedef private_unordered_flat_map::group_type group_t;
+    typedef typename group_t::mask_type            mask_t;
+
+  public:
+
+    /// The number of control bytes probed at a time.
+    static ETL_CONSTANT size_t Group_Width = group_t::Width;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      typedef typename iunordered_flat_map::value_type      value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pcontrol_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      iterator& operator++()
+      {
+        ++pcontrol;
+        ++pslot;
+        skip_unused();
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator=(const iterator& other)
+      {
+        pcontrol     = other.pcontrol;
+        pcontrol_end = other.pcontrol_end;
+        pslot        = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      reference operator*() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      pointer operator->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pslot == rhs.pslot;
+      }
+
+      //*********************************
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(uint8_t* pcontrol_, uint8_t* pcontrol_end_, value_type* pslot_)
+        : pcontrol(pcontrol_)
+        , pcontrol_end(pcontrol_end_)
+        , pslot(pslot_)
+      {
+        skip_unused();
+      }
+
+      //*********************************
+      /// Moves forward to the next full slot, or the end.
+      //*********************************
+      void skip_unused()
+      {
+        while ((pcontrol != pcontrol_end) && !control_t::is_full(*pcontrol))
+        {
+          ++pcontrol;
+          ++pslot;
+        }
+      }
+
+      uint8_t*    pcontrol;
+      uint8_t*    pcontrol_end;
+      value_type* pslot;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      typedef typename iunordered_flat_map::value_type      value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pcontrol_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator++()
+      {
+        ++pcontrol;
+        ++pslot;
+        skip_unused();
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator=(const const_iterator& other)
+      {
+        pcontrol     = other.pcontrol;
+        pcontrol_end = other.pcontrol_end;
+        pslot        = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator*() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      const_pointer operator->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pslot == rhs.pslot;
+      }
+
+      //*********************************
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const uint8_t* pcontrol_, const uint8_t* pcontrol_end_, const value_type* pslot_)
+        : pcontrol(pcontrol_)
+        , pcontrol_end(pcontrol_end_)
+        , pslot(pslot_)
+      {
+        skip_unused();
+      }
+
+      //*********************************
+      /// Moves forward to the next full slot, or the end.
+      //*********************************
+      void skip_unused()
+      {
+        while ((pcontrol != pcontrol_end) && !control_t::is_full(*pcontrol))
+        {
+          ++pcontrol;
+          ++pslot;
+        }
+      }
+
+      const uint8_t*    pcontrol;
+      const uint8_t*    pcontrol_end;
+      const value_type* pslot;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(pcontrol, pcontrol + number_of_slots, pslots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(pcontrol, pcontrol + number_of_slots, pslots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(pcontrol, pcontrol + number_of_slots, pslots);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return make_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return make_const_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return make_const_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots, each of which may hold one element.
+    ///\return The number of slots.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots.
+    ///\return The maximum number of slots.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      probe_result result = find_or_prepare_insert(key);
+
+      if (!result.found)
+      {
+        ETL_ASSERT(result.index != npos, ETL_ERROR(unordered_flat_map_full));
+
+        if (result.index == npos)
+        {
+          return value_at(npos);
+        }
+
+        ::new ((void*)etl::addressof(pslots[result.index].first)) key_type(etl::move(key));
+        ::new ((void*)etl::addressof(pslots[result.index].second)) mapped_type();
+        set_full(result);
+      }
+
+      return pslots[result.index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      probe_result result = find_or_prepare_insert(key);
+
+      if (!result.found)
+      {
+        ETL_ASSERT(result.index != npos, ETL_ERROR(unordered_flat_map_full));
+
+        if (result.index == npos)
+        {
+          return value_at(npos);
+        }
+
+        ::new ((void*)etl::addressof(pslots[result.index].first)) key_type(key);
+        ::new ((void*)etl::addressof(pslots[result.index].second)) mapped_type();
+        set_full(result);
+      }
+
+      return pslots[result.index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference operator[](const K& key)
+    {
+      probe_result result = find_or_prepare_insert(key);
+
+      if (!result.found)
+      {
+        ETL_ASSERT(result.index != npos, ETL_ERROR(unordered_flat_map_full));
+
+        if (result.index == npos)
+        {
+          return value_at(npos);
+        }
+
+        ::new ((void*)etl::addressof(pslots[result.index].first)) key_type(key);
+        ::new ((void*)etl::addressof(pslots[result.index].second)) mapped_type();
+        set_full(result);
+      }
+
+      return pslots[result.index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != npos, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return value_at(index);
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != npos, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return value_at(index);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != npos, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return value_at(index);
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != npos, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return value_at(index);
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map does not have enough free space. If asserts or exceptions
+    /// are enabled, emits unordered_flat_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      probe_result result = find_or_prepare_insert(key_value_pair.first);
+
+      if (result.found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), false);
+      }
+
+      ETL_ASSERT(result.index != npos, ETL_ERROR(unordered_flat_map_full));
+
+      if (result.index == npos)
+      {
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      ::new ((void*)(pslots + result.index)) value_type(key_value_pair);
+      set_full(result);
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      probe_result result = find_or_prepare_insert(key_value_pair.first);
+
+      if (result.found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), false);
+      }
+
+      ETL_ASSERT(result.index != npos, ETL_ERROR(unordered_flat_map_full));
+
+      if (result.index == npos)
+      {
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      ::new ((void*)(pslots + result.index)) value_type(etl::move(key_value_pair));
+      set_full(result);
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the
+    /// unordered_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = find_index(key);
+
+      if (index != npos)
+      {
+        erase_at(index);
+        return 1U;
+      }
+
+      return 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t index = find_index(key);
+
+      if (index != npos)
+      {
+        erase_at(index);
+        return 1U;
+      }
+
+      return 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Other iterators are not invalidated.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = static_cast<size_t>(ielement.pslot - pslots);
+
+      erase_at(index);
+
+      return make_iterator(index + 1U);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including
+    /// the element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == cbegin()) && (last_ == cend()))
+      {
+        clear();
+        return end();
+      }
+
+      while (first_ != last_)
+      {
+        first_ = erase(first_);
+      }
+
+      return make_iterator(static_cast<size_t>(last_.pslot - pslots));
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key) == npos) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) == npos) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index_or_end(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_const_iterator(find_index_or_end(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return make_iterator(find_index_or_end(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return make_const_iterator(find_index_or_end(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != npos;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != npos;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_map(value_type* pslots_, uint8_t* pcontrol_, size_t number_of_slots_, size_t maximum_size_, hasher key_hash_function_,
+                        key_equal key_equal_function_)
+      : pslots(pslots_)
+      , pcontrol(pcontrol_)
+      , number_of_slots(number_of_slots_)
+      , number_of_groups((number_of_slots_ + Group_Width - 1U) / Group_Width)
+      , maximum_size(maximum_size_)
+      , current_size(0U)
+      , number_of_deleted(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      reset_control();
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        if ETL_IF_CONSTEXPR (!etl::is_trivially_destructible<value_type>::value)
+        {
+          for (size_t i = 0U; i < number_of_slots; ++i)
+          {
+            if (control_t::is_full(pcontrol[i]))
+            {
+              pslots[i].~value_type();
+            }
+          }
+        }
+
+        ETL_SUBTRACT_DEBUG_COUNT(int32_t(current_size));
+      }
+
+      reset_control();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        iterator temp = b;
+        ++temp;
+        insert(etl::move(*b));
+        b = temp;
+      }
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    //*********************************************************************
+    /// The result of probing for a key.
+    //*********************************************************************
+    struct probe_result
+    {
+      size_t  index;
+      uint8_t h2;
+      bool    found;
+    };
+
+    //*********************************************************************
+    /// Hash values split into the group to start probing from and the tag.
+    //*********************************************************************
+    template <typename K>
+    size_t get_hash(const K& key) const
+    {
+      return private_unordered_flat_map::hash_mixer<>::mix(key_hash_function(key));
+    }
+
+    static uint8_t h2_of(size_t hash)
+    {
+      return static_cast<uint8_t>(hash & 0x7FU);
+    }
+
+    size_t home_group_of(size_t hash) const
+    {
+      return (hash >> 7U) % number_of_groups;
+    }
+
+    //*********************************************************************
+    /// Sets all slots to empty, and the padding to sentinel.
+    //*********************************************************************
+    void reset_control()
+    {
+      const size_t control_size = number_of_groups * Group_Width;
+
+      etl::fill_n(pcontrol, number_of_slots, control_t::Empty);
+      etl::fill_n(pcontrol + number_of_slots, control_size - number_of_slots, control_t::Sentinel);
+
+      current_size      = 0U;
+      number_of_deleted = 0U;
+    }
+
+    //*********************************************************************
+    /// Returns the value in the slot at 'index'.
+    /// operator[] and at() return this for npos if asserts are disabled and
+    /// the key could not be inserted or found. Slot 0 always exists, so the
+    /// reference is then to valid storage.
+    //*********************************************************************
+    mapped_reference value_at(size_t index)
+    {
+      return pslots[(index != npos) ? index : 0U].second;
+    }
+
+    //*********************************************************************
+    /// Returns the value in the slot at 'index'. See above.
+    //*********************************************************************
+    const_mapped_reference value_at(size_t index) const
+    {
+      return pslots[(index != npos) ? index : 0U].second;
+    }
+
+    //*********************************************************************
+    /// Finds the slot index of the key, or npos.
+    //*********************************************************************
+    template <typename K>
+    size_t find_index(const K& key) const
+    {
+      const size_t  hash  = get_hash(key);
+      const uint8_t h2    = h2_of(hash);
+      size_t        group = home_group_of(hash);
+
+      for (size_t probe = 0U; probe < number_of_groups; ++probe)
+      {
+        const size_t  first_slot = group * Group_Width;
+        const group_t g(pcontrol + first_slot);
+
+        mask_t matches = g.match(h2);
+
+        while (matches.any())
+        {
+          const size_t index = first_slot + matches.lowest();
+
+          if (key_equal_function(key, pslots[index].first))
+          {
+            return index;
+          }
+
+          matches.remove_lowest();
+        }
+
+        // An empty slot terminates the search.
+        if (g.match_empty().any())
+        {
+          break;
+        }
+
+        if (++group == number_of_groups)
+        {
+          group = 0U;
+        }
+      }
+
+      return npos;
+    }
+
+    //*********************************************************************
+    /// Finds the slot index of the key, or number_of_slots.
+    //*********************************************************************
+    template <typename K>
+    size_t find_index_or_end(const K& key) const
+    {
+      size_t index = find_index(key);
+
+      return (index == npos) ? number_of_slots : index;
+    }
+
+    //*********************************************************************
+    /// Finds the first empty or deleted slot in the probe sequence.
+    //*********************************************************************
+    size_t find_first_non_full(size_t hash) const
+    {
+      size_t group = home_group_of(hash);
+
+      for (size_t probe = 0U; probe < number_of_groups; ++probe)
+      {
+        const size_t first_slot = group * Group_Width;
+
+        mask_t available_slots = group_t(pcontrol + first_slot).match_empty_or_deleted();
+
+        if (available_slots.any())
+        {
+          return first_slot + available_slots.lowest();
+        }
+
+        if (++group == number_of_groups)
+        {
+          group = 0U;
+        }
+      }
+
+      return npos;
+    }
+
+    //*********************************************************************
+    /// Finds the key, or the slot where it should be inserted.
+    /// The result index is npos if the key was not found and the map is full.
+    //*********************************************************************
+    template <typename K>
+    probe_result find_or_prepare_insert(const K& key)
+    {
+      probe_result result;
+
+      const size_t hash = get_hash(key);
+
+      result.h2    = h2_of(hash);
+      result.index = find_index(key);
+      result.found = (result.index != npos);
+
+      if (!result.found)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+        if (!full())
+        {
+          // Too many tombstones lengthen the probe sequences, so clean them up.
+          if (number_of_deleted > (number_of_slots / 8U))
+          {
+            rehash_in_place();
+          }
+
+          result.index = find_first_non_full(hash);
+        }
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Marks a newly constructed slot as full.
+    //*********************************************************************
+    void set_full(const probe_result& result)
+    {
+      if (pcontrol[result.index] == control_t::Deleted)
+      {
+        --number_of_deleted;
+      }
+
+      pcontrol[result.index] = result.h2;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Destroys the element at index.
+    //*********************************************************************
+    void erase_at(size_t index)
+    {
+      pslots[index].~value_type();
+
+      // If the slot's group has never been full, no probe sequence can have
+      // passed through it, so the slot can be marked empty rather than deleted.
+      const size_t first_slot = (index / Group_Width) * Group_Width;
+
+      if (group_t(pcontrol + first_slot).match_empty().any())
+      {
+        pcontrol[index] = control_t::Empty;
+      }
+      else
+      {
+        pcontrol[index] = control_t::Deleted;
+        ++number_of_deleted;
+      }
+
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Reinserts all of the elements to remove the deleted markers.
+    /// Uses no extra storage other than one temporary element.
+    //*********************************************************************
+    void rehash_in_place()
+    {
+      // Deleted becomes Empty, Full becomes Deleted.
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        pcontrol[i] = control_t::is_full(pcontrol[i]) ? control_t::Deleted : control_t::Empty;
+      }
+
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        if (pcontrol[i] != control_t::Deleted)
+        {
+          continue;
+        }
+
+        const size_t hash   = get_hash(pslots[i].first);
+        const size_t home   = home_group_of(hash);
+        const size_t target = find_first_non_full(hash);
+
+        // Already in the best group?
+        if (probe_distance(i, home) == probe_distance(target, home))
+        {
+          pcontrol[i] = h2_of(hash);
+          continue;
+        }
+
+        if (pcontrol[target] == control_t::Empty)
+        {
+          // Move to the empty slot.
+          relocate(pslots + target, pslots[i]);
+          pcontrol[target] = h2_of(hash);
+          pcontrol[i]      = control_t::Empty;
+        }
+        else
+        {
+          // Swap with the unprocessed element in the target and process this slot again.
+          etl::uninitialized_buffer_of<value_type, 1U> temp;
+
+          value_type* ptemp = temp;
+          relocate(ptemp, pslots[target]);
+          relocate(pslots + target, pslots[i]);
+          relocate(pslots + i, *ptemp);
+
+          pcontrol[target] = h2_of(hash);
+          --i;
+        }
+      }
+
+      number_of_deleted = 0U;
+    }
+
+    //*********************************************************************
+    /// Moves an element to uninitialised storage and destroys the original.
+    //*********************************************************************
+    static void relocate(value_type* destination, value_type& source)
+    {
+#if ETL_USING_CPP11
+      ::new ((void*)destination) value_type(etl::move(source));
+#else
+      ::new ((void*)destination) value_type(source);
+#endif
+      source.~value_type();
+    }
+
+    //*********************************************************************
+    /// The number of groups between the home group and the slot's group.
+    //*********************************************************************
+    size_t probe_distance(size_t index, size_t home) const
+    {
+      return ((index / Group_Width) + number_of_groups - home) % number_of_groups;
+    }
+
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    //*********************************************************************
+    const_iterator make_const_iterator(size_t index) const
+    {
+      return const_iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The element slots.
+    value_type* pslots;
+
+    /// The control bytes, one per slot, padded to a whole number of groups.
+    uint8_t* pcontrol;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The number of groups of control bytes.
+    const size_t number_of_groups;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The number of slots marked as deleted.
+    size_t number_of_deleted;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iunordered_flat_map() {}
+#else
+
+  protected:
+
+    ~iunordered_flat_map() {}
+#endif
+  };
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t iunordered_flat_map<TKey, T, THash, TKeyEqual>::Group_Width;
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t iunordered_flat_map<TKey, T, THash, TKeyEqual>::npos;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    itr_t l_begin = lhs.begin();
+    itr_t l_end   = lhs.end();
+
+    while (l_begin != l_end)
+    {
+      itr_t r = rhs.find(l_begin->first);
+
+      if ((r == rhs.end()) || !(r->second == l_begin->second))
+      {
+        return false;
+      }
+
+      ++l_begin;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator!=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  /// MAX_SLOTS_ defaults to about 8/7 of MAX_SIZE_, to keep the probe
+  /// sequences short when the map is full.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_SLOTS_ = (MAX_SIZE_ + (MAX_SIZE_ / 7U) + 1U),
+            typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SLOTS_ >= MAX_SIZE_, "MAX_SLOTS must not be less than MAX_SIZE");
+    ETL_STATIC_ASSERT(MAX_SLOTS_ != 0U, "MAX_SLOTS must not be zero");
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = MAX_SLOTS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, control, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(slots, control, MAX_SLOTS_, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(slots, control, MAX_SLOTS_, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, control, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, control, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The element slots.
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SLOTS_> slots;
+
+    /// The control bytes.
+    uint8_t control[private_unordered_flat_map::control_size<MAX_SLOTS_>::value];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_SLOTS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, MAX_SLOTS_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_SLOTS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, MAX_SLOTS_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  unordered_flat_map(TPairs...) -> unordered_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type, sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_unordered_flat_map(TPairs&&... pairs) -> etl::unordered_flat_map<TKey, T, sizeof...(TPairs), (sizeof...(TPairs) + (sizeof...(TPairs) / 7U) + 1U), THash, TKeyEqual>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses external buffers.
+  /// The slot buffer must hold max_slots elements, and the control buffer
+  /// etl::unordered_flat_map_control_size<max_slots>::value bytes.
+  /// The maximum size is max_slots.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map_ext : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    unordered_flat_map_ext(void* slot_buffer, void* control_buffer, size_t max_slots, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), reinterpret_cast<uint8_t*>(control_buffer), max_slots, max_slots, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map_ext(const unordered_flat_map_ext& other, void* slot_buffer, void* control_buffer, size_t max_slots)
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), reinterpret_cast<uint8_t*>(control_buffer), max_slots, max_slots,
+             other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map_ext(unordered_flat_map_ext&& other, void* slot_buffer, void* control_buffer, size_t max_slots)
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), reinterpret_cast<uint8_t*>(control_buffer), max_slots, max_slots,
+             other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map_ext(TIterator first_, TIterator last_, void* slot_buffer, void* control_buffer, size_t max_slots, const THash& hash = THash(),
+                           const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), reinterpret_cast<uint8_t*>(control_buffer), max_slots, max_slots, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map_ext(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, void* slot_buffer, void* control_buffer, size_t max_slots,
+                           const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), reinterpret_cast<uint8_t*>(control_buffer), max_slots, max_slots, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map_ext& operator=(const unordered_flat_map_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map_ext& operator=(unordered_flat_map_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    // Disable copy construction without buffers.
+    unordered_flat_map_ext(const unordered_flat_map_ext&) ETL_DELETE;
+  };
+} // namespace etl
+
+#endif
@@ -47,6 +47,8 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "placement_new.h"
 #include "pool.h"
+#include "private/bucket_occupancy.h"
+#include "span.h"
 #include "type_traits.h"
 #include "utility.h"
 #include "vector.h"
@@ -180,6 +182,7 @@ namespace etl
   protected:
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
+    typedef etl::private_unordered::bucket_occupancy   occupancy_t;
     typedef etl::ipool                                  pool_t;
 
   public:
@@ -212,7 +215,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -227,14 +230,10 @@ namespace etl
         if (inode == pbucket->end())
         {
           // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          pbucket = pcontainer->next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pcontainer->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -254,7 +253,7 @@ namespace etl
       //*********************************
       iterator& operator=(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pcontainer   = other.pcontainer;
         pbucket      = other.pbucket;
         inode        = other.inode;
         return *this;
@@ -293,8 +292,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      iterator(const iunordered_map* pcontainer_, bucket_t* pbucket_, local_iterator inode_)
+        : pcontainer(pcontainer_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -324,9 +323,9 @@ namespace etl
         return inode;
       }
 
-      bucket_t*      pbuckets_end;
-      bucket_t*      pbucket;
-      local_iterator inode;
+      const iunordered_map* pcontainer;
+      bucket_t*             pbucket;
+      local_iterator        inode;
     };
 
     //*********************************************************************
@@ -353,7 +352,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_map::iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -361,7 +360,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -376,14 +375,10 @@ namespace etl
         if (inode == pbucket->end())
         {
           // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          pbucket = pcontainer->next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pcontainer->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -403,7 +398,7 @@ namespace etl
       //*********************************
       const_iterator& operator=(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pcontainer   = other.pcontainer;
         pbucket      = other.pbucket;
         inode        = other.inode;
         return *this;
@@ -442,8 +437,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      const_iterator(const iunordered_map* pcontainer_, bucket_t* pbucket_, local_iterator inode_)
+        : pcontainer(pcontainer_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -473,9 +468,9 @@ namespace etl
         return inode;
       }
 
-      bucket_t*      pbuckets_end;
-      bucket_t*      pbucket;
-      local_iterator inode;
+      const iunordered_map* pcontainer;
+      bucket_t*             pbucket;
+      local_iterator        inode;
     };
 
     typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
@@ -486,7 +481,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -495,7 +490,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -504,7 +499,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -540,7 +535,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -549,7 +544,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -558,7 +553,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -997,7 +992,7 @@ namespace etl
 
         adjust_first_last_markers_after_insert(pbucket);
 
-        result.first  = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first  = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -1032,7 +1027,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first  = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first  = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -1076,7 +1071,7 @@ namespace etl
 
         adjust_first_last_markers_after_insert(pbucket);
 
-        result.first  = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first  = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -1111,7 +1106,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first  = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first  = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -1238,7 +1233,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(this, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket    = ielement.get_bucket();
@@ -1287,7 +1282,7 @@ namespace etl
       }
 
       // Remember the item before the first erased one.
-      iterator ibefore_erased = iterator((pbuckets + number_of_buckets), pbucket, iprevious);
+      iterator ibefore_erased = iterator(this, pbucket, iprevious);
 
       // Until we reach the end.
       while ((icurrent != iend) || (pbucket != pend_bucket))
@@ -1301,9 +1296,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = next_occupied_bucket(pbucket);
 
             iprevious = pbucket->before_begin();
             icurrent  = pbucket->begin();
@@ -1369,7 +1362,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1403,7 +1396,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1439,7 +1432,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1476,7 +1469,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1710,15 +1703,108 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Finds each of a batch of keys.
+    /// The buckets for the keys further on in the batch are prefetched while
+    /// the current key is compared, so that the cache misses overlap.
+    /// Emits an unordered_map_out_of_range error if there are fewer results
+    /// than keys.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator to the element for each key, or end().
+    //*************************************************************************
+    void find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_map_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t*      pbucket = next_bucket(keys, i, pbucket_list);
+        local_iterator inode   = find_in_bucket(*pbucket, keys[i]);
+
+        results[i] = (inode == pbucket->end()) ? end() : iterator(this, pbucket, inode);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds each of a batch of keys.
+    /// The buckets for the keys further on in the batch are prefetched while
+    /// the current key is compared, so that the cache misses overlap.
+    /// Emits an unordered_map_out_of_range error if there are fewer results
+    /// than keys.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator to the element for each key, or end().
+    //*************************************************************************
+    void find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_map_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t*      pbucket = next_bucket(keys, i, pbucket_list);
+        local_iterator inode   = find_in_bucket(*pbucket, keys[i]);
+
+        results[i] = (inode == pbucket->end()) ? end() : const_iterator(this, pbucket, inode);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the unordered_map contains each of a batch of keys.
+    /// See find_batch.
+    ///\param keys    The keys to search for.
+    ///\param results <b>true</b> if the key exists, for each key.
+    //*************************************************************************
+    void contains_batch(etl::span<const key_type> keys, etl::span<bool> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_map_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t* pbucket = next_bucket(keys, i, pbucket_list);
+
+        results[i] = (find_in_bucket(*pbucket, keys[i]) != pbucket->end());
+      }
+    }
+
+    //*************************************************************************
+    /// Counts the elements for each of a batch of keys.
+    /// See find_batch.
+    ///\param keys    The keys to count.
+    ///\param results 1 if the key exists, otherwise 0, for each key.
+    //*************************************************************************
+    void count_batch(etl::span<const key_type> keys, etl::span<size_t> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_map_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t* pbucket = next_bucket(keys, i, pbucket_list);
+
+        results[i] = (find_in_bucket(*pbucket, keys[i]) == pbucket->end()) ? 0U : 1U;
+      }
+    }
+
   protected:
 
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
+    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, occupancy_t::element_type* pbucket_occupancy_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , pbucket_occupancy(pbucket_occupancy_)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1733,28 +1819,30 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0UL; i < number_of_buckets; ++i)
+        // For each occupied bucket...
+        size_t i = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, 0U);
+
+        while (i != occupancy_t::npos)
         {
           bucket_t& bucket = pbuckets[i];
 
-          if (!bucket.empty())
+          // For each item in the bucket...
+          local_iterator it = bucket.begin();
+
+          while (it != bucket.end())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
+            // Destroy the value contents.
+            it->key_value_pair.~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
 
-            while (it != bucket.end())
-            {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ETL_DECREMENT_DEBUG_COUNT;
+            ++it;
+          }
 
-              ++it;
-            }
+          // Now it's safe to clear the bucket.
+          bucket.clear();
+          occupancy_t::reset(pbucket_occupancy, i);
 
-            // Now it's safe to clear the bucket.
-            bucket.clear();
-          }
+          i = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, i + 1U);
         }
 
         // Now it's safe to clear the entire pool in one go.
@@ -1783,6 +1871,71 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Starts a batch lookup by prefetching the buckets for the first keys.
+    /// The bucket list is a ring of the next Prefetch_Distance buckets.
+    //*********************************************************************
+    void start_batch(etl::span<const key_type> keys, bucket_t** pbucket_list) const
+    {
+      for (size_t i = 0U; (i < keys.size()) && (i < Prefetch_Distance); ++i)
+      {
+        pbucket_list[i] = pbuckets + get_bucket_index(keys[i]);
+        ETL_PREFETCH(pbucket_list[i]);
+      }
+    }
+
+    //*********************************************************************
+    /// Gets the bucket for key 'index' of a batch lookup.
+    /// Prefetches the first node of the bucket halfway along the ring, whose
+    /// bucket should have arrived by now, and replaces this key's bucket in
+    /// the ring with a prefetch of the bucket Prefetch_Distance keys ahead.
+    //*********************************************************************
+    bucket_t* next_bucket(etl::span<const key_type> keys, size_t index, bucket_t** pbucket_list) const
+    {
+      const size_t half = index + (Prefetch_Distance / 2U);
+
+      if (half < keys.size())
+      {
+        bucket_t* pnear = pbucket_list[half % Prefetch_Distance];
+
+        if (pnear->begin() != pnear->end())
+        {
+          ETL_PREFETCH(&*pnear->begin());
+        }
+      }
+
+      bucket_t* pbucket = pbucket_list[index % Prefetch_Distance];
+
+      const size_t ahead = index + Prefetch_Distance;
+
+      if (ahead < keys.size())
+      {
+        pbucket_list[index % Prefetch_Distance] = pbuckets + get_bucket_index(keys[ahead]);
+        ETL_PREFETCH(pbucket_list[index % Prefetch_Distance]);
+      }
+
+      return pbucket;
+    }
+
+    //*********************************************************************
+    /// Finds the first node for the key in a bucket.
+    ///\return The node, or bucket.end() if the key is not in the bucket.
+    //*********************************************************************
+    local_iterator find_in_bucket(bucket_t& bucket, const_key_reference key) const
+    {
+      local_iterator inode = bucket.begin();
+
+      while ((inode != bucket.end()) && !key_equal_function(key, inode->key_value_pair.first))
+      {
+        ++inode;
+      }
+
+      return inode;
+    }
+
+    /// How many keys ahead a batch lookup prefetches. A power of two.
+    static ETL_CONSTANT size_t Prefetch_Distance = 32U;
+
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
@@ -1797,6 +1950,8 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy_t::set(pbucket_occupancy, static_cast<size_t>(pbucket - pbuckets));
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1820,6 +1975,13 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      const size_t index = static_cast<size_t>(pbucket - pbuckets);
+
+      if (pbucket->empty())
+      {
+        occupancy_t::reset(pbucket_occupancy, index);
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1831,31 +1993,34 @@ namespace etl
         {
           // We erased the first so, we need to search again from where we
           // erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = pbuckets + occupancy_t::find_next(pbucket_occupancy, number_of_buckets, index);
         }
         else if (pbucket == last)
         {
-          // We erased the last, so we need to search again. Start from the
-          // first, go no further than the current last.
-          pbucket        = first;
-          bucket_t* pend = last;
+          // We erased the last, so we need to search back from where we
+          // erased.
+          last = pbuckets + occupancy_t::find_previous(pbucket_occupancy, index);
+        }
+      }
+    }
 
-          last = first;
+    //*********************************************************************
+    /// Gets the first occupied bucket after 'pbucket', or end_bucket() if
+    /// there are none.
+    //*********************************************************************
+    bucket_t* next_occupied_bucket(const bucket_t* pbucket) const
+    {
+      const size_t index = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, static_cast<size_t>(pbucket - pbuckets) + 1U);
 
-          while (pbucket != pend)
-          {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
+      return pbuckets + ((index == occupancy_t::npos) ? number_of_buckets : index);
+    }
 
-            ++pbucket;
-          }
-        }
-      }
+    //*********************************************************************
+    /// Gets the end of the bucket list.
+    //*********************************************************************
+    bucket_t* end_bucket() const
+    {
+      return pbuckets + number_of_buckets;
     }
 
     //*********************************************************************
@@ -1884,6 +2049,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// One bit for each bucket, set if the bucket is not empty.
+    occupancy_t::element_type* pbucket_occupancy;
+
     /// The first and last pointers to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1993,7 +2161,8 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
     }
 
@@ -2001,7 +2170,8 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, other.hash_function(), other.key_eq())
+      , bucket_occupancy()
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -2011,7 +2181,8 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, other.hash_function(), other.key_eq())
+      , bucket_occupancy()
     {
       if (this != &other)
       {
@@ -2028,7 +2199,8 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
       base::assign(first_, last_);
     }
@@ -2038,7 +2210,8 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
       base::assign(init.begin(), init.end());
     }
@@ -2079,6 +2252,9 @@ namespace etl
 
     /// The buckets of node lists.
     typename base::bucket_t buckets[MAX_BUCKETS_];
+
+    /// The occupancy bits for the buckets.
+    etl::private_unordered::bucket_occupancy::element_type bucket_occupancy[etl::private_unordered::bucket_occupancy::buffer_size<MAX_BUCKETS_>::value];
   };
 
   //*************************************************************************
@@ -46,6 +46,8 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "placement_new.h"
 #include "pool.h"
+#include "private/bucket_occupancy.h"
+#include "span.h"
 #include "type_traits.h"
 #include "utility.h"
 #include "vector.h"
@@ -176,6 +178,7 @@ namespace etl
   protected:
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
+    typedef etl::private_unordered::bucket_occupancy   occupancy_t;
     typedef etl::ipool                                  pool_t;
 
   public:
@@ -208,7 +211,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -223,14 +226,10 @@ namespace etl
         if (inode == pbucket->end())
         {
           // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          pbucket = pcontainer->next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pcontainer->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -250,7 +249,7 @@ namespace etl
       //*********************************
       iterator& operator=(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pcontainer   = other.pcontainer;
         pbucket      = other.pbucket;
         inode        = other.inode;
         return *this;
@@ -289,8 +288,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      iterator(const iunordered_multimap* pcontainer_, bucket_t* pbucket_, local_iterator inode_)
+        : pcontainer(pcontainer_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -320,9 +319,9 @@ namespace etl
         return inode;
       }
 
-      bucket_t*      pbuckets_end;
-      bucket_t*      pbucket;
-      local_iterator inode;
+      const iunordered_multimap* pcontainer;
+      bucket_t*                  pbucket;
+      local_iterator             inode;
     };
 
     //*********************************************************************
@@ -349,7 +348,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_multimap::iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -357,7 +356,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : pcontainer(other.pcontainer)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -372,15 +371,10 @@ namespace etl
         if (inode == pbucket->end())
         {
           // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          pbucket = pcontainer->next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pcontainer->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -400,7 +394,7 @@ namespace etl
       //*********************************
       const_iterator& operator=(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pcontainer   = other.pcontainer;
         pbucket      = other.pbucket;
         inode        = other.inode;
         return *this;
@@ -439,8 +433,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      const_iterator(const iunordered_multimap* pcontainer_, bucket_t* pbucket_, local_iterator inode_)
+        : pcontainer(pcontainer_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -470,9 +464,9 @@ namespace etl
         return inode;
       }
 
-      bucket_t*      pbuckets_end;
-      bucket_t*      pbucket;
-      local_iterator inode;
+      const iunordered_multimap* pcontainer;
+      bucket_t*                  pbucket;
+      local_iterator             inode;
     };
 
     typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
@@ -483,7 +477,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -492,7 +486,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -501,7 +495,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -541,7 +535,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -550,7 +544,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -559,7 +553,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, last, last->end());
     }
 
     //*********************************************************************
@@ -714,7 +708,7 @@ namespace etl
         bucket.insert_after(bucket.before_begin(), *node);
         adjust_first_last_markers_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(this, pbucket, pbucket->begin());
       }
       else
       {
@@ -745,7 +739,7 @@ namespace etl
         adjust_first_last_markers_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(this, pbucket, inode_previous);
       }
 
       return result;
@@ -786,7 +780,7 @@ namespace etl
         bucket.insert_after(bucket.before_begin(), *node);
         adjust_first_last_markers_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(this, pbucket, pbucket->begin());
       }
       else
       {
@@ -817,7 +811,7 @@ namespace etl
         adjust_first_last_markers_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(this, pbucket, inode_previous);
       }
 
       return result;
@@ -946,7 +940,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(this, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket    = ielement.get_bucket();
@@ -995,7 +989,7 @@ namespace etl
       }
 
       // Remember the item before the first erased one.
-      iterator ibefore_erased = iterator((pbuckets + number_of_buckets), pbucket, iprevious);
+      iterator ibefore_erased = iterator(this, pbucket, iprevious);
 
       // Until we reach the end.
       while ((icurrent != iend) || (pbucket != pend_bucket))
@@ -1009,9 +1003,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = next_occupied_bucket(pbucket);
 
             iprevious = pbucket->before_begin();
             icurrent  = pbucket->begin();
@@ -1109,7 +1101,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1143,7 +1135,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return const_iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1179,7 +1171,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1216,7 +1208,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return const_iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1471,15 +1463,118 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Finds each of a batch of keys.
+    /// The buckets for the keys further on in the batch are prefetched while
+    /// the current key is compared, so that the cache misses overlap.
+    /// Emits an unordered_multimap_out_of_range error if there are fewer results
+    /// than keys.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator to the element for each key, or end().
+    //*************************************************************************
+    void find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_multimap_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t*      pbucket = next_bucket(keys, i, pbucket_list);
+        local_iterator inode   = find_in_bucket(*pbucket, keys[i]);
+
+        results[i] = (inode == pbucket->end()) ? end() : iterator(this, pbucket, inode);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds each of a batch of keys.
+    /// The buckets for the keys further on in the batch are prefetched while
+    /// the current key is compared, so that the cache misses overlap.
+    /// Emits an unordered_multimap_out_of_range error if there are fewer results
+    /// than keys.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator to the element for each key, or end().
+    //*************************************************************************
+    void find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_multimap_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t*      pbucket = next_bucket(keys, i, pbucket_list);
+        local_iterator inode   = find_in_bucket(*pbucket, keys[i]);
+
+        results[i] = (inode == pbucket->end()) ? end() : const_iterator(this, pbucket, inode);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the unordered_multimap contains each of a batch of keys.
+    /// See find_batch.
+    ///\param keys    The keys to search for.
+    ///\param results <b>true</b> if the key exists, for each key.
+    //*************************************************************************
+    void contains_batch(etl::span<const key_type> keys, etl::span<bool> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_multimap_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t* pbucket = next_bucket(keys, i, pbucket_list);
+
+        results[i] = (find_in_bucket(*pbucket, keys[i]) != pbucket->end());
+      }
+    }
+
+    //*************************************************************************
+    /// Counts the elements for each of a batch of keys.
+    /// See find_batch.
+    ///\param keys    The keys to count.
+    ///\param results The number of elements with each key.
+    //*************************************************************************
+    void count_batch(etl::span<const key_type> keys, etl::span<size_t> results) const
+    {
+      ETL_ASSERT_OR_RETURN(results.size() >= keys.size(), ETL_ERROR(unordered_multimap_out_of_range));
+
+      bucket_t* pbucket_list[Prefetch_Distance];
+      start_batch(keys, pbucket_list);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        bucket_t*      pbucket = next_bucket(keys, i, pbucket_list);
+        local_iterator inode   = find_in_bucket(*pbucket, keys[i]);
+        local_iterator iend    = pbucket->end();
+        size_t         n       = 0U;
+
+        // Equivalent keys are adjacent.
+        while ((inode != iend) && key_equal_function(keys[i], inode->key_value_pair.first))
+        {
+          ++n;
+          ++inode;
+        }
+
+        results[i] = n;
+      }
+    }
+
   protected:
 
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
+    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, occupancy_t::element_type* pbucket_occupancy_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , pbucket_occupancy(pbucket_occupancy_)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1494,27 +1589,29 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0UL; i < number_of_buckets; ++i)
+        // For each occupied bucket...
+        size_t i = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, 0U);
+
+        while (i != occupancy_t::npos)
         {
           bucket_t& bucket = pbuckets[i];
 
-          if (!bucket.empty())
+          // For each item in the bucket...
+          local_iterator it = bucket.begin();
+
+          while (it != bucket.end())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
-            {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT;
-            }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+            // Destroy the value contents.
+            it->key_value_pair.~value_type();
+            ++it;
+            ETL_DECREMENT_DEBUG_COUNT;
           }
+
+          // Now it's safe to clear the bucket.
+          bucket.clear();
+          occupancy_t::reset(pbucket_occupancy, i);
+
+          i = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, i + 1U);
         }
 
         // Now it's safe to clear the entire pool in one go.
@@ -1543,6 +1640,71 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Starts a batch lookup by prefetching the buckets for the first keys.
+    /// The bucket list is a ring of the next Prefetch_Distance buckets.
+    //*********************************************************************
+    void start_batch(etl::span<const key_type> keys, bucket_t** pbucket_list) const
+    {
+      for (size_t i = 0U; (i < keys.size()) && (i < Prefetch_Distance); ++i)
+      {
+        pbucket_list[i] = pbuckets + get_bucket_index(keys[i]);
+        ETL_PREFETCH(pbucket_list[i]);
+      }
+    }
+
+    //*********************************************************************
+    /// Gets the bucket for key 'index' of a batch lookup.
+    /// Prefetches the first node of the bucket halfway along the ring, whose
+    /// bucket should have arrived by now, and replaces this key's bucket in
+    /// the ring with a prefetch of the bucket Prefetch_Distance keys ahead.
+    //*********************************************************************
+    bucket_t* next_bucket(etl::span<const key_type> keys, size_t index, bucket_t** pbucket_list) const
+    {
+      const size_t half = index + (Prefetch_Distance / 2U);
+
+      if (half < keys.size())
+      {
+        bucket_t* pnear = pbucket_list[half % Prefetch_Distance];
+
+        if (pnear->begin() != pnear->end())
+        {
+          ETL_PREFETCH(&*pnear->begin());
+        }
+      }
+
+      bucket_t* pbucket = pbucket_list[index % Prefetch_Distance];
+
+      const size_t ahead = index + Prefetch_Distance;
+
+      if (ahead < keys.size())
+      {
+        pbucket_list[index % Prefetch_Distance] = pbuckets + get_bucket_index(keys[ahead]);
+        ETL_PREFETCH(pbucket_list[index % Prefetch_Distance]);
+      }
+
+      return pbucket;
+    }
+
+    //*********************************************************************
+    /// Finds the first node for the key in a bucket.
+    ///\return The node, or bucket.end() if the key is not in the bucket.
+    //*********************************************************************
+    local_iterator find_in_bucket(bucket_t& bucket, const_key_reference key) const
+    {
+      local_iterator inode = bucket.begin();
+
+      while ((inode != bucket.end()) && !key_equal_function(key, inode->key_value_pair.first))
+      {
+        ++inode;
+      }
+
+      return inode;
+    }
+
+    /// How many keys ahead a batch lookup prefetches. A power of two.
+    static ETL_CONSTANT size_t Prefetch_Distance = 32U;
+
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
@@ -1557,6 +1719,8 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy_t::set(pbucket_occupancy, static_cast<size_t>(pbucket - pbuckets));
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1580,6 +1744,13 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      const size_t index = static_cast<size_t>(pbucket - pbuckets);
+
+      if (pbucket->empty())
+      {
+        occupancy_t::reset(pbucket_occupancy, index);
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1591,31 +1762,34 @@ namespace etl
         {
           // We erased the first so, we need to search again from where we
           // erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = pbuckets + occupancy_t::find_next(pbucket_occupancy, number_of_buckets, index);
         }
         else if (pbucket == last)
         {
-          // We erased the last, so we need to search again. Start from the
-          // first, go no further than the current last.
-          pbucket        = first;
-          bucket_t* pend = last;
+          // We erased the last, so we need to search back from where we
+          // erased.
+          last = pbuckets + occupancy_t::find_previous(pbucket_occupancy, index);
+        }
+      }
+    }
 
-          last = first;
+    //*********************************************************************
+    /// Gets the first occupied bucket after 'pbucket', or end_bucket() if
+    /// there are none.
+    //*********************************************************************
+    bucket_t* next_occupied_bucket(const bucket_t* pbucket) const
+    {
+      const size_t index = occupancy_t::find_next(pbucket_occupancy, number_of_buckets, static_cast<size_t>(pbucket - pbuckets) + 1U);
 
-          while (pbucket != pend)
-          {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
+      return pbuckets + ((index == occupancy_t::npos) ? number_of_buckets : index);
+    }
 
-            ++pbucket;
-          }
-        }
-      }
+    //*********************************************************************
+    /// Gets the end of the bucket list.
+    //*********************************************************************
+    bucket_t* end_bucket() const
+    {
+      return pbuckets + number_of_buckets;
     }
 
     //*********************************************************************
@@ -1644,6 +1818,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// One bit for each bucket, set if the bucket is not empty.
+    occupancy_t::element_type* pbucket_occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1761,7 +1938,8 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_multimap(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
     }
 
@@ -1769,7 +1947,8 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_multimap(const unordered_multimap& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, bucket_occupancy, other.hash_function(), other.key_eq())
+      , bucket_occupancy()
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1783,7 +1962,8 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_multimap(unordered_multimap&& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, bucket_occupancy, other.hash_function(), other.key_eq())
+      , bucket_occupancy()
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1801,7 +1981,8 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_multimap(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
       base::assign(first_, last_);
     }
@@ -1811,7 +1992,8 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, bucket_occupancy, hash, equal)
+      , bucket_occupancy()
     {
       base::assign(init.begin(), init.end());
     }
@@ -1854,6 +2036,9 @@ namespace etl
 
     /// The buckets of node lists.
     typename base::bucket_t buckets[MAX_BUCKETS_];
+
+    /// The occupancy bits for the buckets.
+    etl::private_unordered::bucket_occupancy::element_type bucket_occupancy[etl::private_unordered::bucket_occupancy::buffer_size<MAX_BUCKETS_>::value];
   };
 
   //*************************************************************************
@@ -549,19 +549,37 @@ namespace etl
 
   namespace private_integer_sequence
   {
-    template <size_t Count, typename IndexSeq>
-    struct make_index_sequence;
+    //*********************************
+    // Joins two index sequences, offsetting the second by the size of the first.
+    template <typename TFirst, typename TSecond>
+    struct join_index_sequences;
 
-    template <size_t Count, size_t... Indices>
-    struct make_index_sequence<Count, etl::integer_sequence<size_t, Indices...>>
+    template <size_t... First, size_t... Second>
+    struct join_index_sequences<etl::integer_sequence<size_t, First...>, etl::integer_sequence<size_t, Second...>>
     {
-      using type = typename make_index_sequence< Count - 1, etl::integer_sequence<size_t, Count - 1, Indices...>>::type;
+      using type = etl::integer_sequence<size_t, First..., (sizeof...(First) + Second)...>;
     };
 
-    template <size_t... Indices>
-    struct make_index_sequence<0, etl::integer_sequence<size_t, Indices...>>
+    //*********************************
+    // Makes the sequence from its two halves, so that the instantiation depth
+    // is log2(Count) rather than Count.
+    template <size_t Count>
+    struct make_index_sequence
     {
-      using type = etl::integer_sequence<size_t, Indices...>;
+      using type = typename join_index_sequences<typename make_index_sequence<Count / 2U>::type,
+                                                 typename make_index_sequence<Count - (Count / 2U)>::type>::type;
+    };
+
+    template <>
+    struct make_index_sequence<0U>
+    {
+      using type = etl::integer_sequence<size_t>;
+    };
+
+    template <>
+    struct make_index_sequence<1U>
+    {
+      using type = etl::integer_sequence<size_t, 0U>;
     };
 
     template <size_t Offset, typename IndexSeq>
@@ -578,7 +596,7 @@ namespace etl
   /// Make an integer sequence.
   //***********************************
   template <size_t Count>
-  using make_index_sequence = typename private_integer_sequence::make_index_sequence< Count, etl::integer_sequence<size_t>>::type;
+  using make_index_sequence = typename private_integer_sequence::make_index_sequence<Count>::type;
 
   //***********************************
   /// Make an integer sequence with an offset.
@@ -598,7 +616,7 @@ namespace etl
     template <typename... TTypes>
     struct impl
     {
-      using type = typename private_integer_sequence::make_index_sequence< sizeof...(TTypes), etl::integer_sequence<size_t>>::type;
+      using type = typename private_integer_sequence::make_index_sequence<sizeof...(TTypes)>::type;
     };
 
     // etl::type_list form
@@ -956,6 +974,32 @@ namespace etl
   inline constexpr in_place_index_t<Index> in_place_index{};
 #endif
 
+  //***************************************************************************
+  /// Tags that declare an input range to be already sorted.
+  /// sorted_unique      : Sorted and free of equivalent keys.
+  /// sorted_equivalent  : Sorted, equivalent keys allowed.
+  //***************************************************************************
+
+  //*************************
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
+  //*************************
+  struct sorted_equivalent_t
+  {
+    explicit ETL_CONSTEXPR sorted_equivalent_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_equivalent_t sorted_equivalent{};
+#endif
+
 #if ETL_USING_CPP11
   //*************************************************************************
   // A function wrapper for free/global functions.
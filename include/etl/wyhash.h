@@ -0,0 +1,401 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "ihash.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+#if defined(ETL_COMPILER_KEIL)
+  #pragma diag_suppress 1300
+#endif
+
+///\defgroup wyhash wyhash 64 bit hash calculation
+///\ingroup maths
+
+#if ETL_USING_64BIT_TYPES
+
+  #include "private/diagnostic_useless_cast_push.h"
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// Multiplies two 64 bit values to give a 128 bit result.
+    /// The low half is returned in 'a' and the high half in 'b'.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+  #if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      uint128_t r = a;
+      r *= b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+  #else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+  #endif
+    }
+
+    //*************************************************************************
+    /// Multiplies and folds the 128 bit result to 64 bits.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads 8 bytes as a little endian value.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+      return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8U) | (static_cast<uint64_t>(p[2]) << 16U) |
+             (static_cast<uint64_t>(p[3]) << 24U) | (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U) |
+             (static_cast<uint64_t>(p[6]) << 48U) | (static_cast<uint64_t>(p[7]) << 56U);
+    }
+
+    //*************************************************************************
+    /// Reads 4 bytes as a little endian value.
+    //*************************************************************************
+    inline uint64_t read32(const uint8_t* p)
+    {
+      return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8U) | (static_cast<uint64_t>(p[2]) << 16U) |
+             (static_cast<uint64_t>(p[3]) << 24U);
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read_short(const uint8_t* p, size_t length)
+    {
+      return (static_cast<uint64_t>(p[0]) << 16U) | (static_cast<uint64_t>(p[length >> 1U]) << 8U) | static_cast<uint64_t>(p[length - 1U]);
+    }
+  } // namespace private_wyhash
+
+  //***************************************************************************
+  /// Calculates the wyhash (final version 4) 64 bit hash.
+  /// Data is consumed 48 bytes at a time, in three independent 16 byte lanes.
+  /// The result is the same as the reference implementation with the default
+  /// secret, however the data is split between calls to 'add'.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template <typename TIterator>
+    wyhash(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      lane[0]      = seed ^ private_wyhash::mix(seed ^ SECRET0, SECRET1);
+      lane[1]      = lane[0];
+      lane[2]      = lane[0];
+      char_count   = 0U;
+      block_count  = 0U;
+      is_finalised = false;
+      hash         = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// Ranges of contiguous bytes are consumed a block at a time.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error
+    /// will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      buffer[TAIL_SIZE + block_count] = value_;
+
+      if (++block_count == BLOCK_SIZE)
+      {
+        add_block(buffer + TAIL_SIZE);
+        block_count = 0U;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range, a byte at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range. Whole blocks are hashed in place.
+    //*************************************************************************
+    template <typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p      = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = static_cast<size_t>(end - begin);
+
+      char_count += length;
+
+      // Top up a partial block first.
+      if (block_count != 0U)
+      {
+        while ((length != 0U) && (block_count != BLOCK_SIZE))
+        {
+          buffer[TAIL_SIZE + block_count++] = *p++;
+          --length;
+        }
+
+        if (block_count != BLOCK_SIZE)
+        {
+          return;
+        }
+
+        add_block(buffer + TAIL_SIZE);
+        block_count = 0U;
+      }
+
+      while (length >= BLOCK_SIZE)
+      {
+        add_block(p);
+        p += BLOCK_SIZE;
+        length -= BLOCK_SIZE;
+      }
+
+      while (length != 0U)
+      {
+        buffer[TAIL_SIZE + block_count++] = *p++;
+        --length;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a 48 byte block to the hash.
+    /// The last 16 bytes are kept in front of the next block, as the final
+    /// read may overlap them.
+    //*************************************************************************
+    void add_block(const uint8_t* p)
+    {
+      using private_wyhash::mix;
+      using private_wyhash::read64;
+
+      lane[0] = mix(read64(p) ^ SECRET1, read64(p + 8) ^ lane[0]);
+      lane[1] = mix(read64(p + 16) ^ SECRET2, read64(p + 24) ^ lane[1]);
+      lane[2] = mix(read64(p + 32) ^ SECRET3, read64(p + 40) ^ lane[2]);
+
+      for (size_t i = 0U; i < TAIL_SIZE; ++i)
+      {
+        buffer[i] = p[BLOCK_SIZE - TAIL_SIZE + i];
+      }
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      using private_wyhash::mix;
+      using private_wyhash::read32;
+      using private_wyhash::read64;
+      using private_wyhash::read_short;
+
+      if (!is_finalised)
+      {
+        uint64_t state = lane[0];
+        uint64_t a     = 0U;
+        uint64_t b     = 0U;
+
+        if (char_count <= TAIL_SIZE)
+        {
+          const uint8_t* block  = buffer + TAIL_SIZE;
+          const size_t   length = block_count;
+
+          if (length >= 4U)
+          {
+            const size_t offset = (length >> 3U) << 2U;
+
+            a = (read32(block) << 32U) | read32(block + offset);
+            b = (read32(block + length - 4U) << 32U) | read32(block + length - 4U - offset);
+          }
+          else if (length > 0U)
+          {
+            a = read_short(block, length);
+          }
+        }
+        else
+        {
+          if (char_count >= BLOCK_SIZE)
+          {
+            state ^= lane[1] ^ lane[2];
+          }
+
+          // The remaining bytes, preceded by the end of the last block.
+          const uint8_t* p = buffer + TAIL_SIZE;
+          size_t         i = block_count;
+
+          while (i > TAIL_SIZE)
+          {
+            state = mix(read64(p) ^ SECRET1, read64(p + 8) ^ state);
+            i -= TAIL_SIZE;
+            p += TAIL_SIZE;
+          }
+
+          a = read64(p + i - 16U);
+          b = read64(p + i - 8U);
+        }
+
+        a ^= SECRET1;
+        b ^= state;
+        private_wyhash::multiply(a, b);
+
+        hash         = mix(a ^ SECRET0 ^ static_cast<uint64_t>(char_count), b ^ SECRET1);
+        is_finalised = true;
+      }
+    }
+
+    static ETL_CONSTANT size_t BLOCK_SIZE = 48U;
+    static ETL_CONSTANT size_t TAIL_SIZE  = 16U;
+
+    static ETL_CONSTANT uint64_t SECRET0 = 0xA0761D6478BD642FULL;
+    static ETL_CONSTANT uint64_t SECRET1 = 0xE7037ED1A0B428DBULL;
+    static ETL_CONSTANT uint64_t SECRET2 = 0x8EBC6AF09C88C6E3ULL;
+    static ETL_CONSTANT uint64_t SECRET3 = 0x589965CC75374CC3ULL;
+
+    uint64_t   lane[3];
+    uint8_t    buffer[TAIL_SIZE + BLOCK_SIZE]; ///< The end of the last block, then the partial block.
+    size_t     block_count;
+    size_t     char_count;
+    bool       is_finalised;
+    value_type hash;
+    value_type seed;
+  };
+} // namespace etl
+
+  #include "private/diagnostic_pop.h"
+
+#endif // ETL_USING_64BIT_TYPES
+
+#endif
@@ -0,0 +1,88 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace benchmark
+{
+  //***************************************************************************
+  /// Stops the optimiser from discarding a result.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+    static volatile uint64_t sink;
+
+    sink = sink + static_cast<uint64_t>(value);
+  }
+
+  //***************************************************************************
+  /// Runs a function a number of times and returns the time per run, in
+  /// nanoseconds. The best of several repeats is taken.
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function, size_t runs, size_t repeats = 5U)
+  {
+    double best = 0.0;
+
+    for (size_t r = 0U; r < repeats; ++r)
+    {
+      const auto start = std::chrono::steady_clock::now();
+
+      for (size_t i = 0U; i < runs; ++i)
+      {
+        function();
+      }
+
+      const auto   stop = std::chrono::steady_clock::now();
+      const double ns   = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(runs);
+
+      if ((r == 0U) || (ns < best))
+      {
+        best = ns;
+      }
+    }
+
+    return best;
+  }
+
+  //***************************************************************************
+  /// Prints one result line.
+  //***************************************************************************
+  inline void report(const char* name, size_t size, double ns)
+  {
+    std::printf("%-40s %8zu %12.2f ns\n", name, size, ns);
+  }
+} // namespace benchmark
+
+#endif
@@ -0,0 +1,165 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Adds and tests of 1M keys in Bloom filters of 256M bits, larger than the
+// L2 cache.
+// 'bloom_filter' uses three hashes, each touching a different cache line.
+// 'blocked K=n' sets n bits in one 64 byte block for each key.
+// 'blocked K=8 of 16' sets 8 bits, chosen at run time, with a maximum of 16.
+// 'batch' adds and tests a batch at a time, prefetching the blocks.
+// Times are for all of the keys.
+
+#include "benchmark.h"
+
+#include "etl/bloom_filter.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Width = 256U * 1024U * 1024U;
+  const size_t Keys  = 1024U * 1024U;
+  const size_t Runs  = 5U;
+
+  //***************************************************************************
+  template <uint64_t Multiplier>
+  struct hash
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator()(argument_type key) const
+    {
+      return static_cast<size_t>((key * Multiplier) >> 32U);
+    }
+  };
+
+  typedef hash<0x9E3779B97F4A7C15ULL> hash1;
+  typedef hash<0xC2B2AE3D27D4EB4FULL> hash2;
+  typedef hash<0x165667B19E3779F9ULL> hash3;
+
+  typedef etl::bloom_filter<Width, hash1, hash2, hash3> Standard;
+  typedef etl::blocked_bloom_filter<Width, hash1, 3U>   Blocked3;
+  typedef etl::blocked_bloom_filter<Width, hash1, 8U>   Blocked8;
+  typedef etl::blocked_bloom_filter<Width, hash1, 16U>  Blocked16;
+
+  //***************************************************************************
+  template <typename TFilter>
+  void run_blocked(const char*                  add_name,
+                   const char*                  add_batch_name,
+                   const char*                  exists_name,
+                   const char*                  exists_batch_name,
+                   const std::vector<uint32_t>& keys,
+                   const std::vector<uint32_t>& tests,
+                   bool*                        results,
+                   size_t                       hash_count = TFilter::MAX_HASH_COUNT)
+  {
+    TFilter* filter = new TFilter(hash_count);
+
+    benchmark::report(add_name, keys.size(), benchmark::time_ns([&]() {
+      filter->clear();
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        filter->add(keys[i]);
+      }
+    }, Runs));
+
+    benchmark::report(add_batch_name, keys.size(), benchmark::time_ns([&]() {
+      filter->clear();
+      filter->add_batch(etl::span<const uint32_t>(keys.data(), keys.size()));
+    }, Runs));
+
+    benchmark::report(exists_name, tests.size(), benchmark::time_ns([&]() {
+      size_t found = 0U;
+
+      for (size_t i = 0U; i < tests.size(); ++i)
+      {
+        found += filter->exists(tests[i]) ? 1U : 0U;
+      }
+
+      benchmark::do_not_optimise(found);
+    }, Runs));
+
+    benchmark::report(exists_batch_name, tests.size(), benchmark::time_ns([&]() {
+      filter->exists_batch(etl::span<const uint32_t>(tests.data(), tests.size()), etl::span<bool>(results, tests.size()));
+      benchmark::do_not_optimise(results[0]);
+    }, Runs));
+
+    delete filter;
+  }
+} // namespace
+
+//*****************************************************************************
+int main()
+{
+  std::vector<uint32_t> keys(Keys);
+  std::vector<uint32_t> tests(Keys);
+  uint32_t              seed = 12345U;
+
+  for (size_t i = 0U; i < keys.size(); ++i)
+  {
+    seed     = (seed * 1103515245U) + 12345U;
+    keys[i]  = seed;
+    tests[i] = seed ^ 0x55555555U;
+  }
+
+  bool* results = new bool[Keys];
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  Standard* standard = new Standard;
+
+  benchmark::report("bloom_filter add", Keys, benchmark::time_ns([&]() {
+    standard->clear();
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      standard->add(keys[i]);
+    }
+  }, Runs));
+
+  benchmark::report("bloom_filter exists", Keys, benchmark::time_ns([&]() {
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < tests.size(); ++i)
+    {
+      found += standard->exists(tests[i]) ? 1U : 0U;
+    }
+
+    benchmark::do_not_optimise(found);
+  }, Runs));
+
+  delete standard;
+
+  run_blocked<Blocked3>("blocked K=3 add", "blocked K=3 batch add", "blocked K=3 exists", "blocked K=3 batch exists", keys, tests, results);
+  run_blocked<Blocked8>("blocked K=8 add", "blocked K=8 batch add", "blocked K=8 exists", "blocked K=8 batch exists", keys, tests, results);
+  run_blocked<Blocked16>("blocked K=8 of 16 add", "blocked K=8 of 16 batch add", "blocked K=8 of 16 exists", "blocked K=8 of 16 batch exists", keys, tests, results, 8U);
+
+  delete[] results;
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Random lookups and in order traversal of etl::btree_map, against etl::map.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/btree_map.h"
+#include "etl/map.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Size    = 256U * 1024U;
+  const size_t Lookups = 256U * 1024U;
+
+  typedef etl::map<uint32_t, uint32_t, Size>       Map;
+  typedef etl::btree_map<uint32_t, uint32_t, Size> BTree_Map;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> keys(count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed    = (seed * 1103515245U) + 12345U;
+      keys[i] = seed;
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void run(const char* name, TMap& map, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& lookups)
+  {
+    char text[64];
+
+    std::snprintf(text, sizeof(text), "%s insert", name);
+    benchmark::report(text,
+                      keys.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          map.clear();
+
+                          for (size_t i = 0U; i < keys.size(); ++i)
+                          {
+                            map.insert(typename TMap::value_type(keys[i], uint32_t(i)));
+                          }
+                        },
+                        1U,
+                        3U) /
+                        double(keys.size()));
+
+    std::snprintf(text, sizeof(text), "%s find", name);
+    benchmark::report(text,
+                      lookups.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          uint32_t sum = 0U;
+
+                          for (size_t i = 0U; i < lookups.size(); ++i)
+                          {
+                            typename TMap::const_iterator itr = map.find(lookups[i]);
+                            sum += (itr != map.end()) ? itr->second : 0U;
+                          }
+
+                          benchmark::do_not_optimise(sum);
+                        },
+                        1U) /
+                        double(lookups.size()));
+
+    std::snprintf(text, sizeof(text), "%s iterate", name);
+    benchmark::report(text,
+                      map.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          uint32_t sum = 0U;
+
+                          for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+                          {
+                            sum += itr->second;
+                          }
+
+                          benchmark::do_not_optimise(sum);
+                        },
+                        1U) /
+                        double(map.size()));
+  }
+} // namespace
+
+int main()
+{
+  // Half of the lookups are for keys that are present.
+  const std::vector<uint32_t> keys    = make_keys(Size, 12345U);
+  std::vector<uint32_t>       lookups = make_keys(Lookups, 54321U);
+
+  for (size_t i = 0U; i < lookups.size(); i += 2U)
+  {
+    lookups[i] = keys[(lookups[i] >> 8) % keys.size()];
+  }
+
+  std::unique_ptr<Map>       map(new Map);
+  std::unique_ptr<BTree_Map> btree_map(new BTree_Map);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run("map", *map, keys, lookups);
+  run("btree_map", *btree_map, keys, lookups);
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Checksums of a 1MB block.
+// 'bytes' adds one byte at a time. 'block' adds the block from a pointer
+// range, which uses SIMD when the profile enables ETL_USING_SIMD_CHECKSUM,
+// for example when built for a target with SSE2, AVX2 or AArch64 NEON.
+// Times are per block.
+
+#include "benchmark.h"
+
+#include "etl/adler32.h"
+#include "etl/checksum.h"
+#include "etl/fletcher.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Bytes = 1024U * 1024U;
+  const size_t Runs  = 20U;
+
+  //***************************************************************************
+  template <typename TChecksum>
+  void run(const char* name, const std::vector<uint8_t>& data)
+  {
+    char bytes_name[64];
+    char block_name[64];
+
+    std::snprintf(bytes_name, sizeof(bytes_name), "%s bytes", name);
+    std::snprintf(block_name, sizeof(block_name), "%s block", name);
+
+    const uint8_t* first = data.data();
+    const uint8_t* last  = data.data() + data.size();
+
+    benchmark::report(bytes_name, data.size(), benchmark::time_ns([&]() {
+      TChecksum checksum;
+
+      for (const uint8_t* p = first; p != last; ++p)
+      {
+        checksum.add(*p);
+      }
+
+      benchmark::do_not_optimise(checksum.value());
+    }, Runs));
+
+    benchmark::report(block_name, data.size(), benchmark::time_ns([&]() { benchmark::do_not_optimise(TChecksum(first, last).value()); }, Runs));
+  }
+} // namespace
+
+//*****************************************************************************
+int main()
+{
+  std::vector<uint8_t> data(Bytes);
+  uint32_t             seed = 12345U;
+
+  for (size_t i = 0U; i < data.size(); ++i)
+  {
+    seed    = (seed * 1103515245U) + 12345U;
+    data[i] = static_cast<uint8_t>(seed >> 24U);
+  }
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run<etl::checksum<uint32_t> >("checksum", data);
+  run<etl::xor_checksum<uint8_t> >("xor_checksum", data);
+  run<etl::parity_checksum<uint8_t> >("parity_checksum", data);
+  run<etl::adler32>("adler32", data);
+  run<etl::fletcher16>("fletcher16", data);
+  run<etl::fletcher32>("fletcher32", data);
+  run<etl::fletcher64>("fletcher64", data);
+
+  return 0;
+}
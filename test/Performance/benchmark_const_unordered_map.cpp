@@ -0,0 +1,132 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Lookup time of etl::const_unordered_map against etl::const_map.
+
+#include "benchmark.h"
+
+#include "etl/const_map.h"
+#include "etl/const_unordered_map.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Lookups = 4096U;
+
+  //***************************************************************************
+  /// Both maps, with Size keys spread out over the integers.
+  //***************************************************************************
+  template <typename TIndices>
+  struct Maps;
+
+  template <size_t... Indices>
+  struct Maps<etl::index_sequence<Indices...>>
+  {
+    static constexpr size_t Size = sizeof...(Indices);
+
+    using Ordered   = etl::const_map<int, int, Size>;
+    using Unordered = etl::const_unordered_map<int, int, Size>;
+
+    static constexpr Ordered   ordered{typename Ordered::value_type(int(Indices * 7U), int(Indices))...};
+    static constexpr Unordered unordered{typename Unordered::value_type(int(Indices * 7U), int(Indices))...};
+
+    static_assert(ordered.is_valid(), "Invalid const_map");
+    static_assert(unordered.is_valid(), "Invalid const_unordered_map");
+  };
+
+  template <size_t... Indices>
+  constexpr typename Maps<etl::index_sequence<Indices...>>::Ordered Maps<etl::index_sequence<Indices...>>::ordered;
+
+  template <size_t... Indices>
+  constexpr typename Maps<etl::index_sequence<Indices...>>::Unordered Maps<etl::index_sequence<Indices...>>::unordered;
+
+  //***************************************************************************
+  /// Look up a pseudo random mix of present and absent keys.
+  //***************************************************************************
+  template <size_t Size>
+  void run()
+  {
+    using maps = Maps<etl::make_index_sequence<Size>>;
+
+    std::vector<int> keys(Lookups);
+    uint32_t         seed = 1U;
+
+    for (size_t i = 0U; i < Lookups; ++i)
+    {
+      seed    = (seed * 1103515245U) + 12345U;
+      keys[i] = int((seed >> 8) % (Size * 8U)); // One in eight is present.
+    }
+
+    const double ordered_ns = benchmark::time_ns(
+      [&]()
+      {
+        int sum = 0;
+
+        for (size_t i = 0U; i < Lookups; ++i)
+        {
+          auto itr = maps::ordered.find(keys[i]);
+          sum += (itr != maps::ordered.end()) ? itr->second : 0;
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      200U);
+
+    const double unordered_ns = benchmark::time_ns(
+      [&]()
+      {
+        int sum = 0;
+
+        for (size_t i = 0U; i < Lookups; ++i)
+        {
+          auto itr = maps::unordered.find(keys[i]);
+          sum += (itr != maps::unordered.end()) ? itr->second : 0;
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      200U);
+
+    benchmark::report("const_map::find", Size, ordered_ns / Lookups);
+    benchmark::report("const_unordered_map::find", Size, unordered_ns / Lookups);
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time per lookup");
+
+  run<8>();
+  run<32>();
+  run<128>();
+  run<512>();
+  run<1024>();
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// CRCs of a 1MB block, for each table size.
+// 'bytes' adds one byte at a time. 'block' adds the block from a pointer
+// range, which uses slicing by 8 or 16 for the 2048 and 4096 entry tables,
+// and SIMD when the profile enables ETL_USING_SIMD_CRC, for example when
+// built with -msse4.2 -mpclmul.
+// 'parallel' splits the block between 4 threads with etl::crc_parallel.
+// Times are per block.
+
+#include "benchmark.h"
+
+#include "etl/crc_parallel.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Bytes = 1024U * 1024U;
+  const size_t Runs  = 20U;
+
+  //***************************************************************************
+  template <typename TCrc>
+  void run(const char* name, const std::vector<uint8_t>& data)
+  {
+    char bytes_name[64];
+    char block_name[64];
+
+    std::snprintf(bytes_name, sizeof(bytes_name), "%s bytes", name);
+    std::snprintf(block_name, sizeof(block_name), "%s block", name);
+
+    const uint8_t* first = data.data();
+    const uint8_t* last  = data.data() + data.size();
+
+    benchmark::report(bytes_name, data.size(), benchmark::time_ns([&]() {
+      TCrc crc;
+
+      for (const uint8_t* p = first; p != last; ++p)
+      {
+        crc.add(*p);
+      }
+
+      benchmark::do_not_optimise(crc.value());
+    }, Runs));
+
+    benchmark::report(block_name, data.size(), benchmark::time_ns([&]() { benchmark::do_not_optimise(TCrc(first, last).value()); }, Runs));
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  void run_parallel(const char* name, const std::vector<uint8_t>& data)
+  {
+    char parallel_name[64];
+
+    std::snprintf(parallel_name, sizeof(parallel_name), "%s parallel", name);
+
+    const uint8_t* first = data.data();
+    const uint8_t* last  = data.data() + data.size();
+
+    benchmark::report(parallel_name, data.size(),
+                      benchmark::time_ns([&]() { benchmark::do_not_optimise(etl::crc_parallel<TCrc, 4U>(first, last)); }, Runs));
+  }
+} // namespace
+
+//*****************************************************************************
+int main()
+{
+  std::vector<uint8_t> data(Bytes);
+  uint32_t             seed = 12345U;
+
+  for (size_t i = 0U; i < data.size(); ++i)
+  {
+    seed    = (seed * 1103515245U) + 12345U;
+    data[i] = static_cast<uint8_t>(seed >> 24U);
+  }
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run<etl::crc16_ccitt_t4>("crc16_ccitt_t4", data);
+  run<etl::crc16_ccitt_t16>("crc16_ccitt_t16", data);
+  run<etl::crc16_ccitt_t256>("crc16_ccitt_t256", data);
+  run<etl::crc16_ccitt_t2048>("crc16_ccitt_t2048", data);
+  run<etl::crc16_ccitt_t4096>("crc16_ccitt_t4096", data);
+  run<etl::crc32_t4>("crc32_t4", data);
+  run<etl::crc32_t16>("crc32_t16", data);
+  run<etl::crc32_t256>("crc32_t256", data);
+  run<etl::crc32_t2048>("crc32_t2048", data);
+  run<etl::crc32_t4096>("crc32_t4096", data);
+  run<etl::crc32_c_t4>("crc32_c_t4", data);
+  run<etl::crc32_c_t16>("crc32_c_t16", data);
+  run<etl::crc32_c_t256>("crc32_c_t256", data);
+  run<etl::crc32_c_t2048>("crc32_c_t2048", data);
+  run<etl::crc32_c_t4096>("crc32_c_t4096", data);
+  run<etl::crc64_ecma_t4>("crc64_ecma_t4", data);
+  run<etl::crc64_ecma_t16>("crc64_ecma_t16", data);
+  run<etl::crc64_ecma_t256>("crc64_ecma_t256", data);
+  run<etl::crc64_ecma_t2048>("crc64_ecma_t2048", data);
+  run<etl::crc64_ecma_t4096>("crc64_ecma_t4096", data);
+  run_parallel<etl::crc32_t4096>("crc32_t4096", data);
+  run_parallel<etl::crc64_ecma_t4096>("crc64_ecma_t4096", data);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Inserting a batch of random keys into an etl::flat_set one at a time
+// against the bulk insert, which appends, sorts and merges the batch.
+// Each timing includes clearing or rebuilding the set first.
+// Times are per inserted element.
+
+#include "benchmark.h"
+
+#include "etl/flat_set.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 16U * 1024U;
+
+  typedef etl::flat_set<uint32_t, Size> Set;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> keys;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      keys.push_back(seed);
+    }
+
+    return keys;
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<uint32_t> all      = make_keys(Size, 1U);
+  const std::vector<uint32_t> existing = make_keys(Size - (Size / 4U), 2U);
+  const std::vector<uint32_t> batch    = make_keys(Size / 4U, 3U);
+
+  std::unique_ptr<Set> set(new Set);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  benchmark::report("flat_set build one by one",
+                    all.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        set->clear();
+
+                        for (size_t i = 0U; i < all.size(); ++i)
+                        {
+                          set->insert(all[i]);
+                        }
+                      },
+                      1U,
+                      3U) /
+                      double(all.size()));
+
+  benchmark::report("flat_set build bulk insert",
+                    all.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        set->clear();
+                        set->insert(all.begin(), all.end());
+                      },
+                      1U,
+                      3U) /
+                      double(all.size()));
+
+  benchmark::report("flat_set merge one by one",
+                    batch.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        set->assign(existing.begin(), existing.end());
+
+                        for (size_t i = 0U; i < batch.size(); ++i)
+                        {
+                          set->insert(batch[i]);
+                        }
+                      },
+                      1U,
+                      3U) /
+                      double(batch.size()));
+
+  benchmark::report("flat_set merge bulk insert",
+                    batch.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        set->assign(existing.begin(), existing.end());
+                        set->insert(batch.begin(), batch.end());
+                      },
+                      1U,
+                      3U) /
+                      double(batch.size()));
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Throughput of the streaming hashes, and the cost of the integral hash.
+
+#include "benchmark.h"
+
+#include "etl/fnv_1.h"
+#include "etl/hash.h"
+#include "etl/murmur3.h"
+#include "etl/wyhash.h"
+
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  template <typename THash>
+  void run(const char* name, const std::vector<uint8_t>& data, size_t length)
+  {
+    const size_t runs = (1024U * 1024U) / (length + 1U);
+
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        for (size_t offset = 0U; offset < 64U; offset += 8U)
+        {
+          THash hash(data.data() + offset, data.data() + offset + length);
+          benchmark::do_not_optimise(hash.value());
+        }
+      },
+      runs / 8U + 1U);
+
+    benchmark::report(name, length, ns / 8.0);
+  }
+
+  //***************************************************************************
+  /// Sums the integral hashes, as an unordered container would bucket them.
+  //***************************************************************************
+  void run_integral(const char* name, size_t (*hash_function)(uint64_t))
+  {
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        size_t sum = 0U;
+
+        for (uint64_t i = 0U; i < 4096U; ++i)
+        {
+          sum += hash_function(i) % 1021U;
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      1000U);
+
+    benchmark::report(name, sizeof(uint64_t), ns / 4096.0);
+  }
+
+  size_t identity(uint64_t value)
+  {
+    return static_cast<size_t>(value);
+  }
+
+  size_t mixer(uint64_t value)
+  {
+    return etl::private_hash::mix_integral(value);
+  }
+} // namespace
+
+int main()
+{
+  std::vector<uint8_t> data(64U * 1024U + 64U);
+
+  for (size_t i = 0U; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i * 131U);
+  }
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Bytes", "Time per hash");
+
+  const size_t lengths[] = {8U, 16U, 32U, 64U, 256U, 4096U, 65536U};
+
+  for (size_t i = 0U; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+  {
+    run<etl::fnv_1a_64>("fnv_1a_64", data, lengths[i]);
+    run<etl::murmur3<uint32_t>>("murmur3<uint32_t>", data, lengths[i]);
+    run<etl::wyhash>("wyhash", data, lengths[i]);
+  }
+
+  run_integral("hash<uint64_t> identity", identity);
+  run_integral("hash<uint64_t> ETL_HASH_USE_INTEGRAL_MIXER", mixer);
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Sorting 64K random uint32_t values in etl::list, etl::forward_list,
+// etl::intrusive_list and etl::intrusive_forward_list.
+// Each timing includes refilling the list from the unsorted input first.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/forward_list.h"
+#include "etl/intrusive_forward_list.h"
+#include "etl/intrusive_list.h"
+#include "etl/list.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 64U * 1024U;
+
+  typedef etl::bidirectional_link<0> BLink;
+  typedef etl::forward_link<0>       FLink;
+
+  struct Item : public BLink, public FLink
+  {
+    uint32_t value;
+  };
+
+  bool operator<(const Item& lhs, const Item& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  typedef etl::list<uint32_t, Size>                 List;
+  typedef etl::forward_list<uint32_t, Size>         Forward_List;
+  typedef etl::intrusive_list<Item, BLink>          Intrusive_List;
+  typedef etl::intrusive_forward_list<Item, FLink>  Intrusive_Forward_List;
+} // namespace
+
+int main()
+{
+  std::vector<uint32_t> input(Size);
+
+  uint32_t seed = 12345U;
+
+  for (size_t i = 0U; i < Size; ++i)
+  {
+    seed     = (seed * 1103515245U) + 12345U;
+    input[i] = seed;
+  }
+
+  std::unique_ptr<List>         list(new List);
+  std::unique_ptr<Forward_List> forward_list(new Forward_List);
+  std::vector<Item>             items(Size);
+  Intrusive_List                intrusive_list;
+  Intrusive_Forward_List        intrusive_forward_list;
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  benchmark::report("list sort",
+                    Size,
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        list->assign(input.begin(), input.end());
+                        list->sort();
+                        benchmark::do_not_optimise(list->front());
+                      },
+                      1U) /
+                      double(Size));
+
+  benchmark::report("forward_list sort",
+                    Size,
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        forward_list->assign(input.begin(), input.end());
+                        forward_list->sort();
+                        benchmark::do_not_optimise(forward_list->front());
+                      },
+                      1U) /
+                      double(Size));
+
+  benchmark::report("intrusive_list sort",
+                    Size,
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        intrusive_list.clear();
+
+                        for (size_t i = 0U; i < Size; ++i)
+                        {
+                          items[i].value = input[i];
+                        }
+
+                        intrusive_list.assign(items.begin(), items.end());
+                        intrusive_list.sort();
+                        benchmark::do_not_optimise(intrusive_list.front().value);
+                      },
+                      1U) /
+                      double(Size));
+
+  benchmark::report("intrusive_forward_list sort",
+                    Size,
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        intrusive_forward_list.clear();
+
+                        for (size_t i = 0U; i < Size; ++i)
+                        {
+                          items[i].value = input[i];
+                        }
+
+                        intrusive_forward_list.assign(items.begin(), items.end());
+                        intrusive_forward_list.sort();
+                        benchmark::do_not_optimise(intrusive_forward_list.front().value);
+                      },
+                      1U) /
+                      double(Size));
+
+  return 0;
+}
@@ -0,0 +1,163 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Random lower_bound searches of sorted uint32_t keys, with sizes from L1
+// cache to DRAM. Compares the branching binary search, the branchless
+// etl::lower_bound and etl::eytzinger_array.
+// Times are per search.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/eytzinger_array.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Searches = 1024U * 1024U;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> keys(count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed    = (seed * 1103515245U) + 12345U;
+      keys[i] = seed;
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  /// The binary search that etl::lower_bound used before, with a branch on
+  /// each comparison.
+  //***************************************************************************
+  const uint32_t* branching_lower_bound(const uint32_t* first, const uint32_t* last, uint32_t value)
+  {
+    ptrdiff_t count = last - first;
+
+    while (count > 0)
+    {
+      const uint32_t* itr  = first;
+      ptrdiff_t       step = count / 2;
+
+      itr += step;
+
+      if (*itr < value)
+      {
+        first = ++itr;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+
+    return first;
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  void run(const char* name, size_t size, TFunction search)
+  {
+    const std::vector<uint32_t> values = make_keys(Searches, 54321U);
+
+    benchmark::report(name,
+                      size,
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          uint32_t sum = 0U;
+
+                          for (size_t i = 0U; i < values.size(); ++i)
+                          {
+                            sum += search(values[i]);
+                          }
+
+                          benchmark::do_not_optimise(sum);
+                        },
+                        1U) /
+                        double(values.size()));
+  }
+
+  //***************************************************************************
+  void run_size(size_t size)
+  {
+    std::vector<uint32_t> keys = make_keys(size, 12345U);
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    const uint32_t* first = keys.data();
+    const uint32_t* last  = keys.data() + keys.size();
+
+    std::unique_ptr<uint32_t[]>        buffer(new uint32_t[keys.size()]);
+    etl::eytzinger_array_ext<uint32_t> eytzinger(keys.begin(), keys.end(), buffer.get(), keys.size());
+
+    run("branching lower_bound",
+        size,
+        [&](uint32_t value)
+        {
+          const uint32_t* itr = branching_lower_bound(first, last, value);
+          return (itr != last) ? *itr : 0U;
+        });
+
+    run("etl::lower_bound",
+        size,
+        [&](uint32_t value)
+        {
+          const uint32_t* itr = etl::lower_bound(first, last, value);
+          return (itr != last) ? *itr : 0U;
+        });
+
+    run("eytzinger_array lower_bound",
+        size,
+        [&](uint32_t value)
+        {
+          etl::eytzinger_array_ext<uint32_t>::const_iterator itr = eytzinger.lower_bound(value);
+          return (itr != eytzinger.end()) ? *itr : 0U;
+        });
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run_size(1024U);
+  run_size(32U * 1024U);
+  run_size(1024U * 1024U);
+  run_size(16U * 1024U * 1024U);
+
+  return 0;
+}
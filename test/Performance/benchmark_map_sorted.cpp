@@ -0,0 +1,114 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Building an etl::map from sorted input, one insert at a time against the
+// linear time sorted construction, and merging a sorted batch into a map.
+// Each timing includes clearing or rebuilding the map first.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/map.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 256U * 1024U;
+
+  typedef etl::map<uint32_t, uint32_t, Size> Map;
+  typedef std::pair<uint32_t, uint32_t>      Pair;
+} // namespace
+
+int main()
+{
+  std::vector<Pair> evens;
+  std::vector<Pair> odds;
+
+  for (uint32_t i = 0U; i < Size; i += 2U)
+  {
+    evens.push_back(Pair(i, i));
+    odds.push_back(Pair(i + 1U, i));
+  }
+
+  std::unique_ptr<Map> map(new Map);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  benchmark::report("map insert one by one",
+                    evens.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        map->clear();
+                        map->insert(evens.begin(), evens.end());
+                      },
+                      1U,
+                      3U) /
+                      double(evens.size()));
+
+  benchmark::report("map assign sorted_unique",
+                    evens.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        map->clear();
+                        map->assign(etl::sorted_unique_t(), evens.begin(), evens.end());
+                      },
+                      1U,
+                      3U) /
+                      double(evens.size()));
+
+  benchmark::report("map merge one by one",
+                    odds.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        map->assign(etl::sorted_unique_t(), evens.begin(), evens.end());
+                        map->insert(odds.begin(), odds.end());
+                      },
+                      1U,
+                      3U) /
+                      double(odds.size()));
+
+  benchmark::report("map merge insert_sorted",
+                    odds.size(),
+                    benchmark::time_ns(
+                      [&]()
+                      {
+                        map->assign(etl::sorted_unique_t(), evens.begin(), evens.end());
+                        map->insert_sorted(odds.begin(), odds.end());
+                      },
+                      1U,
+                      3U) /
+                      double(odds.size()));
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Merges k sorted uint32_t streams, with k from 2 to 64 and 1M elements in
+// total. Compares chained etl::merge calls, which merge each stream into the
+// result so far, a std::priority_queue of stream heads, and etl::merge_k.
+// Times are per merge.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/kway_merge.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  const size_t Total_Size = 1000U * 1000U;
+
+  typedef std::vector<uint32_t>::const_iterator Iterator;
+  typedef std::pair<Iterator, Iterator>         Range;
+
+  //***************************************************************************
+  std::vector<std::vector<uint32_t> > make_streams(size_t k)
+  {
+    std::vector<std::vector<uint32_t> > streams(k);
+    uint32_t                            seed = 12345U;
+
+    for (size_t i = 0U; i < k; ++i)
+    {
+      streams[i].resize(Total_Size / k);
+
+      for (size_t j = 0U; j < streams[i].size(); ++j)
+      {
+        seed          = (seed * 1103515245U) + 12345U;
+        streams[i][j] = seed;
+      }
+
+      std::sort(streams[i].begin(), streams[i].end());
+    }
+
+    return streams;
+  }
+
+  //***************************************************************************
+  /// Merges each stream in turn into the result so far.
+  //***************************************************************************
+  void chained_merge(const std::vector<std::vector<uint32_t> >& streams, std::vector<uint32_t>& output, std::vector<uint32_t>& temp)
+  {
+    size_t size = 0U;
+
+    for (size_t i = 0U; i < streams.size(); ++i)
+    {
+      uint32_t* last = etl::merge(output.data(), output.data() + size, streams[i].data(), streams[i].data() + streams[i].size(), temp.data());
+      size           = size_t(last - temp.data());
+      output.swap(temp);
+    }
+  }
+
+  //***************************************************************************
+  /// Pops the smallest stream head from a binary heap.
+  //***************************************************************************
+  void heap_merge(const std::vector<Range>& ranges, std::vector<uint32_t>& output)
+  {
+    typedef std::pair<uint32_t, size_t> Head;
+
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head> > heads;
+    std::vector<Range>                                                 remaining(ranges);
+
+    for (size_t i = 0U; i < remaining.size(); ++i)
+    {
+      heads.push(Head(*remaining[i].first++, i));
+    }
+
+    uint32_t* d_first = output.data();
+
+    while (!heads.empty())
+    {
+      const Head head = heads.top();
+      heads.pop();
+
+      *d_first++ = head.first;
+
+      Range& range = remaining[head.second];
+
+      if (range.first != range.second)
+      {
+        heads.push(Head(*range.first++, head.second));
+      }
+    }
+  }
+
+  //***************************************************************************
+  void run_k(size_t k)
+  {
+    const std::vector<std::vector<uint32_t> > streams = make_streams(k);
+    std::vector<Range>                        ranges;
+
+    for (size_t i = 0U; i < k; ++i)
+    {
+      ranges.push_back(Range(streams[i].begin(), streams[i].end()));
+    }
+
+    std::vector<uint32_t> output(Total_Size);
+    std::vector<uint32_t> temp(Total_Size);
+
+    const size_t runs = 10U;
+
+    benchmark::report("chained etl::merge", k, benchmark::time_ns([&]() {
+      chained_merge(streams, output, temp);
+      benchmark::do_not_optimise(output[0]);
+    }, runs));
+
+    benchmark::report("std::priority_queue", k, benchmark::time_ns([&]() {
+      heap_merge(ranges, output);
+      benchmark::do_not_optimise(output[0]);
+    }, runs));
+
+    benchmark::report("etl::merge_k", k, benchmark::time_ns([&]() {
+      etl::merge_k<64>(ranges.begin(), ranges.end(), output.data());
+      benchmark::do_not_optimise(output[0]);
+    }, runs));
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Streams", "Time");
+
+  run_k(2U);
+  run_k(8U);
+  run_k(16U);
+  run_k(32U);
+  run_k(64U);
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Finds the 99th percentile of 1M uint32_t latency samples, with
+// etl::sort, std::nth_element and etl::nth_element.
+// Then sorts the smallest 0.1% to 50% of the samples with std::partial_sort
+// and etl::partial_sort.
+// Times are per call, including a copy of the samples.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 1000U * 1000U;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_samples(bool sorted)
+  {
+    std::vector<uint32_t> samples(Size);
+    uint32_t              seed = 12345U;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      seed       = (seed * 1103515245U) + 12345U;
+      samples[i] = 1000U + (seed % 50000U);
+    }
+
+    if (sorted)
+    {
+      std::sort(samples.begin(), samples.end());
+    }
+
+    return samples;
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  void run(const char* name, size_t size, const std::vector<uint32_t>& samples, TFunction function)
+  {
+    std::vector<uint32_t> data;
+
+    benchmark::report(name, size, benchmark::time_ns([&]() {
+      data = samples;
+      benchmark::do_not_optimise(function(data));
+    }, 10U));
+  }
+
+  //***************************************************************************
+  void run_percentile(const char* name, const std::vector<uint32_t>& samples)
+  {
+    const size_t nth = (Size * 99U) / 100U;
+
+    std::printf("%s\n", name);
+
+    run("etl::sort", Size, samples, [&](std::vector<uint32_t>& data) {
+      etl::sort(data.begin(), data.end());
+      return data[nth];
+    });
+
+    run("std::nth_element", Size, samples, [&](std::vector<uint32_t>& data) {
+      std::nth_element(data.begin(), data.begin() + ptrdiff_t(nth), data.end());
+      return data[nth];
+    });
+
+    run("etl::nth_element", Size, samples, [&](std::vector<uint32_t>& data) {
+      etl::nth_element(data.begin(), data.begin() + ptrdiff_t(nth), data.end());
+      return data[nth];
+    });
+  }
+
+  //***************************************************************************
+  void run_partial_sort(size_t sorted_size, const std::vector<uint32_t>& samples)
+  {
+    run("std::partial_sort", sorted_size, samples, [&](std::vector<uint32_t>& data) {
+      std::partial_sort(data.begin(), data.begin() + ptrdiff_t(sorted_size), data.end());
+      return data[sorted_size - 1U];
+    });
+
+    run("etl::partial_sort", sorted_size, samples, [&](std::vector<uint32_t>& data) {
+      etl::partial_sort(data.begin(), data.begin() + ptrdiff_t(sorted_size), data.end());
+      return data[sorted_size - 1U];
+    });
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  const std::vector<uint32_t> random_samples = make_samples(false);
+  const std::vector<uint32_t> sorted_samples = make_samples(true);
+
+  run_percentile("Random samples", random_samples);
+  run_percentile("Sorted samples", sorted_samples);
+
+  std::printf("partial_sort of random samples\n");
+  run_partial_sort(Size / 1000U, random_samples);
+  run_partial_sort(Size / 100U, random_samples);
+  run_partial_sort(Size / 10U, random_samples);
+  run_partial_sort(Size / 2U, random_samples);
+
+  return 0;
+}
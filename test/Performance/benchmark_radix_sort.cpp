@@ -0,0 +1,103 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Sorting random uint32_t and uint64_t keys with etl::radix_sort against
+// etl::sort, from 1K to 1M elements.
+// Each timing includes copying the unsorted input first.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  template <typename T>
+  void run(const char* type_name, size_t size)
+  {
+    std::vector<T> input(size);
+    std::vector<T> data(size);
+    std::vector<T> buffer(size);
+
+    uint64_t seed = 12345U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed     = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+      input[i] = static_cast<T>(seed >> (64U - (sizeof(T) * 8U)));
+    }
+
+    const size_t runs = (size < 100000U) ? 20U : 1U;
+
+    char name[64];
+
+    std::snprintf(name, sizeof(name), "sort %s", type_name);
+    benchmark::report(name,
+                      size,
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          data = input;
+                          etl::sort(data.begin(), data.end());
+                          benchmark::do_not_optimise(data.front());
+                        },
+                        runs) /
+                        double(size));
+
+    std::snprintf(name, sizeof(name), "radix_sort %s", type_name);
+    benchmark::report(name,
+                      size,
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          data = input;
+                          etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+                          benchmark::do_not_optimise(data.front());
+                        },
+                        runs) /
+                        double(size));
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  const size_t sizes[] = {1024U, 16U * 1024U, 256U * 1024U, 1024U * 1024U};
+
+  for (size_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); ++i)
+  {
+    run<uint32_t>("uint32_t", sizes[i]);
+    run<uint64_t>("uint64_t", sizes[i]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// set_intersection of sorted uint32_t posting lists, with the smaller list
+// from 20 to 200K elements and the larger fixed at 200K.
+// Compares a merge that walks both lists, etl::set_intersection, which
+// gallops when the sizes are skewed, and the sorted_unique overload, which
+// uses SIMD when the sizes are similar.
+// Times are per intersection.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  const size_t Large_Size = 200U * 1000U;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_list(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> values(count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed      = (seed * 1103515245U) + 12345U;
+      values[i] = seed % (Large_Size * 4U);
+    }
+
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    return values;
+  }
+
+  //***************************************************************************
+  /// Walks both lists one element at a time.
+  //***************************************************************************
+  uint32_t* linear_intersection(const uint32_t* first1, const uint32_t* last1, const uint32_t* first2, const uint32_t* last2, uint32_t* d_first)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (*first1 < *first2)
+      {
+        ++first1;
+      }
+      else
+      {
+        if (!(*first2 < *first1))
+        {
+          *d_first++ = *first1++;
+        }
+
+        ++first2;
+      }
+    }
+
+    return d_first;
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  void run(const char* name, size_t size, TFunction function)
+  {
+    const size_t runs = (size < 1000U) ? 2000U : 20U;
+
+    benchmark::report(name, size, benchmark::time_ns([&]() { benchmark::do_not_optimise(function()); }, runs));
+  }
+
+  //***************************************************************************
+  void run_size(size_t size, const std::vector<uint32_t>& large)
+  {
+    const std::vector<uint32_t> small = make_list(size, 777U);
+    std::vector<uint32_t>       output(small.size());
+
+    const uint32_t* first1 = small.data();
+    const uint32_t* last1  = small.data() + small.size();
+    const uint32_t* first2 = large.data();
+    const uint32_t* last2  = large.data() + large.size();
+
+    run("linear set_intersection", size, [&]() { return linear_intersection(first1, last1, first2, last2, output.data()) - output.data(); });
+    run("etl::set_intersection", size, [&]() { return etl::set_intersection(first1, last1, first2, last2, output.data()) - output.data(); });
+    run("etl::set_intersection sorted_unique",
+        size,
+        [&]() { return etl::set_intersection(etl::sorted_unique_t(), first1, last1, first2, last2, output.data()) - output.data(); });
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  const std::vector<uint32_t> large = make_list(Large_Size, 12345U);
+
+  run_size(20U, large);
+  run_size(200U, large);
+  run_size(2000U, large);
+  run_size(20000U, large);
+  run_size(200000U, large);
+
+  return 0;
+}
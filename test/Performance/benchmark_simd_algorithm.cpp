@@ -0,0 +1,168 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// find, count, min_element, equal and ranges::mismatch over 64KB of 8, 16 and 32 bit values.
+// Compares the scalar loops with the etl algorithms, which use SIMD when the
+// profile enables ETL_USING_SIMD_ALGORITHMS.
+// Times are per call.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Bytes = 64U * 1024U;
+  const size_t Runs  = 2000U;
+
+  //***************************************************************************
+  template <typename T>
+  const T* scalar_find(const T* first, const T* last, T value)
+  {
+    while ((first != last) && (*first != value))
+    {
+      ++first;
+    }
+
+    return first;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  size_t scalar_count(const T* first, const T* last, T value)
+  {
+    size_t n = 0U;
+
+    while (first != last)
+    {
+      n += (*first++ == value) ? 1U : 0U;
+    }
+
+    return n;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  const T* scalar_min_element(const T* first, const T* last)
+  {
+    const T* minimum = first;
+
+    while (++first < last)
+    {
+      if (*first < *minimum)
+      {
+        minimum = first;
+      }
+    }
+
+    return minimum;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool scalar_equal(const T* first1, const T* last1, const T* first2)
+  {
+    while (first1 != last1)
+    {
+      if (*first1++ != *first2++)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  const T* scalar_mismatch(const T* first1, const T* last1, const T* first2)
+  {
+    while ((first1 != last1) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return first1;
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  void run(const char* name, size_t size, TFunction function)
+  {
+    benchmark::report(name, size, benchmark::time_ns([&]() { benchmark::do_not_optimise(function()); }, Runs));
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run_type(const char* type_name)
+  {
+    const size_t   size = Bytes / sizeof(T);
+    std::vector<T> values(size);
+    uint32_t       seed = 12345U;
+
+    // Small values, so that the one searched for is only at the end.
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed      = (seed * 1103515245U) + 12345U;
+      values[i] = static_cast<T>((seed >> 16U) % 100U);
+    }
+
+    values[size - 1U] = static_cast<T>(100);
+
+    const std::vector<T> copy(values);
+    const T*             first = values.data();
+    const T*             last  = values.data() + size;
+    const T              value = static_cast<T>(100);
+
+    std::printf("%s\n", type_name);
+
+    run("scalar find", size, [&]() { return scalar_find(first, last, value) - first; });
+    run("etl::find", size, [&]() { return etl::find(first, last, value) - first; });
+    run("scalar count", size, [&]() { return scalar_count(first, last, static_cast<T>(7)); });
+    run("etl::count", size, [&]() { return etl::count(first, last, static_cast<T>(7)); });
+    run("scalar min_element", size, [&]() { return scalar_min_element(first, last) - first; });
+    run("etl::min_element", size, [&]() { return etl::min_element(first, last) - first; });
+    run("scalar equal", size, [&]() { return scalar_equal(first, last, copy.data()) ? 1 : 0; });
+    run("etl::equal", size, [&]() { return etl::equal(first, last, copy.data()) ? 1 : 0; });
+    run("scalar mismatch", size, [&]() { return scalar_mismatch(first, last, copy.data()) - first; });
+    run("etl::ranges::mismatch", size, [&]() { return etl::ranges::mismatch(first, last, copy.data(), copy.data() + size).in1 - first; });
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run_type<uint8_t>("uint8_t");
+  run_type<uint16_t>("uint16_t");
+  run_type<uint32_t>("uint32_t");
+
+  return 0;
+}
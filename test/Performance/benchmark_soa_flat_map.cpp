@@ -0,0 +1,110 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Random lookups in small and large etl::flat_map and etl::soa_flat_map.
+// Times are per lookup.
+
+#include "benchmark.h"
+
+#include "etl/flat_map.h"
+#include "etl/soa_flat_map.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Lookups = 1024U * 1024U;
+
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> keys(count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed    = (seed * 1103515245U) + 12345U;
+      keys[i] = seed;
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void run(const char* name, const std::vector<uint32_t>& keys)
+  {
+    std::unique_ptr<TMap> map(new TMap);
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      map->insert(typename TMap::value_type(keys[i], uint32_t(i)));
+    }
+
+    // Half of the lookups are for keys that are present.
+    std::vector<uint32_t> lookups = make_keys(Lookups, 54321U);
+
+    for (size_t i = 0U; i < lookups.size(); i += 2U)
+    {
+      lookups[i] = keys[(lookups[i] >> 8) % keys.size()];
+    }
+
+    benchmark::report(name,
+                      keys.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          uint32_t sum = 0U;
+
+                          for (size_t i = 0U; i < lookups.size(); ++i)
+                          {
+                            typename TMap::const_iterator itr = map->find(lookups[i]);
+                            sum += (itr != map->cend()) ? itr->second : 0U;
+                          }
+
+                          benchmark::do_not_optimise(sum);
+                        },
+                        1U) /
+                        double(lookups.size()));
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<uint32_t> small_keys = make_keys(64U, 12345U);
+  const std::vector<uint32_t> large_keys = make_keys(16U * 1024U, 12345U);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run<etl::flat_map<uint32_t, uint32_t, 64U>>("flat_map find", small_keys);
+  run<etl::soa_flat_map<uint32_t, uint32_t, 64U>>("soa_flat_map find", small_keys);
+  run<etl::flat_map<uint32_t, uint32_t, 16U * 1024U>>("flat_map find", large_keys);
+  run<etl::soa_flat_map<uint32_t, uint32_t, 16U * 1024U>>("soa_flat_map find", large_keys);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Sorting 16K 32 bit values with etl::pdq_sort, the etl::shell_sort that was
+// the non-STL etl::sort, and std::sort, over random, already sorted, reversed
+// and few unique inputs.
+// Each timing includes copying the unsorted input first.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 16U * 1024U;
+
+  //***************************************************************************
+  template <typename TSort>
+  void run(const char* name, const std::vector<uint32_t>& input, TSort sort)
+  {
+    std::vector<uint32_t> data(input.size());
+
+    benchmark::report(name,
+                      input.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          data = input;
+                          sort(data.begin(), data.end());
+                          benchmark::do_not_optimise(data.front());
+                        },
+                        1U,
+                        5U) /
+                        double(input.size()));
+  }
+
+  //***************************************************************************
+  struct pdq
+  {
+    void operator()(std::vector<uint32_t>::iterator first, std::vector<uint32_t>::iterator last) const
+    {
+      etl::pdq_sort(first, last);
+    }
+  };
+
+  struct shell
+  {
+    void operator()(std::vector<uint32_t>::iterator first, std::vector<uint32_t>::iterator last) const
+    {
+      etl::shell_sort(first, last);
+    }
+  };
+
+  struct stl
+  {
+    void operator()(std::vector<uint32_t>::iterator first, std::vector<uint32_t>::iterator last) const
+    {
+      std::sort(first, last);
+    }
+  };
+} // namespace
+
+int main()
+{
+  std::vector<uint32_t> random(Size);
+  std::vector<uint32_t> sorted(Size);
+  std::vector<uint32_t> reversed(Size);
+  std::vector<uint32_t> few_unique(Size);
+
+  uint32_t seed = 12345U;
+
+  for (uint32_t i = 0U; i < Size; ++i)
+  {
+    seed          = (seed * 1103515245U) + 12345U;
+    random[i]     = seed;
+    sorted[i]     = i;
+    reversed[i]   = uint32_t(Size) - i;
+    few_unique[i] = (seed >> 16) % 8U;
+  }
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run("pdq_sort random", random, pdq());
+  run("shell_sort random", random, shell());
+  run("std::sort random", random, stl());
+
+  run("pdq_sort sorted", sorted, pdq());
+  run("shell_sort sorted", sorted, shell());
+  run("std::sort sorted", sorted, stl());
+
+  run("pdq_sort reversed", reversed, pdq());
+  run("shell_sort reversed", reversed, shell());
+  run("std::sort reversed", reversed, stl());
+
+  run("pdq_sort few unique", few_unique, pdq());
+  run("shell_sort few unique", few_unique, shell());
+  run("std::sort few unique", few_unique, stl());
+
+  return 0;
+}
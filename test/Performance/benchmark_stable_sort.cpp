@@ -0,0 +1,107 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Stable sorting 20K timestamped events with the etl::insertion_sort that was
+// the non-STL etl::stable_sort, the merge sort without a scratch buffer, the
+// merge sort with an etl::vector_ext scratch buffer of half the length, and
+// std::stable_sort.
+// Each timing includes copying the unsorted input first.
+// Times are per element.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 20000U;
+
+  struct Event
+  {
+    uint32_t timestamp;
+    uint32_t id;
+  };
+
+  bool operator<(const Event& lhs, const Event& rhs)
+  {
+    return lhs.timestamp < rhs.timestamp;
+  }
+
+  typedef std::vector<Event>::iterator Iterator;
+
+  //***************************************************************************
+  template <typename TSort>
+  void run(const char* name, const std::vector<Event>& input, TSort sort)
+  {
+    std::vector<Event> data(input.size());
+
+    benchmark::report(name,
+                      input.size(),
+                      benchmark::time_ns(
+                        [&]()
+                        {
+                          data = input;
+                          sort(data.begin(), data.end());
+                          benchmark::do_not_optimise(data.front().id);
+                        },
+                        1U,
+                        5U) /
+                        double(input.size()));
+  }
+} // namespace
+
+int main()
+{
+  std::vector<Event> events(Size);
+
+  uint32_t seed = 12345U;
+
+  for (uint32_t i = 0U; i < Size; ++i)
+  {
+    seed                = (seed * 1103515245U) + 12345U;
+    events[i].timestamp = (seed >> 8) % 5000U;
+    events[i].id        = i;
+  }
+
+  Event                  buffer_storage[Size / 2U];
+  etl::vector_ext<Event> buffer(buffer_storage, Size / 2U);
+  buffer.resize(Size / 2U);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  run("insertion_sort", events, [](Iterator first, Iterator last) { etl::insertion_sort(first, last); });
+  run("stable_sort no buffer", events, [](Iterator first, Iterator last) { etl::stable_sort(first, last, static_cast<Event*>(ETL_NULLPTR), static_cast<Event*>(ETL_NULLPTR)); });
+  run("stable_sort with buffer", events, [&](Iterator first, Iterator last) { etl::stable_sort(first, last, buffer.begin(), buffer.end()); });
+  run("std::stable_sort", events, [](Iterator first, Iterator last) { std::stable_sort(first, last); });
+
+  return 0;
+}
@@ -0,0 +1,175 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Substring and character set searches over 1MB of text.
+// 'repetitive' searches a run of 'a' ending in 'b' for 'aa...ab', which is the
+// worst case for a search that compares at every position.
+// 'text' searches pseudo random words for a phrase taken from near the end.
+// 'find_first_of' counts the fields separated by any of " ,;=", then
+// searches for characters that are not in the text.
+// Compares etl::search, which the strings used before, std::string_view and
+// etl::string_view. Times are per search.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/string_view.h"
+
+#include <string>
+#include <string_view>
+
+namespace
+{
+  const size_t Text_Size = 1000U * 1000U;
+
+  //***************************************************************************
+  std::string make_text()
+  {
+    std::string text;
+    uint32_t    seed = 1U;
+
+    while (text.size() < Text_Size)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      text += char('a' + ((seed >> 16) % 26U));
+
+      if (((seed >> 8) % 6U) == 0U)
+      {
+        text += ((seed >> 4) % 4U == 0U) ? ',' : ' ';
+      }
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  /// The nested loop that find_first_of used before.
+  //***************************************************************************
+  size_t nested_find_first_of(const std::string& text, size_t position, const char* characters, size_t length)
+  {
+    for (size_t i = position; i < text.size(); ++i)
+    {
+      for (size_t j = 0U; j < length; ++j)
+      {
+        if (text[i] == characters[j])
+        {
+          return i;
+        }
+      }
+    }
+
+    return std::string::npos;
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  void run(const char* name, size_t size, TFunction function)
+  {
+    benchmark::report(name, size, benchmark::time_ns([&]() { benchmark::do_not_optimise(function()); }, 5U));
+  }
+
+  //***************************************************************************
+  void run_find(const char* suffix, const std::string& text, const std::string& pattern)
+  {
+    const std::string_view std_text(text);
+    const etl::string_view etl_text(text.data(), text.size());
+    const etl::string_view etl_pattern(pattern.data(), pattern.size());
+
+    const std::string search_name = std::string("etl::search ") + suffix;
+    const std::string std_name    = std::string("std::string_view::find ") + suffix;
+    const std::string etl_name    = std::string("etl::string_view::find ") + suffix;
+
+    run(search_name.c_str(), pattern.size(), [&]() { return etl::search(text.begin(), text.end(), pattern.begin(), pattern.end()) - text.begin(); });
+    run(std_name.c_str(), pattern.size(), [&]() { return std_text.find(pattern); });
+    run(etl_name.c_str(), pattern.size(), [&]() { return etl_text.find(etl_pattern); });
+  }
+
+  //***************************************************************************
+  template <typename TView>
+  size_t count_fields(const TView& text, const TView& delimiters)
+  {
+    size_t count    = 0U;
+    size_t position = text.find_first_of(delimiters);
+
+    while (position != TView::npos)
+    {
+      ++count;
+      position = text.find_first_of(delimiters, position + 1U);
+    }
+
+    return count;
+  }
+} // namespace
+
+int main()
+{
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  const std::string repetitive = std::string(Text_Size - 1U, 'a') + 'b';
+  const std::string text = make_text();
+
+  for (size_t size = 8U; size <= 512U; size *= 4U)
+  {
+    run_find("repetitive", repetitive, std::string(size - 1U, 'a') + 'b');
+  }
+
+  for (size_t size = 8U; size <= 512U; size *= 4U)
+  {
+    run_find("text", text, text.substr(Text_Size - 1000U, size));
+  }
+
+  const char* delimiters = " ,;=";
+
+  const std::string_view std_text(text);
+  const etl::string_view etl_text(text.data(), text.size());
+
+  run("nested find_first_of", 4U,
+      [&]()
+      {
+        size_t count    = 0U;
+        size_t position = nested_find_first_of(text, 0U, delimiters, 4U);
+
+        while (position != std::string::npos)
+        {
+          ++count;
+          position = nested_find_first_of(text, position + 1U, delimiters, 4U);
+        }
+
+        return count;
+      });
+  run("std::string_view::find_first_of", 4U, [&]() { return count_fields(std_text, std::string_view(delimiters)); });
+  run("etl::string_view::find_first_of", 4U, [&]() { return count_fields(etl_text, etl::string_view(delimiters)); });
+
+  const char* absent = ";=\n\t";
+
+  run("nested find_first_of absent", 4U, [&]() { return nested_find_first_of(text, 0U, absent, 4U); });
+  run("std::string_view::find_first_of absent", 4U, [&]() { return std_text.find_first_of(absent, 0U, 4U); });
+  run("etl::string_view::find_first_of absent", 4U, [&]() { return etl_text.find_first_of(absent, 0U, 4U); });
+
+  return 0;
+}
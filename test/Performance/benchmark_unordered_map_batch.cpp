@@ -0,0 +1,163 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Lookups in an unordered_map that does not fit in the cache, one at a time
+// and in batches.
+
+#include "benchmark.h"
+
+#include "etl/unordered_map.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  const size_t Size    = 4U * 1024U * 1024U;
+  const size_t Lookups = 1024U * 1024U;
+
+  // The number of keys passed to each batch call.
+  const size_t Chunk_Size = 64U;
+
+  typedef etl::unordered_map<uint32_t, uint32_t, Size, Size> Map;
+
+  //***************************************************************************
+  void run_find(const char* name, const Map& map, const std::vector<uint32_t>& keys)
+  {
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        uint32_t sum = 0U;
+
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          Map::const_iterator itr = map.find(keys[i]);
+
+          if (itr != map.end())
+          {
+            sum += itr->second;
+          }
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      5U);
+
+    benchmark::report(name, map.size(), ns / double(keys.size()));
+  }
+
+  //***************************************************************************
+  void run_find_batch(const char* name, const Map& map, const std::vector<uint32_t>& keys)
+  {
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        Map::const_iterator results[Chunk_Size];
+        uint32_t            sum = 0U;
+
+        for (size_t offset = 0U; offset < keys.size(); offset += Chunk_Size)
+        {
+          map.find_batch(etl::span<const uint32_t>(keys.data() + offset, Chunk_Size), etl::span<Map::const_iterator>(results));
+
+          for (size_t i = 0U; i < Chunk_Size; ++i)
+          {
+            if (results[i] != map.end())
+            {
+              sum += results[i]->second;
+            }
+          }
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      5U);
+
+    benchmark::report(name, map.size(), ns / double(keys.size()));
+  }
+
+  //***************************************************************************
+  void run_contains_batch(const char* name, const Map& map, const std::vector<uint32_t>& keys)
+  {
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        bool   results[Chunk_Size];
+        size_t sum = 0U;
+
+        for (size_t offset = 0U; offset < keys.size(); offset += Chunk_Size)
+        {
+          map.contains_batch(etl::span<const uint32_t>(keys.data() + offset, Chunk_Size), etl::span<bool>(results));
+
+          for (size_t i = 0U; i < Chunk_Size; ++i)
+          {
+            sum += results[i] ? 1U : 0U;
+          }
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      5U);
+
+    benchmark::report(name, map.size(), ns / double(keys.size()));
+  }
+} // namespace
+
+int main()
+{
+  std::unique_ptr<Map> map(new Map);
+
+  uint32_t seed = 12345U;
+
+  while (!map->full())
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    map->insert(Map::value_type(seed, seed >> 8));
+  }
+
+  // Half of the keys are present, in random order.
+  std::vector<uint32_t> keys(Lookups);
+  std::vector<uint32_t> present;
+
+  for (Map::const_iterator itr = map->begin(); itr != map->end(); ++itr)
+  {
+    present.push_back(itr->first);
+  }
+
+  for (size_t i = 0U; i < keys.size(); ++i)
+  {
+    seed    = (seed * 1103515245U) + 12345U;
+    keys[i] = ((i % 2U) == 0U) ? present[seed % present.size()] : seed;
+  }
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time per key");
+
+  run_find("find", *map, keys);
+  run_find_batch("find_batch", *map, keys);
+  run_contains_batch("contains_batch", *map, keys);
+
+  return 0;
+}
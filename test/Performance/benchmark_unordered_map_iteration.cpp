@@ -0,0 +1,110 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// Iterating over and clearing an unordered_map with many more buckets than
+// elements.
+
+#include "benchmark.h"
+
+#include "etl/unordered_map.h"
+
+#include <memory>
+
+namespace
+{
+  const size_t Buckets = 64U * 1024U;
+  const size_t Size    = 1024U;
+
+  typedef etl::unordered_map<uint32_t, uint32_t, Size, Buckets> Map;
+
+  //***************************************************************************
+  void fill(Map& map, size_t size)
+  {
+    uint32_t seed = 12345U;
+
+    while (map.size() < size)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      map.insert(Map::value_type(seed, seed >> 8));
+    }
+  }
+
+  //***************************************************************************
+  void run_iterate(Map& map, size_t size)
+  {
+    map.clear();
+    fill(map, size);
+
+    const double ns = benchmark::time_ns(
+      [&]()
+      {
+        uint32_t sum = 0U;
+
+        for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+        {
+          sum += itr->second;
+        }
+
+        benchmark::do_not_optimise(sum);
+      },
+      100U);
+
+    benchmark::report("iterate", size, ns);
+  }
+
+  //***************************************************************************
+  void run_clear(Map& map, size_t size)
+  {
+    double total = 0.0;
+
+    for (int i = 0; i < 100; ++i)
+    {
+      fill(map, size);
+
+      total += benchmark::time_ns([&]() { map.clear(); }, 1U, 1U);
+    }
+
+    benchmark::report("clear", size, total / 100.0);
+  }
+} // namespace
+
+int main()
+{
+  std::unique_ptr<Map> map(new Map);
+
+  std::printf("%-40s %8s %15s\n", "Benchmark", "Size", "Time");
+
+  const size_t sizes[] = {16U, 256U, 1024U};
+
+  for (size_t i = 0U; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+  {
+    run_iterate(*map, sizes[i]);
+    run_clear(*map, sizes[i]);
+  }
+
+  return 0;
+}
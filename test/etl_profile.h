@@ -72,6 +72,7 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_SET
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MULTISET
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_MAP
 #define ETL_POLYMORPHIC_UNORDERED_MAP
 #define ETL_POLYMORPHIC_UNORDERED_MULTIMAP
 #define ETL_POLYMORPHIC_UNORDERED_SET
@@ -0,0 +1,169 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <iterator>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "etl/adler32.h"
+
+namespace
+{
+  //***************************************************************************
+  uint32_t reference_adler32(const uint8_t* begin, const uint8_t* end)
+  {
+    uint32_t s1 = 1U;
+    uint32_t s2 = 0U;
+
+    while (begin != end)
+    {
+      s1 = (s1 + *begin++) % 65521U;
+      s2 = (s2 + s1) % 65521U;
+    }
+
+    return (s2 << 16U) | s1;
+  }
+
+  SUITE(test_adler32)
+  {
+    //*************************************************************************
+    TEST(test_adler32_constructor)
+    {
+      std::string data("123456789");
+
+      uint32_t sum = etl::adler32(data.begin(), data.end());
+
+      CHECK_EQUAL(0x091E01DEUL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_wikipedia)
+    {
+      std::string data("Wikipedia");
+
+      uint32_t sum = etl::adler32(data.begin(), data.end());
+
+      CHECK_EQUAL(0x11E60398UL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_empty)
+    {
+      etl::adler32 adler32_calculator;
+
+      CHECK_EQUAL(1UL, adler32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_values)
+    {
+      std::string data("123456789");
+
+      etl::adler32 adler32_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        adler32_calculator.add(static_cast<uint8_t>(data[i]));
+      }
+
+      uint32_t sum = adler32_calculator;
+
+      CHECK_EQUAL(0x091E01DEUL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_range)
+    {
+      std::string data("123456789");
+
+      etl::adler32 adler32_calculator;
+
+      adler32_calculator.add(data.begin(), data.end());
+
+      uint32_t sum = adler32_calculator.value();
+
+      CHECK_EQUAL(0x091E01DEUL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::adler32 adler32_calculator;
+
+      std::copy(data.begin(), data.end(), adler32_calculator.input());
+
+      uint32_t sum = adler32_calculator.value();
+
+      CHECK_EQUAL(0x091E01DEUL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_range_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 7U) + 3U);
+      }
+
+      // Pointer ranges may be added in blocks.
+      for (size_t first = 0U; first < 4U; ++first)
+      {
+        for (size_t length = 0U; length < (data.size() - first); length += 61U)
+        {
+          const uint8_t* begin = data.data() + first;
+
+          CHECK_EQUAL(reference_adler32(begin, begin + length), etl::adler32(begin, begin + length).value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_range_long_blocks)
+    {
+      // All 0xFF gives the largest sums, and is longer than one SIMD block.
+      std::vector<uint8_t> data(100000U, 0xFFU);
+
+      const uint8_t* begin = data.data();
+      const uint8_t* end   = data.data() + data.size();
+
+      etl::adler32 adler32_calculator;
+
+      adler32_calculator.add(begin, begin + 3U);
+      adler32_calculator.add(begin + 3U, end);
+
+      CHECK_EQUAL(reference_adler32(begin, end), adler32_calculator.value());
+    }
+  }
+} // namespace
@@ -39,6 +39,7 @@ SOFTWARE.
 #include <array>
 #include <forward_list>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
 #include <numeric>
@@ -140,6 +141,78 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  // Compares find, count, min_element, max_element, minmax_element, equal and
+  // ranges::mismatch with the STL for pointers to arithmetic values, over
+  // sizes and offsets that cover the vector and scalar paths of the SIMD
+  // algorithms.
+  // Returns the number of differences.
+  //***************************************************************************
+  template <typename T>
+  int contiguous_arithmetic_differences(int range)
+  {
+    std::mt19937 generator(42);
+    int          differences = 0;
+
+    for (size_t size = 0U; size <= 150U; ++size)
+    {
+      for (size_t offset = 0U; offset < 3U; ++offset)
+      {
+        std::vector<T> values(size + offset);
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = static_cast<T>(static_cast<int>(generator() % static_cast<unsigned>((2 * range) + 1)) - range);
+        }
+
+        const T* first = values.data() + offset;
+        const T* last  = first + size;
+
+        for (int i = -range - 1; i <= range + 1; ++i)
+        {
+          const T value = static_cast<T>(i);
+
+          differences += (std::find(first, last, value) != etl::find(first, last, value)) ? 1 : 0;
+          differences += (std::count(first, last, value) != etl::count(first, last, value)) ? 1 : 0;
+        }
+
+        differences += (std::min_element(first, last) != etl::min_element(first, last)) ? 1 : 0;
+        differences += (std::max_element(first, last) != etl::max_element(first, last)) ? 1 : 0;
+        differences += (std::minmax_element(first, last).first != etl::minmax_element(first, last).first) ? 1 : 0;
+        differences += (std::minmax_element(first, last).second != etl::minmax_element(first, last).second) ? 1 : 0;
+
+        std::vector<T> copy(first, last);
+
+        differences += etl::equal(first, last, copy.data()) ? 0 : 1;
+        differences += etl::equal(first, last, copy.data(), copy.data() + copy.size()) ? 0 : 1;
+        differences += (size != 0U) && etl::equal(first, last, copy.data(), copy.data() + copy.size() - 1U) ? 1 : 0;
+
+#if ETL_USING_CPP17
+        const T* copy_first = copy.data();
+        const T* copy_last  = copy_first + copy.size();
+
+        differences += (etl::ranges::mismatch(first, last, copy_first, copy_last).in1 != last) ? 1 : 0;
+        differences += (size != 0U) && (etl::ranges::mismatch(first, last, copy_first, copy_last - 1).in1 != (last - 1)) ? 1 : 0;
+        differences += (size != 0U) && (etl::ranges::mismatch(first, last - 1, copy_first, copy_last).in2 != (copy_last - 1)) ? 1 : 0;
+#endif
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          copy[i] = static_cast<T>(copy[i] + 1);
+          differences += etl::equal(first, last, copy.data()) ? 1 : 0;
+#if ETL_USING_CPP17
+          const auto result = etl::ranges::mismatch(first, last, copy_first, copy_last);
+
+          differences += ((result.in1 != (first + i)) || (result.in2 != (copy_first + i))) ? 1 : 0;
+#endif
+          copy[i] = first[i];
+        }
+      }
+    }
+
+    return differences;
+  }
+
   SUITE(test_algorithm)
   {
     //*************************************************************************
@@ -705,6 +778,95 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(lower_bound_upper_bound_arithmetic_pointers)
+    {
+      // Every size up to 40, with duplicates, for int and double keys.
+      for (size_t size = 0U; size <= 40U; ++size)
+      {
+        std::vector<int>    ints;
+        std::vector<double> doubles;
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          ints.push_back(int(i / 3U) * 2);
+          doubles.push_back(double(i / 3U) * 2.0);
+        }
+
+        const int*    ifirst = ints.data();
+        const int*    ilast  = ints.data() + ints.size();
+        const double* dfirst = doubles.data();
+        const double* dlast  = doubles.data() + doubles.size();
+
+        for (int key = -1; key <= int(size); ++key)
+        {
+          CHECK_EQUAL(std::lower_bound(ifirst, ilast, key), etl::lower_bound(ifirst, ilast, key));
+          CHECK_EQUAL(std::upper_bound(ifirst, ilast, key), etl::upper_bound(ifirst, ilast, key));
+          CHECK_EQUAL(std::binary_search(ifirst, ilast, key), etl::binary_search(ifirst, ilast, key));
+
+          CHECK_EQUAL(std::lower_bound(dfirst, dlast, key + 0.5), etl::lower_bound(dfirst, dlast, key + 0.5));
+          CHECK_EQUAL(std::upper_bound(dfirst, dlast, double(key)), etl::upper_bound(dfirst, dlast, double(key)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(lower_bound_upper_bound_arithmetic_pointers_greater)
+    {
+      int data[] = {9, 9, 7, 5, 5, 5, 3, 1, 0};
+
+      for (int key = -1; key <= 10; ++key)
+      {
+        CHECK_EQUAL(std::lower_bound(std::begin(data), std::end(data), key, std::greater<int>()),
+                    etl::lower_bound(std::begin(data), std::end(data), key, etl::greater<int>()));
+        CHECK_EQUAL(std::upper_bound(std::begin(data), std::end(data), key, std::greater<int>()),
+                    etl::upper_bound(std::begin(data), std::end(data), key, etl::greater<int>()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(contiguous_arithmetic_find_count_min_max_equal)
+    {
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<int8_t>(5));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<uint8_t>(130));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<char>(5));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<int16_t>(300));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<uint16_t>(100));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<int32_t>(50));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<uint32_t>(50));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<int64_t>(10));
+      CHECK_EQUAL(0, contiguous_arithmetic_differences<uint64_t>(10));
+    }
+
+    //*************************************************************************
+    TEST(contiguous_arithmetic_find_count_limits)
+    {
+      std::vector<int32_t>  ints(100U, std::numeric_limits<int32_t>::min());
+      std::vector<uint32_t> uints(100U, std::numeric_limits<uint32_t>::max());
+
+      ints[37]  = std::numeric_limits<int32_t>::max();
+      uints[71] = 0U;
+
+      CHECK_EQUAL(ints.data() + 37, etl::max_element(ints.data(), ints.data() + ints.size()));
+      CHECK_EQUAL(ints.data(), etl::min_element(ints.data(), ints.data() + ints.size()));
+      CHECK_EQUAL(uints.data() + 71, etl::min_element(uints.data(), uints.data() + uints.size()));
+      CHECK_EQUAL(uints.data() + 99, etl::minmax_element(uints.data(), uints.data() + uints.size()).second);
+    }
+
+    //*************************************************************************
+    TEST(contiguous_arithmetic_find_count_mixed_types)
+    {
+      std::vector<unsigned char> bytes(100U, 255U);
+      std::vector<short>         shorts(100U, short(-1));
+
+      // The values are compared after the usual arithmetic conversions.
+      CHECK_EQUAL(bytes.data() + bytes.size(), etl::find(bytes.data(), bytes.data() + bytes.size(), -1));
+      CHECK_EQUAL(0, etl::count(bytes.data(), bytes.data() + bytes.size(), 511));
+      CHECK_EQUAL(100, etl::count(bytes.data(), bytes.data() + bytes.size(), 255L));
+      CHECK_EQUAL(shorts.data() + shorts.size(), etl::find(shorts.data(), shorts.data() + shorts.size(), 65535));
+      CHECK_EQUAL(100, etl::count(shorts.data(), shorts.data() + shorts.size(), -1L));
+    }
+
     //*************************************************************************
     TEST(upper_bound_random_iterator)
     {
@@ -2187,6 +2349,43 @@ namespace
       CHECK(std::is_sorted(output2.begin(), output2.end()));
     }
 
+    //*************************************************************************
+    TEST(partial_sort_and_partial_sort_copy_large_ranges)
+    {
+      std::vector<int> input(2000);
+
+      for (size_t i = 0; i < input.size(); ++i)
+      {
+        input[i] = int((i * 7919U) % 701U);
+      }
+
+      const int sizes[] = {1, 10, 62, 63, 100, 1000, 2000};
+
+      for (int size : sizes)
+      {
+        std::vector<int> data1(input);
+        std::vector<int> data2(input);
+
+        std::partial_sort(data1.begin(), data1.begin() + size, data1.end());
+        etl::partial_sort(data2.begin(), data2.begin() + size, data2.end());
+
+        CHECK(std::equal(data1.begin(), data1.begin() + size, data2.begin()));
+
+        std::sort(data1.begin(), data1.end());
+        std::sort(data2.begin(), data2.end());
+        CHECK(data1 == data2);
+
+        std::vector<int> output1(size_t(size) + 10U);
+        std::vector<int> output2(size_t(size) + 10U);
+
+        std::vector<int>::iterator end1 = std::partial_sort_copy(input.begin(), input.end(), output1.begin(), output1.end(), Greater());
+        std::vector<int>::iterator end2 = etl::partial_sort_copy(input.begin(), input.end(), output2.begin(), output2.end(), Greater());
+
+        CHECK_EQUAL(std::distance(output1.begin(), end1), std::distance(output2.begin(), end2));
+        CHECK(output1 == output2);
+      }
+    }
+
     //*************************************************************************
     TEST(find)
     {
@@ -2516,6 +2715,10 @@ namespace
       Data data1;
       Data data2(3);
 
+      // Storage for the empty range, so that GCC does not see a null begin() and
+      // report a potential null dereference at -O1.
+      data1.reserve(1);
+
       Data::iterator result = etl::move_s(data1.begin(), data1.end(), data2.begin(), data2.end());
 
       CHECK(data2.begin() == result);
@@ -2533,6 +2736,10 @@ namespace
 
       Data data2;
 
+      // Storage for the empty range, so that GCC does not see a null begin() and
+      // report a potential null dereference at -O1.
+      data2.reserve(1);
+
       Data::iterator result = etl::move_s(data1.begin(), data1.end(), data2.begin(), data2.end());
 
       CHECK(data2.begin() == result);
@@ -3418,6 +3625,113 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(stable_sort_with_buffer)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 100U), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end());
+
+      // Large enough, too small and empty buffers.
+      const size_t buffer_sizes[] = {2500U, 300U, 1U, 0U};
+
+      for (size_t b = 0U; b < (sizeof(buffer_sizes) / sizeof(buffer_sizes[0])); ++b)
+      {
+        std::vector<NDC> data2(initial_data);
+        std::vector<NDC> buffer(buffer_sizes[b], NDC(0));
+
+        etl::stable_sort(data2.begin(), data2.end(), buffer.data(), buffer.data() + buffer.size());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer_greater)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 100U), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+
+      const size_t buffer_sizes[] = {2500U, 300U, 0U};
+
+      for (size_t b = 0U; b < (sizeof(buffer_sizes) / sizeof(buffer_sizes[0])); ++b)
+      {
+        std::vector<NDC> data2(initial_data);
+        std::vector<NDC> buffer(buffer_sizes[b], NDC(0));
+
+        etl::stable_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), std::greater<NDC>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer_sizes)
+    {
+      int buffer[100];
+
+      for (size_t size = 0U; size < 200U; ++size)
+      {
+        std::vector<int> data1(size);
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          data1[i] = int(urng() % 50U);
+        }
+
+        std::vector<int> data2 = data1;
+        std::vector<int> data3 = data1;
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::stable_sort(data2.begin(), data2.end(), std::begin(buffer), std::end(buffer));
+        etl::stable_sort(data3.begin(), data3.end(), std::begin(buffer), std::begin(buffer));
+
+        CHECK(std::equal(data1.begin(), data1.end(), data2.begin()));
+        CHECK(std::equal(data1.begin(), data1.end(), data3.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer_move_only)
+    {
+      std::vector<std::unique_ptr<int>> data;
+      std::unique_ptr<int>              buffer[250];
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int(int(urng() % 500U))));
+      }
+
+      struct compare
+      {
+        bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+        {
+          return *lhs < *rhs;
+        }
+      };
+
+      etl::stable_sort(data.begin(), data.end(), std::begin(buffer), std::end(buffer), compare());
+
+      bool is_sorted = std::is_sorted(data.begin(), data.end(), compare());
+      CHECK(is_sorted);
+      CHECK_EQUAL(1000U, size_t(std::count_if(data.begin(), data.end(), [](const std::unique_ptr<int>& p) { return p != nullptr; })));
+    }
+
     //*************************************************************************
     TEST(next_permutation)
     {
@@ -3800,6 +4114,369 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(pdq_sort_default)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::pdq_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_small_sizes)
+    {
+      for (size_t size = 0U; size < 200U; ++size)
+      {
+        std::vector<int> data1(size);
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          data1[i] = int(urng() % 50U);
+        }
+
+        std::vector<int> data2 = data1;
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_patterns)
+    {
+      const int        Size = 50000;
+      std::vector<int> random(Size);
+      std::vector<int> sorted(Size);
+      std::vector<int> reversed(Size);
+      std::vector<int> few_unique(Size);
+      std::vector<int> organ_pipe(Size);
+      std::vector<int> all_equal(Size, 42);
+      std::vector<int> sawtooth(Size);
+
+      for (int i = 0; i < Size; ++i)
+      {
+        random[size_t(i)]     = int(urng());
+        sorted[size_t(i)]     = i;
+        reversed[size_t(i)]   = Size - i;
+        few_unique[size_t(i)] = int(urng() % 4U);
+        organ_pipe[size_t(i)] = (i < (Size / 2)) ? i : Size - i;
+        sawtooth[size_t(i)]   = i % 1000;
+      }
+
+      std::vector<int>* patterns[] = {&random, &sorted, &reversed, &few_unique, &organ_pipe, &all_equal, &sawtooth};
+
+      for (size_t p = 0U; p < (sizeof(patterns) / sizeof(patterns[0])); ++p)
+      {
+        std::vector<int> data1 = *patterns[p];
+        std::vector<int> data2 = *patterns[p];
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_killer_pattern)
+    {
+      // An adversarial input for median of three pivot selection.
+      const size_t     Size = 10000U;
+      std::vector<int> data(Size);
+
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        data[i]               = int((2U * i) + 1U);
+        data[i + (Size / 2U)]   = int(2U * (i + 1U));
+      }
+
+      std::vector<int> data1 = data;
+      std::vector<int> data2 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::pdq_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_non_arithmetic)
+    {
+      std::vector<NDC> data1;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        data1.push_back(NDC(int(urng() % 100U), i));
+      }
+
+      std::vector<NDC> data2 = data1;
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::pdq_sort(data2.begin(), data2.end());
+
+      // Not stable, so only the keys are compared.
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+
+      std::sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::pdq_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_move_only)
+    {
+      std::vector<std::unique_ptr<int>> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int(int(urng() % 500U))));
+      }
+
+      struct compare
+      {
+        bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+        {
+          return *lhs < *rhs;
+        }
+      };
+
+      etl::pdq_sort(data.begin(), data.end(), compare());
+
+      bool is_sorted = std::is_sorted(data.begin(), data.end(), compare());
+      CHECK(is_sorted);
+      CHECK_EQUAL(1000U, size_t(std::count_if(data.begin(), data.end(), [](const std::unique_ptr<int>& p) { return p != nullptr; })));
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_pointers)
+    {
+      int               values[500];
+      std::vector<int*> data1;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data1.push_back(&values[urng() % 500U]);
+      }
+
+      std::vector<int*> data2 = data1;
+
+      std::sort(data1.begin(), data1.end());
+      etl::pdq_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      std::vector<uint32_t> data1(10000);
+      std::vector<uint32_t> buffer(data1.size());
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        data1[i] = uint32_t(urng());
+      }
+
+      std::vector<uint32_t> data2 = data1;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned_64)
+    {
+      std::vector<uint64_t> data1(10000);
+      std::vector<uint64_t> buffer(data1.size());
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        // Only some of the bytes vary, so some of the passes are skipped.
+        data1[i] = (uint64_t(urng() % 7U) << 40) | (uint64_t(urng()) & 0xFFFFU);
+      }
+
+      std::vector<uint64_t> data2 = data1;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      std::vector<int32_t> data1(10000);
+      std::vector<int8_t>  small1(1000);
+      std::vector<int64_t> large1(1000);
+      std::vector<int64_t> buffer(data1.size());
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        data1[i] = int32_t(urng());
+      }
+
+      for (size_t i = 0U; i < small1.size(); ++i)
+      {
+        small1[i] = int8_t(urng());
+        large1[i] = int64_t(urng()) - int64_t(urng()) * 1000000;
+      }
+
+      data1[0] = std::numeric_limits<int32_t>::min();
+      data1[1] = std::numeric_limits<int32_t>::max();
+
+      std::vector<int32_t> data2  = data1;
+      std::vector<int8_t>  small2 = small1;
+      std::vector<int64_t> large2 = large1;
+      std::vector<int32_t> buffer32(data1.size());
+      std::vector<int8_t>  buffer8(small1.size());
+
+      std::sort(data1.begin(), data1.end());
+      std::sort(small1.begin(), small1.end());
+      std::sort(large1.begin(), large1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer32.begin(), buffer32.end());
+      etl::radix_sort(small2.begin(), small2.end(), buffer8.begin(), buffer8.end());
+      etl::radix_sort(large2.begin(), large2.end(), buffer.begin(), buffer.end());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin()));
+      CHECK(std::equal(small1.begin(), small1.end(), small2.begin()));
+      CHECK(std::equal(large1.begin(), large1.end(), large2.begin()));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_floating_point)
+    {
+      std::vector<float>  float1(5000);
+      std::vector<double> double1(5000);
+      std::vector<float>  float_buffer(float1.size());
+      std::vector<double> double_buffer(double1.size());
+
+      for (size_t i = 0U; i < float1.size(); ++i)
+      {
+        float1[i]  = (float(urng()) / 1000.0f) - 2000000.0f;
+        double1[i] = (double(urng()) * 1.0e-3) - 2.0e6;
+      }
+
+      float1[0]  = std::numeric_limits<float>::infinity();
+      float1[1]  = -std::numeric_limits<float>::infinity();
+      float1[2]  = 0.0f;
+      double1[0] = std::numeric_limits<double>::lowest();
+      double1[1] = std::numeric_limits<double>::denorm_min();
+      double1[2] = -std::numeric_limits<double>::denorm_min();
+
+      std::vector<float>  float2  = float1;
+      std::vector<double> double2 = double1;
+
+      std::sort(float1.begin(), float1.end());
+      std::sort(double1.begin(), double1.end());
+      etl::radix_sort(float2.begin(), float2.end(), float_buffer.begin(), float_buffer.end());
+      etl::radix_sort(double2.begin(), double2.end(), double_buffer.begin(), double_buffer.end());
+
+      CHECK(std::equal(float1.begin(), float1.end(), float2.begin()));
+      CHECK(std::equal(double1.begin(), double1.end(), double2.begin()));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_key_is_stable)
+    {
+      struct get_key
+      {
+        int operator()(const NDC& value) const
+        {
+          return value.value;
+        }
+      };
+
+      std::vector<NDC> data1;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        data1.push_back(NDC(int(urng() % 300U) - 150, i));
+      }
+
+      std::vector<NDC> data2 = data1;
+      std::vector<NDC> buffer(data1.size(), NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), get_key());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_all_equal_and_small)
+    {
+      uint16_t data[100];
+      uint16_t buffer[100];
+
+      std::fill(std::begin(data), std::end(data), uint16_t(0x1234U));
+      etl::radix_sort(std::begin(data), std::end(data), std::begin(buffer), std::end(buffer));
+      CHECK(std::count(std::begin(data), std::end(data), uint16_t(0x1234U)) == 100);
+
+      data[0] = 5U;
+      etl::radix_sort(std::begin(data), std::begin(data) + 1, std::begin(buffer), std::end(buffer));
+      CHECK_EQUAL(5U, data[0]);
+
+      etl::radix_sort(std::begin(data), std::begin(data), std::begin(buffer), std::begin(buffer));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_buffer_too_small)
+    {
+      uint32_t data[10] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+      uint32_t buffer[9];
+
+      CHECK_THROW(etl::radix_sort(std::begin(data), std::end(data), std::begin(buffer), std::end(buffer)), etl::algorithm_error);
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
@@ -4368,6 +5045,120 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(nth_element_large_ranges)
+    {
+      const size_t Size = 5000U;
+
+      std::vector<std::vector<int>> inputs(6U, std::vector<int>(Size));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        inputs[0][i] = int((i * 7919U) % Size);                  // Random order
+        inputs[1][i] = int(i);                                   // Sorted
+        inputs[2][i] = int(Size - i);                            // Reversed
+        inputs[3][i] = 42;                                       // All equal
+        inputs[4][i] = int((i < (Size / 2)) ? i : (Size - i));   // Organ pipe
+        inputs[5][i] = int((i * 7919U) % 3U);                    // Few unique
+      }
+
+      const int nths[] = {0, 1, int(Size / 3U), int(Size / 2U), int(Size - 2U), int(Size - 1U)};
+
+      for (const std::vector<int>& input : inputs)
+      {
+        std::vector<int> sorted(input);
+        std::sort(sorted.begin(), sorted.end());
+
+        for (int nth : nths)
+        {
+          std::vector<int> data(input);
+
+          etl::nth_element(data.begin(), data.begin() + nth, data.end());
+
+          const int nth_value = data[size_t(nth)];
+
+          CHECK_EQUAL(sorted[size_t(nth)], nth_value);
+          CHECK(std::all_of(data.begin(), data.begin() + nth, [&](int value) { return !(nth_value < value); }));
+          CHECK(std::all_of(data.begin() + nth, data.end(), [&](int value) { return !(value < nth_value); }));
+
+          std::sort(data.begin(), data.end());
+          CHECK(sorted == data);
+        }
+      }
+    }
+
+    //*************************************************************************
+    // McIlroy's adversary for quicksort. The values are decided as they are
+    // compared, so as to make every pivot as bad as possible. Introselect
+    // must fall back to median of medians and stay linear.
+    //*************************************************************************
+    struct QuickselectAdversary
+    {
+      QuickselectAdversary(std::vector<size_t>& values_, size_t& n_solid_, size_t& candidate_, size_t& comparisons_)
+        : values(values_)
+        , gas(values_.size())
+        , n_solid(n_solid_)
+        , candidate(candidate_)
+        , comparisons(comparisons_)
+      {
+      }
+
+      bool operator()(size_t x, size_t y) const
+      {
+        ++comparisons;
+
+        if ((values[x] == gas) && (values[y] == gas))
+        {
+          values[(x == candidate) ? x : y] = n_solid++;
+        }
+
+        if (values[x] == gas)
+        {
+          candidate = x;
+        }
+        else if (values[y] == gas)
+        {
+          candidate = y;
+        }
+
+        return values[x] < values[y];
+      }
+
+      std::vector<size_t>& values;
+      size_t               gas;
+      size_t&              n_solid;
+      size_t&              candidate;
+      size_t&              comparisons;
+    };
+
+    TEST(nth_element_is_linear_for_adversarial_input)
+    {
+      const size_t Size = 20000U;
+
+      std::vector<size_t> values(Size, Size);
+      std::vector<size_t> items(Size);
+      size_t              n_solid     = 0U;
+      size_t              candidate   = 0U;
+      size_t              comparisons = 0U;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        items[i] = i;
+      }
+
+      QuickselectAdversary adversary(values, n_solid, candidate, comparisons);
+
+      const ptrdiff_t Nth = ptrdiff_t(Size / 2U);
+
+      etl::nth_element(items.begin(), items.begin() + Nth, items.end(), adversary);
+
+      CHECK(comparisons < (50U * Size));
+
+      const size_t nth_value = values[items[Size / 2U]];
+      CHECK(std::all_of(items.begin(), items.begin() + Nth, [&](size_t item) { return values[item] <= nth_value; }));
+      CHECK(std::all_of(items.begin() + Nth, items.end(), [&](size_t item) { return values[item] >= nth_value; }));
+    }
+
     //*************************************************************************
     TEST(accumulate_default)
     {
@@ -4923,6 +5714,169 @@ namespace
       CHECK_ARRAY_EQUAL(expected, data, 12);
     }
 
+    //*************************************************************************
+    TEST(inplace_merge_random_stable_matches_std)
+    {
+      uint32_t seed = 12345U;
+
+      for (ptrdiff_t length = 0; length < 200; length += 7)
+      {
+        for (ptrdiff_t split = 0; split <= length; split += 3)
+        {
+          std::vector<Data> data;
+
+          for (ptrdiff_t i = 0; i < length; ++i)
+          {
+            seed = (seed * 1103515245U) + 12345U;
+            data.push_back(Data(int((seed >> 16) % 20U), int(i)));
+          }
+
+          std::stable_sort(data.begin(), data.begin() + split, DataPredicate());
+          std::stable_sort(data.begin() + split, data.end(), DataPredicate());
+
+          std::vector<Data> expected(data);
+
+          std::inplace_merge(expected.begin(), expected.begin() + split, expected.end(), DataPredicate());
+          etl::inplace_merge(data.begin(), data.begin() + split, data.end(), DataPredicate());
+
+          CHECK(data == expected);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_operations_match_std)
+    {
+      // Balanced and skewed sizes, with duplicates. The values are compared by
+      // 'a' only, so 'b' shows which range each output element came from.
+      uint32_t seed = 1U;
+
+      for (size_t test = 0U; test < 400U; ++test)
+      {
+        const size_t size1 = test % 40U;
+        const size_t size2 = ((test % 3U) == 0U) ? (test * 5U) : (test % 37U);
+
+        std::vector<Data> data1;
+        std::vector<Data> data2;
+
+        for (size_t i = 0U; i < size1; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          data1.push_back(Data(int((seed >> 16) % 100U), 1));
+        }
+
+        for (size_t i = 0U; i < size2; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          data2.push_back(Data(int((seed >> 16) % 100U), 2));
+        }
+
+        std::stable_sort(data1.begin(), data1.end(), DataPredicate());
+        std::stable_sort(data2.begin(), data2.end(), DataPredicate());
+
+        for (size_t swap = 0U; swap < 2U; ++swap)
+        {
+          std::vector<Data> expected;
+          std::vector<Data> result;
+
+          std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected), DataPredicate());
+          etl::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result), DataPredicate());
+          CHECK(expected == result);
+
+          expected.clear();
+          result.clear();
+          std::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected), DataPredicate());
+          etl::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result), DataPredicate());
+          CHECK(expected == result);
+
+          expected.clear();
+          result.clear();
+          std::set_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected), DataPredicate());
+          etl::set_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result), DataPredicate());
+          CHECK(expected == result);
+
+          data1.swap(data2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_operations_non_random_iterators)
+    {
+      std::list<int> list1 = {1, 2, 2, 4, 6, 8, 9};
+      std::list<int> list2 = {2, 3, 4, 4, 9, 10};
+
+      std::vector<int> expected;
+      std::vector<int> result;
+
+      std::set_intersection(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(expected));
+      etl::set_intersection(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_union(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(expected));
+      etl::set_union(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_difference(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(expected));
+      etl::set_difference(list1.begin(), list1.end(), list2.begin(), list2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_sorted_unique)
+    {
+      std::mt19937 generator(7);
+
+      for (size_t test = 0U; test < 300U; ++test)
+      {
+        std::vector<uint32_t> data1;
+        std::vector<int32_t>  data2;
+
+        for (size_t i = 0U; i < (test % 50U); ++i)
+        {
+          data1.push_back(generator() % 200U);
+        }
+
+        for (size_t i = 0U; i < (test % 7U) * 20U; ++i)
+        {
+          data2.push_back(int32_t(generator() % 200U) - 100);
+        }
+
+        std::sort(data1.begin(), data1.end());
+        data1.erase(std::unique(data1.begin(), data1.end()), data1.end());
+        std::sort(data2.begin(), data2.end());
+        data2.erase(std::unique(data2.begin(), data2.end()), data2.end());
+
+        std::vector<uint32_t> expected1;
+        std::vector<uint32_t> result1;
+
+        std::set_intersection(data1.begin(), data1.end(), data1.begin() + ptrdiff_t(data1.size() / 2U), data1.end(), std::back_inserter(expected1));
+        etl::set_intersection(etl::sorted_unique_t(), data1.data(), data1.data() + data1.size(), data1.data() + (data1.size() / 2U), data1.data() + data1.size(),
+                              std::back_inserter(result1));
+        CHECK(expected1 == result1);
+
+        std::vector<int32_t> negated(data2);
+        std::vector<int32_t> expected2;
+        std::vector<int32_t> result2;
+
+        for (size_t i = 0U; i < negated.size(); ++i)
+        {
+          negated[i] = (negated[i] * 3) / 2;
+        }
+
+        negated.erase(std::unique(negated.begin(), negated.end()), negated.end());
+
+        std::set_intersection(data2.begin(), data2.end(), negated.begin(), negated.end(), std::back_inserter(expected2));
+        etl::set_intersection(etl::sorted_unique_t(), data2.data(), data2.data() + data2.size(), negated.data(), negated.data() + negated.size(),
+                              std::back_inserter(result2));
+        CHECK(expected2 == result2);
+      }
+    }
+
 #if ETL_USING_CPP17
 
     //*************************************************************************
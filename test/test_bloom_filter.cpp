@@ -71,6 +71,16 @@ struct hash3_t
   }
 };
 
+struct identity_hash_t
+{
+  typedef uint32_t argument_type;
+
+  size_t operator()(argument_type value) const
+  {
+    return value;
+  }
+};
+
 std::vector<const char*> exist_text     = {"The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain"};
 std::vector<const char*> not_exist_text = {"My", "hovercraft", "is", "full", "of", "eels"};
 
@@ -261,5 +271,257 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<1024, hash1_t> bloom;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      size_t count = bloom.count();
+      CHECK(count > 0);
+      CHECK(count <= (8U * exist_text.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, hash1_t> Bloom1;
+      typedef etl::blocked_bloom_filter<512, hash1_t>  Bloom2;
+
+      Bloom1 bloom1;
+      Bloom2 bloom2;
+
+      // Rounded up to whole 512 bit blocks.
+      CHECK_EQUAL(1024U, bloom1.width());
+      CHECK_EQUAL(1024U, Bloom1::WIDTH);
+      CHECK_EQUAL(512U, bloom2.width());
+      CHECK_EQUAL(512U, Bloom2::WIDTH);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_hash_count)
+    {
+      etl::blocked_bloom_filter<512, identity_hash_t, 1> bloom1;
+      etl::blocked_bloom_filter<512, identity_hash_t, 4> bloom4;
+
+      bloom1.add(1U);
+      bloom4.add(1U);
+
+      CHECK_EQUAL(1U, bloom1.count());
+      CHECK(bloom4.count() > 1U);
+      CHECK(bloom4.count() <= 4U);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_runtime_hash_count)
+    {
+      typedef etl::blocked_bloom_filter<8192, identity_hash_t, 16> Bloom16;
+      typedef etl::blocked_bloom_filter<8192, identity_hash_t, 4>  Bloom4;
+
+      Bloom16 bloom_default;
+      Bloom16 bloom_runtime(4U);
+      Bloom4  bloom_fixed;
+
+      CHECK_EQUAL(16U, Bloom16::MAX_HASH_COUNT);
+      CHECK_EQUAL(16U, bloom_default.hash_count());
+      CHECK_EQUAL(4U, bloom_runtime.hash_count());
+      CHECK_EQUAL(4U, bloom_fixed.hash_count());
+
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0U; i < 500U; ++i)
+      {
+        keys.push_back(i * 7U);
+      }
+
+      bloom_runtime.add_batch(etl::span<const uint32_t>(keys.data(), keys.size()));
+      bloom_fixed.add_batch(etl::span<const uint32_t>(keys.data(), keys.size()));
+
+      // The same k at run time sets the same bits as at compile time.
+      CHECK_EQUAL(bloom_fixed.count(), bloom_runtime.count());
+
+      std::vector<uint32_t> tests;
+
+      for (uint32_t i = 0U; i < 3500U; ++i)
+      {
+        tests.push_back(i);
+      }
+
+      bool results_runtime[3500];
+      bool results_fixed[3500];
+
+      bloom_runtime.exists_batch(etl::span<const uint32_t>(tests.data(), tests.size()), etl::span<bool>(results_runtime));
+      bloom_fixed.exists_batch(etl::span<const uint32_t>(tests.data(), tests.size()), etl::span<bool>(results_fixed));
+
+      bool all_match = true;
+
+      for (size_t i = 0UL; i < tests.size(); ++i)
+      {
+        all_match = all_match && (results_runtime[i] == results_fixed[i]);
+        all_match = all_match && (results_runtime[i] == bloom_runtime.exists(tests[i]));
+      }
+
+      CHECK(all_match);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_hash_count_out_of_range)
+    {
+      typedef etl::blocked_bloom_filter<512, identity_hash_t, 4> Bloom;
+
+      CHECK_THROW(Bloom bloom(0U), etl::bloom_filter_out_of_range);
+      CHECK_THROW(Bloom bloom(5U), etl::bloom_filter_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_usage_and_clear)
+    {
+      etl::blocked_bloom_filter<512, hash1_t> bloom;
+
+      CHECK_EQUAL(0U, bloom.usage());
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      CHECK(bloom.usage() > 0U);
+      CHECK(bloom.usage() < 100U);
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_batch)
+    {
+      etl::blocked_bloom_filter<8192, identity_hash_t> bloom_batch;
+      etl::blocked_bloom_filter<8192, identity_hash_t> bloom_single;
+
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0U; i < 500U; ++i)
+      {
+        keys.push_back(i * 7U);
+      }
+
+      bloom_batch.add_batch(etl::span<const uint32_t>(keys.data(), keys.size()));
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        bloom_single.add(keys[i]);
+      }
+
+      CHECK_EQUAL(bloom_single.count(), bloom_batch.count());
+
+      std::vector<uint32_t> tests;
+
+      for (uint32_t i = 0U; i < 3500U; ++i)
+      {
+        tests.push_back(i);
+      }
+
+      bool results[3500];
+
+      bloom_batch.exists_batch(etl::span<const uint32_t>(tests.data(), tests.size()), etl::span<bool>(results));
+
+      bool all_match = true;
+
+      for (size_t i = 0UL; i < tests.size(); ++i)
+      {
+        all_match = all_match && (results[i] == bloom_single.exists(tests[i]));
+
+        // No false negatives.
+        if ((tests[i] % 7U) == 0U)
+        {
+          all_match = all_match && results[i];
+        }
+      }
+
+      CHECK(all_match);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_batch_results_too_small)
+    {
+      etl::blocked_bloom_filter<512, identity_hash_t> bloom;
+
+      uint32_t keys[4] = {1, 2, 3, 4};
+      bool     found[3];
+
+      CHECK_THROW(bloom.exists_batch(etl::span<const uint32_t>(keys), etl::span<bool>(found)), etl::bloom_filter_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_false_positive_rate)
+    {
+      // 10 bits per key, with 8 hashes.
+      // The theoretical rate is 0.85% for a standard Bloom filter, and 1.0%
+      // for one with 512 bit blocks.
+      etl::blocked_bloom_filter<65536, identity_hash_t, 8> bloom8;
+
+      for (uint32_t i = 0U; i < 6554U; ++i)
+      {
+        bloom8.add(i * 2U);
+      }
+
+      // 8 bits per key, with 4 hashes.
+      // The theoretical rate is 2.4% for a standard Bloom filter, and 2.5%
+      // for one with 512 bit blocks.
+      etl::blocked_bloom_filter<65536, identity_hash_t, 4> bloom4;
+
+      for (uint32_t i = 0U; i < 8192U; ++i)
+      {
+        bloom4.add(i * 2U);
+      }
+
+      size_t false_positives8 = 0U;
+      size_t false_positives4 = 0U;
+
+      for (uint32_t i = 0U; i < 100000U; ++i)
+      {
+        false_positives8 += bloom8.exists((i * 2U) + 1U) ? 1U : 0U;
+        false_positives4 += bloom4.exists((i * 2U) + 1U) ? 1U : 0U;
+      }
+
+      CHECK(false_positives8 < 1200U);
+      CHECK(false_positives4 < 2800U);
+    }
   }
 } // namespace
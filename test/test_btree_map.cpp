@@ -0,0 +1,594 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "etl/btree_map.h"
+
+#include "data.h"
+
+namespace
+{
+  using Data         = etl::btree_map<int, int, 1000>;
+  using IData        = etl::ibtree_map<int, int>;
+  using Compare_Data = std::map<int, int>;
+
+  using ItemM = TestDataM<int>;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(const T1& data, const T2& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    typename T2::const_iterator itr = compare.begin();
+
+    for (typename T1::const_iterator i = data.begin(); i != data.end(); ++i, ++itr)
+    {
+      if ((i->first != itr->first) || (i->second != itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  // A simple generator, so that the tests are repeatable.
+  struct Random
+  {
+    explicit Random(uint32_t seed_)
+      : seed(seed_)
+    {
+    }
+
+    int operator()(int range)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      return int((seed >> 8) % uint32_t(range));
+    }
+
+    uint32_t seed;
+  };
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(1000U, data.max_size());
+      CHECK_EQUAL(1000U, data.capacity());
+      CHECK_EQUAL(1000U, data.available());
+      CHECK_EQUAL(0U, data.height());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      Data data;
+
+      CHECK(data.insert(std::make_pair(2, 20)).second);
+      CHECK(data.insert(std::make_pair(1, 10)).second);
+      CHECK(data.insert(std::make_pair(3, 30)).second);
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(std::make_pair(2, 21));
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->first);
+      CHECK_EQUAL(20, result.first->second);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.find(1)->second);
+      CHECK_EQUAL(30, data.find(3)->second);
+      CHECK(data.find(4) == data.end());
+
+      CHECK(data.contains(1));
+      CHECK(!data.contains(4));
+      CHECK_EQUAL(1U, data.count(2));
+      CHECK_EQUAL(0U, data.count(4));
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator_and_at)
+    {
+      Data data;
+
+      data[1] = 10;
+      data[2] = 20;
+      data[1] = 11;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(11, data.at(1));
+      CHECK_EQUAL(20, data.at(2));
+
+      const Data& cdata = data;
+      CHECK_EQUAL(20, cdata.at(2));
+
+      CHECK_THROW(data.at(3), etl::btree_out_of_bounds);
+      CHECK_THROW(cdata.at(3), etl::btree_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      etl::btree_map<int, int, 50> data;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+
+      // An existing key is not an insertion.
+      CHECK(!data.insert(std::make_pair(10, 0)).second);
+      data[10] = 100;
+      CHECK_EQUAL(100, data.at(10));
+
+      CHECK_THROW(data.insert(std::make_pair(50, 50)), etl::btree_full);
+      CHECK_THROW(data[50], etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_ascending_and_descending_fill)
+    {
+      // Sorted insertions leave the most half full leaves, so use the most nodes.
+      Data ascending;
+      Data descending;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        ascending.insert(std::make_pair(i, i));
+        descending.insert(std::make_pair(999 - i, i));
+      }
+
+      CHECK(ascending.full());
+      CHECK(descending.full());
+      CHECK(ascending.height() > 2U);
+
+      int expected = 0;
+
+      for (Data::const_iterator itr = ascending.begin(); itr != ascending.end(); ++itr)
+      {
+        CHECK_EQUAL(expected++, itr->first);
+      }
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        CHECK_EQUAL(1U, ascending.erase(i));
+        CHECK_EQUAL(1U, descending.erase(i));
+      }
+
+      CHECK(ascending.empty());
+      CHECK(descending.empty());
+      CHECK_EQUAL(0U, ascending.height());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(std::make_pair(i, i * 10));
+      }
+
+      CHECK_EQUAL(1U, data.erase(50));
+      CHECK_EQUAL(0U, data.erase(50));
+      CHECK_EQUAL(99U, data.size());
+      CHECK(data.find(50) == data.end());
+      CHECK_EQUAL(510, data.find(51)->second);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      // Erasing every element from the front returns the next element each time.
+      Data::iterator itr = data.begin();
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(i, itr->first);
+        itr = data.erase(itr);
+      }
+
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data         data;
+      Compare_Data compare;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+        compare.insert(std::make_pair(i, i));
+      }
+
+      Data::iterator itr = data.erase(data.find(20), data.find(150));
+      compare.erase(compare.find(20), compare.find(150));
+
+      CHECK_EQUAL(150, itr->first);
+      CHECK(Check_Equal(data, compare));
+
+      itr = data.erase(data.begin(), data.end());
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_lower_upper_bound_equal_range)
+    {
+      Data         data;
+      Compare_Data compare;
+
+      for (int i = 0; i < 500; i += 2)
+      {
+        data.insert(std::make_pair(i, i));
+        compare.insert(std::make_pair(i, i));
+      }
+
+      const Data& cdata = data;
+
+      for (int i = -1; i < 502; ++i)
+      {
+        Data::iterator         lower = data.lower_bound(i);
+        Data::const_iterator   upper = cdata.upper_bound(i);
+        Compare_Data::iterator clower = compare.lower_bound(i);
+        Compare_Data::iterator cupper = compare.upper_bound(i);
+
+        CHECK_EQUAL(clower == compare.end(), lower == data.end());
+        CHECK_EQUAL(cupper == compare.end(), upper == cdata.end());
+
+        if (clower != compare.end())
+        {
+          CHECK_EQUAL(clower->first, lower->first);
+        }
+
+        if (cupper != compare.end())
+        {
+          CHECK_EQUAL(cupper->first, upper->first);
+        }
+
+        ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(i);
+        CHECK(range.first == lower);
+        CHECK_EQUAL(size_t(std::distance(compare.equal_range(i).first, compare.equal_range(i).second)), size_t(std::distance(range.first, range.second)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data         data;
+      Compare_Data compare;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.insert(std::make_pair((i * 37) % 300, i));
+        compare.insert(std::make_pair((i * 37) % 300, i));
+      }
+
+      CHECK(Check_Equal(data, compare));
+
+      // Reverse.
+      Compare_Data::reverse_iterator citr = compare.rbegin();
+
+      for (Data::reverse_iterator itr = data.rbegin(); itr != data.rend(); ++itr, ++citr)
+      {
+        CHECK_EQUAL(citr->first, itr->first);
+      }
+
+      // Decrement from the end.
+      Data::const_iterator itr = data.cend();
+      --itr;
+      CHECK_EQUAL(299, itr->first);
+
+      // Post increment and decrement.
+      Data::iterator first = data.begin();
+      Data::iterator temp  = first++;
+      CHECK_EQUAL(0, temp->first);
+      CHECK_EQUAL(1, first->first);
+      temp = first--;
+      CHECK_EQUAL(1, temp->first);
+      CHECK_EQUAL(0, first->first);
+
+      // Modify through the iterator.
+      data.begin()->second = 1234;
+      CHECK_EQUAL(1234, data.at(0));
+    }
+
+    //*************************************************************************
+    TEST(test_against_reference)
+    {
+      Data         data;
+      Compare_Data compare;
+      Random       random(12345U);
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        const int key = random(1500);
+
+        switch (random(4))
+        {
+          case 0:
+          case 1:
+          {
+            if ((compare.size() < data.max_size()) || (compare.count(key) != 0U))
+            {
+              CHECK_EQUAL(compare.insert(std::make_pair(key, i)).second, data.insert(std::make_pair(key, i)).second);
+            }
+            break;
+          }
+
+          case 2:
+          {
+            CHECK_EQUAL(compare.erase(key), data.erase(key));
+            break;
+          }
+
+          default:
+          {
+            Data::iterator         itr  = data.find(key);
+            Compare_Data::iterator citr = compare.find(key);
+
+            CHECK_EQUAL(citr == compare.end(), itr == data.end());
+
+            if (citr != compare.end())
+            {
+              CHECK_EQUAL(citr->second, itr->second);
+            }
+            break;
+          }
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other;
+      other.insert(std::make_pair(1000, 1000));
+      other = data;
+      CHECK(other == data);
+
+      IData& idata = other;
+      idata        = copy;
+      CHECK(idata == copy);
+    }
+
+    //*************************************************************************
+    TEST(test_range_and_initializer_list_constructors)
+    {
+      Compare_Data compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        compare.insert(std::make_pair(i, -i));
+      }
+
+      Data data(compare.begin(), compare.end());
+      CHECK(Check_Equal(data, compare));
+
+      etl::btree_map<int, int, 10> list = {std::make_pair(3, 30), std::make_pair(1, 10), std::make_pair(2, 20)};
+      CHECK_EQUAL(3U, list.size());
+      CHECK_EQUAL(10, list.begin()->second);
+
+      auto made = etl::make_btree_map<int, int>(std::make_pair(2, 20), std::make_pair(1, 10));
+      CHECK_EQUAL(2U, made.max_size());
+      CHECK_EQUAL(10, made.at(1));
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      using DataM = etl::btree_map<int, ItemM, 100>;
+
+      {
+        DataM data;
+
+        for (int i = 0; i < 100; ++i)
+        {
+          data.insert(std::make_pair(i, ItemM(i)));
+        }
+
+        DataM moved(std::move(data));
+        CHECK_EQUAL(100U, moved.size());
+        CHECK_EQUAL(50, moved.at(50).value);
+        CHECK(moved.at(50).valid);
+
+        DataM assigned;
+        assigned = std::move(moved);
+        CHECK_EQUAL(100U, assigned.size());
+        CHECK(assigned.at(99).valid);
+
+        for (int i = 0; i < 100; i += 3)
+        {
+          assigned.erase(i);
+        }
+
+        CHECK(assigned.at(1).valid);
+        CHECK_EQUAL(1, assigned.at(1).value);
+      }
+
+      // Everything constructed has been destroyed.
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::btree_map<std::string, std::string, 200, std::greater<std::string>> data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data[std::to_string(i)] = std::to_string(i * 2);
+      }
+
+      for (int i = 0; i < 200; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(std::to_string(i)));
+      }
+
+      CHECK_EQUAL(100U, data.size());
+      CHECK_EQUAL(std::string("102"), data.at("51"));
+
+      // Greater than ordering.
+      std::string previous = data.begin()->first;
+
+      for (auto itr = std::next(data.begin()); itr != data.end(); ++itr)
+      {
+        CHECK(itr->first < previous);
+        previous = itr->first;
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      etl::btree_map<std::string, int, 10, etl::less<>> data;
+
+      data["one"] = 1;
+      data["two"] = 2;
+
+      const char* key = "two";
+
+      CHECK_EQUAL(2, data.find(key)->second);
+      CHECK_EQUAL(2, data.at(key));
+      CHECK(data.contains(key));
+      CHECK_EQUAL(1U, data.count(key));
+      CHECK(data.lower_bound(key) == data.find(key));
+      CHECK_EQUAL(1U, data.erase(key));
+      CHECK(!data.contains("two"));
+    }
+
+    //*************************************************************************
+    TEST(test_comparisons)
+    {
+      Data data1 = {std::make_pair(1, 1), std::make_pair(2, 2)};
+      Data data2 = {std::make_pair(1, 1), std::make_pair(2, 2)};
+      Data data3 = {std::make_pair(1, 1), std::make_pair(3, 3)};
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+      CHECK(data1 < data3);
+      CHECK(data1 <= data2);
+      CHECK(data3 > data1);
+      CHECK(data3 >= data1);
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      using Map_Ext = etl::btree_map_ext<int, int>;
+      using Sizes   = Map_Ext::pool_size<100>;
+
+      etl::pool<Map_Ext::leaf_type, Sizes::Leaves>       leaf_pool;
+      etl::pool<Map_Ext::inner_type, Sizes::Inner_Nodes> inner_pool;
+
+      {
+        Map_Ext data(leaf_pool, inner_pool, 100U);
+
+        for (int i = 0; i < 100; ++i)
+        {
+          data.insert(std::make_pair(i, i));
+        }
+
+        CHECK(data.full());
+        CHECK_THROW(data.insert(std::make_pair(100, 100)), etl::btree_full);
+        CHECK_EQUAL(42, data.at(42));
+      }
+
+      // The destructor returns all of the nodes.
+      CHECK_EQUAL(0U, leaf_pool.size());
+      CHECK_EQUAL(0U, inner_pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      CHECK(data.full());
+    }
+  }
+} // namespace
@@ -0,0 +1,224 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "etl/btree_set.h"
+
+namespace
+{
+  using Data         = etl::btree_set<int, 1000>;
+  using IData        = etl::ibtree_set<int>;
+  using Compare_Data = std::set<int>;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(const T1& data, const T2& compare)
+  {
+    return (data.size() == compare.size()) && std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(1000U, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Data data;
+
+      CHECK(data.insert(2).second);
+      CHECK(data.insert(1).second);
+      CHECK(!data.insert(2).second);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, *data.find(1));
+      CHECK(data.find(3) == data.end());
+      CHECK(data.contains(2));
+
+      CHECK_EQUAL(1U, data.erase(1));
+      CHECK_EQUAL(0U, data.erase(1));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      etl::btree_set<int, 20> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK(data.full());
+      CHECK(!data.insert(5).second);
+      CHECK_THROW(data.insert(20), etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_against_reference)
+    {
+      Data         data;
+      Compare_Data compare;
+      uint32_t     seed = 98765U;
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        seed          = (seed * 1103515245U) + 12345U;
+        const int key = int((seed >> 8) % 1500U);
+
+        if (((seed >> 4) & 1U) == 0U)
+        {
+          if ((compare.size() < data.max_size()) || (compare.count(key) != 0U))
+          {
+            CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+      for (int key = -1; key <= 1500; ++key)
+      {
+        CHECK_EQUAL(compare.lower_bound(key) == compare.end(), data.lower_bound(key) == data.end());
+        CHECK_EQUAL(compare.upper_bound(key) == compare.end(), data.upper_bound(key) == data.end());
+
+        if (compare.lower_bound(key) != compare.end())
+        {
+          CHECK_EQUAL(*compare.lower_bound(key), *data.lower_bound(key));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_and_range)
+    {
+      Data data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.insert(i);
+      }
+
+      Data::iterator itr = data.erase(data.find(10));
+      CHECK_EQUAL(11, *itr);
+
+      itr = data.erase(data.find(20), data.find(180));
+      CHECK_EQUAL(180, *itr);
+      CHECK_EQUAL(39U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      Data data = {3, 1, 2};
+      Data copy(data);
+
+      CHECK(copy == data);
+
+      IData& icopy = copy;
+      icopy.insert(4);
+
+      CHECK(copy != data);
+      CHECK(data < copy);
+      CHECK(copy > data);
+
+      icopy = data;
+      CHECK(copy == data);
+
+      auto made = etl::make_btree_set<int>(5, 4, 6);
+      CHECK_EQUAL(3U, made.max_size());
+      CHECK_EQUAL(4, *made.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::btree_set<std::string, 300> data;
+      std::set<std::string>            compare;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.insert(std::to_string(i));
+        compare.insert(std::to_string(i));
+      }
+
+      for (int i = 0; i < 300; i += 3)
+      {
+        data.erase(std::to_string(i));
+        compare.erase(std::to_string(i));
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      using Set_Ext = etl::btree_set_ext<int>;
+      using Sizes   = Set_Ext::pool_size<200>;
+
+      etl::pool<Set_Ext::leaf_type, Sizes::Leaves>       leaf_pool;
+      etl::pool<Set_Ext::inner_type, Sizes::Inner_Nodes> inner_pool;
+
+      {
+        Set_Ext data(leaf_pool, inner_pool, 200U);
+
+        for (int i = 200; i > 0; --i)
+        {
+          data.insert(i);
+        }
+
+        CHECK(data.full());
+        CHECK_EQUAL(1, *data.begin());
+      }
+
+      CHECK_EQUAL(0U, leaf_pool.size());
+      CHECK_EQUAL(0U, inner_pool.size());
+    }
+  }
+} // namespace
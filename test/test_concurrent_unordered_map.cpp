@@ -0,0 +1,580 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "etl/concurrent_unordered_map.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //*************************************************************************
+  // A value that would be seen as torn if read while being written.
+  struct Pair
+  {
+    uint32_t a;
+    uint32_t b;
+  };
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct colliding_hash
+  {
+    size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  //*************************************************************************
+  // Lets the test hold an insert part way through, while its slot is Pending.
+  // The holding thread's second comparison, when it checks the probe run
+  // again for a concurrent insert, waits until it is released.
+  std::atomic<bool> is_held(false);
+  std::atomic<bool> is_released(false);
+
+  thread_local bool holds_insert = false;
+  thread_local int  comparisons  = 0;
+
+  struct holding_equal
+  {
+    bool operator()(int lhs, int rhs) const
+    {
+      if (holds_insert && (++comparisons == 2))
+      {
+        is_held = true;
+
+        while (!is_released)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      return lhs == rhs;
+    }
+  };
+
+  //*************************************************************************
+  // Counts the waits, and releases the held insert.
+  struct wait_function : public etl::ifunction<size_t>
+  {
+    wait_function()
+      : calls(0)
+    {
+    }
+
+    void operator()(size_t) const override
+    {
+      ++calls;
+      is_released = true;
+      std::this_thread::yield();
+    }
+
+    mutable std::atomic<int> calls;
+  };
+
+  SUITE(test_concurrent_unordered_map)
+  {
+    using Map    = etl::concurrent_unordered_map<int, int, 10>;
+    using IMap   = etl::iconcurrent_unordered_map<int, int>;
+    using MapExt = etl::concurrent_unordered_map_ext<int, int>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(10U, data.max_size());
+      CHECK_EQUAL(10U, data.capacity());
+      CHECK_EQUAL(10U, data.available());
+      CHECK_EQUAL(20U, data.bucket_count());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Map data;
+
+      CHECK(data.insert(1, 10));
+      CHECK(data.insert(2, 20));
+      CHECK(!data.insert(1, 11));
+
+      int value = 0;
+      CHECK(data.find(1, value));
+      CHECK_EQUAL(10, value);
+      CHECK(data.find(2, value));
+      CHECK_EQUAL(20, value);
+      CHECK(!data.find(3, value));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK(data.contains(1));
+      CHECK(!data.contains(3));
+      CHECK_EQUAL(1U, data.count(2));
+      CHECK_EQUAL(0U, data.count(3));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Map data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(data.insert(i, i));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK(!data.insert(10, 10));
+      CHECK(!data.insert_or_assign(10, 10));
+
+      // Existing keys may still be assigned.
+      CHECK(data.insert_or_assign(5, 50));
+
+      int value = 0;
+      CHECK(data.find(5, value));
+      CHECK_EQUAL(50, value);
+    }
+
+    //*************************************************************************
+    TEST(test_assign)
+    {
+      Map data;
+
+      CHECK(!data.assign(1, 10));
+      CHECK(data.insert(1, 10));
+      CHECK(data.assign(1, 11));
+
+      int value = 0;
+      CHECK(data.find(1, value));
+      CHECK_EQUAL(11, value);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign)
+    {
+      Map data;
+
+      CHECK(data.insert_or_assign(1, 10));
+      CHECK(data.insert_or_assign(1, 11));
+
+      int value = 0;
+      CHECK(data.find(1, value));
+      CHECK_EQUAL(11, value);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Map data;
+
+      data.insert(1, 10);
+      data.insert(2, 20);
+
+      CHECK(data.erase(1));
+      CHECK(!data.erase(1));
+      CHECK(!data.contains(1));
+      CHECK(data.contains(2));
+      CHECK_EQUAL(1U, data.size());
+
+      CHECK(data.insert(1, 12));
+
+      int value = 0;
+      CHECK(data.find(1, value));
+      CHECK_EQUAL(12, value);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_with_collisions)
+    {
+      etl::concurrent_unordered_map<int, int, 8, colliding_hash> data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(data.insert(i, i * 10));
+      }
+
+      // Erase from the middle of the probe run.
+      CHECK(data.erase(3));
+
+      for (int i = 0; i < 8; ++i)
+      {
+        int value = 0;
+        CHECK_EQUAL(i != 3, data.find(i, value));
+
+        if (i != 3)
+        {
+          CHECK_EQUAL(i * 10, value);
+        }
+      }
+
+      // Erase everything. The tombstones are reclaimed from the end of the run.
+      for (int i = 0; i < 8; ++i)
+      {
+        data.erase(i);
+      }
+
+      CHECK(data.empty());
+
+      // The slots can be used again many times.
+      for (int n = 0; n < 100; ++n)
+      {
+        for (int i = 0; i < 8; ++i)
+        {
+          CHECK(data.insert(i + n, i));
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+          CHECK(data.erase(i + n));
+        }
+      }
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Map data;
+
+      data.insert(1, 10);
+      data.insert(2, 20);
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(!data.contains(1));
+      CHECK(data.insert(1, 10));
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      Map   data;
+      IMap& idata = data;
+
+      CHECK(idata.insert(1, 10));
+
+      int value = 0;
+      CHECK(data.find(1, value));
+      CHECK_EQUAL(10, value);
+    }
+
+    //*************************************************************************
+    TEST(test_memory_model_small)
+    {
+      etl::concurrent_unordered_map<int, int, 100, etl::hash<int>, etl::equal_to<int>, etl::memory_model::MEMORY_MODEL_SMALL> data;
+
+      CHECK_EQUAL(1U, sizeof(data.size()));
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK(data.insert(i, i));
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_against_reference)
+    {
+      etl::concurrent_unordered_map<int, int, 50> data;
+      std::map<int, int>                          compare;
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed     = (seed * 1103515245U) + 12345U;
+        int key  = int((seed >> 16) % 100U);
+        bool add = ((seed >> 8) & 1U) == 0U;
+
+        if (add)
+        {
+          if (compare.size() < 50U || (compare.find(key) != compare.end()))
+          {
+            compare[key] = i;
+            CHECK(data.insert_or_assign(key, i));
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key) == 1U, data.erase(key));
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (int key = 0; key < 100; ++key)
+      {
+        int  value = 0;
+        bool found = data.find(key, value);
+
+        CHECK_EQUAL(compare.find(key) != compare.end(), found);
+
+        if (found)
+        {
+          CHECK_EQUAL(compare[key], value);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      MapExt::slot_type slots[20];
+
+      MapExt data(slots, 20U);
+      IMap&  idata = data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(10U, data.max_size());
+      CHECK_EQUAL(20U, data.bucket_count());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(idata.insert(i, i * 10));
+      }
+
+      CHECK(data.full());
+      CHECK(!idata.insert(10, 100));
+
+      int value = 0;
+      CHECK(data.find(5, value));
+      CHECK_EQUAL(50, value);
+
+      CHECK(idata.erase(5));
+      CHECK(!data.contains(5));
+      CHECK_EQUAL(9U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_function)
+    {
+      static etl::concurrent_unordered_map<int, int, 4, colliding_hash, holding_equal> data;
+
+      wait_function waiter;
+      data.set_wait_function(waiter);
+
+      data.insert(1, 1);
+
+      // The first insert of 2 is held with its slot Pending.
+      bool is_inserted_first = false;
+
+      std::thread first(
+        [&]()
+        {
+          holds_insert      = true;
+          is_inserted_first = data.insert(2, 2);
+        });
+
+      while (!is_held)
+      {
+        std::this_thread::yield();
+      }
+
+      // The second insert of 2 must wait for the first to finish.
+      const bool is_inserted_second = data.insert(2, 3);
+
+      first.join();
+
+      CHECK(is_inserted_first);
+      CHECK(!is_inserted_second);
+      CHECK(waiter.calls > 0);
+
+      int value = 0;
+      CHECK(data.find(2, value));
+      CHECK_EQUAL(2, value);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_access)
+    {
+      static const int Threads         = 4;
+      static const int Keys_Per_Thread = 64;
+      static const int Iterations      = 2000;
+
+      static etl::concurrent_unordered_map<int, Pair, Threads * Keys_Per_Thread> data;
+
+      std::atomic<bool> torn(false);
+      std::atomic<bool> failed(false);
+
+      // Each writer owns a range of keys, so knows exactly what must be present.
+      auto writer = [&](int id)
+      {
+        const int first = id * Keys_Per_Thread;
+
+        for (int n = 0; n < Iterations; ++n)
+        {
+          for (int k = first; k < first + Keys_Per_Thread; ++k)
+          {
+            Pair p = {uint32_t(n), ~uint32_t(n)};
+
+            if (!data.insert(k, p))
+            {
+              failed = true;
+            }
+          }
+
+          for (int k = first; k < first + Keys_Per_Thread; k += 2)
+          {
+            Pair p = {uint32_t(n + 1), ~uint32_t(n + 1)};
+
+            if (!data.assign(k, p))
+            {
+              failed = true;
+            }
+          }
+
+          for (int k = first; k < first + Keys_Per_Thread; ++k)
+          {
+            if (!data.erase(k))
+            {
+              failed = true;
+            }
+          }
+        }
+      };
+
+      // Readers check that a value is never seen half written.
+      std::atomic<bool> stop(false);
+
+      auto reader = [&]()
+      {
+        while (!stop)
+        {
+          for (int k = 0; k < Threads * Keys_Per_Thread; ++k)
+          {
+            Pair p;
+
+            if (data.find(k, p) && (p.a != ~p.b))
+            {
+              torn = true;
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> writers;
+
+      std::thread r1(reader);
+      std::thread r2(reader);
+
+      for (int i = 0; i < Threads; ++i)
+      {
+        writers.push_back(std::thread(writer, i));
+      }
+
+      for (size_t i = 0; i < writers.size(); ++i)
+      {
+        writers[i].join();
+      }
+
+      stop = true;
+      r1.join();
+      r2.join();
+
+      CHECK(!failed);
+      CHECK(!torn);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_same_keys)
+    {
+      static const int Threads    = 4;
+      static const int Keys       = 32;
+      static const int Iterations = 2000;
+
+      static etl::concurrent_unordered_map<int, int, Keys, colliding_hash> data;
+
+      std::atomic<int> inserted(0);
+      std::atomic<int> erased(0);
+
+      // All threads race to insert and erase the same keys, all of which collide.
+      auto worker = [&](int id)
+      {
+        for (int n = 0; n < Iterations; ++n)
+        {
+          for (int k = 0; k < Keys; ++k)
+          {
+            if (data.insert(k, id))
+            {
+              ++inserted;
+            }
+          }
+
+          for (int k = id; k < Keys; k += Threads)
+          {
+            if (data.erase(k))
+            {
+              ++erased;
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> workers;
+
+      for (int i = 0; i < Threads; ++i)
+      {
+        workers.push_back(std::thread(worker, i));
+      }
+
+      for (size_t i = 0; i < workers.size(); ++i)
+      {
+        workers[i].join();
+      }
+
+      CHECK_EQUAL(inserted - erased, int(data.size()));
+
+      // A duplicate would still be found after erasing each key once.
+      for (int k = 0; k < Keys; ++k)
+      {
+        data.erase(k);
+        CHECK(!data.contains(k));
+      }
+
+      CHECK(data.empty());
+    }
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,291 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the 'Software'), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "etl/platform.h"
+#if ETL_USING_CPP14
+
+  #include "unit_test_framework.h"
+
+  #include <map>
+
+  #include "etl/const_unordered_map.h"
+  #include "etl/string_view.h"
+
+namespace
+{
+  static const size_t Max_Size = 10UL;
+
+  using Data           = etl::const_unordered_map<int, char, Max_Size>;
+  using IData          = etl::iconst_unordered_map<int, char, etl::constexpr_hash<int>, etl::equal_to<int>>;
+  using value_type     = Data::value_type;
+  using const_iterator = Data::const_iterator;
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct colliding_hash
+  {
+    constexpr size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  //*************************************************************************
+  // A map of as many keys as indices, spread out over the integers.
+  template <typename TIndices>
+  struct LargeMap;
+
+  template <size_t... Indices>
+  struct LargeMap<etl::index_sequence<Indices...>>
+  {
+    using Map = etl::const_unordered_map<int, int, sizeof...(Indices)>;
+
+    static constexpr Map data{typename Map::value_type(int(Indices * 7919U), int(Indices))...};
+  };
+
+  template <size_t... Indices>
+  constexpr typename LargeMap<etl::index_sequence<Indices...>>::Map LargeMap<etl::index_sequence<Indices...>>::data;
+
+  SUITE(test_const_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      static constexpr Data data;
+
+      static constexpr bool           is_valid = data.is_valid();
+      static constexpr size_t         size     = data.size();
+      static constexpr bool           empty    = data.empty();
+      static constexpr bool           full     = data.full();
+      static constexpr size_t         capacity = data.capacity();
+      static constexpr size_t         max_size = data.max_size();
+      static constexpr const_iterator begin    = data.begin();
+      static constexpr const_iterator end      = data.end();
+      static constexpr bool           contains = data.contains(1);
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(size == 0UL);
+      CHECK_TRUE(empty);
+      CHECK_FALSE(full);
+      CHECK_TRUE(capacity == Max_Size);
+      CHECK_TRUE(max_size == Max_Size);
+      CHECK_TRUE(begin == end);
+      CHECK_FALSE(contains);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_min_size)
+    {
+      static constexpr Data data{value_type{5, 'A'}};
+
+      static constexpr bool   is_valid = data.is_valid();
+      static constexpr size_t size     = data.size();
+      static constexpr char   a        = data.at(5);
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(1U, size);
+      CHECK_EQUAL('A', a);
+      CHECK_FALSE(data.contains(4));
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_max_size)
+    {
+      static constexpr Data data{value_type{0, 'A'}, value_type{1, 'B'}, value_type{2, 'C'}, value_type{3, 'D'}, value_type{4, 'E'},
+                                 value_type{5, 'F'}, value_type{6, 'G'}, value_type{7, 'H'}, value_type{8, 'I'}, value_type{9, 'J'}};
+
+      static constexpr bool   is_valid = data.is_valid();
+      static constexpr size_t size     = data.size();
+      static constexpr bool   full     = data.full();
+      static constexpr char   a        = data[0];
+      static constexpr char   e        = data.at(4);
+      static constexpr char   j        = data.find(9)->second;
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(Max_Size, size);
+      CHECK_TRUE(full);
+      CHECK_EQUAL('A', a);
+      CHECK_EQUAL('E', e);
+      CHECK_EQUAL('J', j);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(char('A' + i), data[i]);
+        CHECK_EQUAL(1U, data.count(i));
+      }
+
+      CHECK(data.find(10) == data.end());
+      CHECK(data.find(-1) == data.end());
+      CHECK_EQUAL(0U, data.count(10));
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      static constexpr Data data{value_type{10, 'A'}, value_type{20, 'B'}, value_type{30, 'C'}, value_type{40, 'D'}, value_type{50, 'E'}};
+
+      std::map<int, char> compare;
+
+      for (const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        compare[itr->first] = itr->second;
+      }
+
+      CHECK_EQUAL(5U, compare.size());
+      CHECK_EQUAL('A', compare[10]);
+      CHECK_EQUAL('C', compare[30]);
+      CHECK_EQUAL('E', compare[50]);
+      CHECK_EQUAL(5, std::distance(data.cbegin(), data.cend()));
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      static constexpr Data data{value_type{1, 'A'}, value_type{2, 'B'}, value_type{3, 'C'}};
+
+      static constexpr ETL_OR_STD::pair<const_iterator, const_iterator> found     = data.equal_range(2);
+      static constexpr ETL_OR_STD::pair<const_iterator, const_iterator> not_found = data.equal_range(4);
+
+      CHECK_EQUAL(1, std::distance(found.first, found.second));
+      CHECK_EQUAL(2, found.first->first);
+      CHECK(not_found.first == data.end());
+      CHECK(not_found.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_keys_are_not_valid)
+    {
+      static constexpr Data data{value_type{1, 'A'}, value_type{2, 'B'}, value_type{1, 'C'}};
+
+      static constexpr bool is_valid = data.is_valid();
+
+      CHECK_FALSE(is_valid);
+    }
+
+    //*************************************************************************
+    TEST(test_no_perfect_hash_is_not_valid)
+    {
+      static constexpr etl::const_unordered_map<int, char, 3, colliding_hash> data{value_type{1, 'A'}, value_type{2, 'B'}};
+
+      static constexpr bool is_valid = data.is_valid();
+
+      CHECK_FALSE(is_valid);
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      static constexpr Data data{value_type{1, 'A'}, value_type{2, 'B'}, value_type{3, 'C'}};
+
+      const IData& idata = data;
+
+      CHECK_EQUAL(3U, idata.size());
+      CHECK_EQUAL('B', idata[2]);
+      CHECK(idata.find(4) == idata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_keys)
+    {
+      using Map      = etl::const_unordered_map<etl::string_view, int, 6>;
+      using MapValue = Map::value_type;
+
+      static constexpr Map data{MapValue{"zero", 0}, MapValue{"one", 1}, MapValue{"two", 2}, MapValue{"three", 3}, MapValue{"four", 4}, MapValue{"five", 5}};
+
+      static constexpr bool is_valid = data.is_valid();
+      static constexpr int  three    = data.at(etl::string_view("three"));
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(3, three);
+      CHECK_EQUAL(0, data.at(etl::string_view("zero")));
+      CHECK_EQUAL(5, data.at(etl::string_view("five")));
+      CHECK_FALSE(data.contains(etl::string_view("six")));
+      CHECK_FALSE(data.contains(etl::string_view("")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_key_equal)
+    {
+      using Map      = etl::const_unordered_map<etl::string_view, int, 3, etl::constexpr_hash<etl::string_view>, etl::equal_to<>>;
+      using MapValue = Map::value_type;
+
+      static constexpr Map data{MapValue{"A", 1}, MapValue{"B", 2}, MapValue{"C", 3}};
+
+      CHECK_EQUAL(2, data.at("B"));
+      CHECK(data.contains("C"));
+      CHECK_FALSE(data.contains("D"));
+    }
+
+    //*************************************************************************
+    TEST(test_large_map)
+    {
+      // Large enough to exceed the default template instantiation depth, if
+      // the element list was expanded recursively.
+      static constexpr const auto& data = LargeMap<etl::make_index_sequence<2000>>::data;
+
+      static constexpr bool is_valid = data.is_valid();
+      static constexpr int  last     = data.at(1999 * 7919);
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(1999, last);
+
+      for (size_t i = 0U; i < 2000U; ++i)
+      {
+        CHECK_EQUAL(int(i), data.at(int(i * 7919U)));
+        CHECK_FALSE(data.contains(int(i * 7919U) + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      static constexpr Data data1{value_type{1, 'A'}, value_type{2, 'B'}, value_type{3, 'C'}};
+      static constexpr Data data2{value_type{3, 'C'}, value_type{1, 'A'}, value_type{2, 'B'}};
+      static constexpr Data data3{value_type{3, 'C'}, value_type{1, 'A'}, value_type{2, 'X'}};
+
+      static constexpr bool equal     = (data1 == data2);
+      static constexpr bool not_equal = (data1 != data3);
+
+      CHECK_TRUE(equal);
+      CHECK_TRUE(not_equal);
+    }
+
+  #if ETL_USING_CPP17
+    //*************************************************************************
+    TEST(test_cpp17_deduced_constructor)
+    {
+      static constexpr etl::const_unordered_map data{value_type{1, 'A'}, value_type{2, 'B'}, value_type{3, 'C'}};
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL('B', data.at(2));
+    }
+  #endif
+  }
+} // namespace
+
+#endif
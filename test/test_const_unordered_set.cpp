@@ -0,0 +1,217 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the 'Software'), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "etl/platform.h"
+#if ETL_USING_CPP14
+
+  #include "unit_test_framework.h"
+
+  #include <set>
+
+  #include "etl/const_unordered_set.h"
+  #include "etl/string_view.h"
+
+namespace
+{
+  static const size_t Max_Size = 10UL;
+
+  using Data           = etl::const_unordered_set<int, Max_Size>;
+  using IData          = etl::iconst_unordered_set<int, etl::constexpr_hash<int>, etl::equal_to<int>>;
+  using const_iterator = Data::const_iterator;
+
+  //*************************************************************************
+  // A set of as many keys as indices, spread out over the integers.
+  template <typename TIndices>
+  struct LargeSet;
+
+  template <size_t... Indices>
+  struct LargeSet<etl::index_sequence<Indices...>>
+  {
+    using Set = etl::const_unordered_set<int, sizeof...(Indices)>;
+
+    static constexpr Set data{int(Indices * 7919U)...};
+  };
+
+  template <size_t... Indices>
+  constexpr typename LargeSet<etl::index_sequence<Indices...>>::Set LargeSet<etl::index_sequence<Indices...>>::data;
+
+  SUITE(test_const_unordered_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      static constexpr Data data;
+
+      static constexpr bool   is_valid = data.is_valid();
+      static constexpr size_t size     = data.size();
+      static constexpr bool   empty    = data.empty();
+      static constexpr size_t max_size = data.max_size();
+      static constexpr bool   contains = data.contains(1);
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(size == 0UL);
+      CHECK_TRUE(empty);
+      CHECK_TRUE(max_size == Max_Size);
+      CHECK_TRUE(data.begin() == data.end());
+      CHECK_FALSE(contains);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_max_size)
+    {
+      static constexpr Data data{0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+
+      static constexpr bool is_valid = data.is_valid();
+      static constexpr bool full     = data.full();
+      static constexpr bool has_50   = data.contains(50);
+      static constexpr bool has_55   = data.contains(55);
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(full);
+      CHECK_TRUE(has_50);
+      CHECK_FALSE(has_55);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL((i % 10) == 0, data.contains(i));
+        CHECK_EQUAL(((i % 10) == 0) ? 1U : 0U, data.count(i));
+      }
+
+      CHECK_EQUAL(40, *data.find(40));
+      CHECK(data.find(41) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      static constexpr Data data{5, 4, 3, 2, 1};
+
+      std::set<int> compare(data.begin(), data.end());
+
+      CHECK_EQUAL(5U, compare.size());
+      CHECK_EQUAL(1, *compare.begin());
+      CHECK_EQUAL(5, *compare.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      static constexpr Data data{1, 2, 3};
+
+      static constexpr ETL_OR_STD::pair<const_iterator, const_iterator> found     = data.equal_range(2);
+      static constexpr ETL_OR_STD::pair<const_iterator, const_iterator> not_found = data.equal_range(4);
+
+      CHECK_EQUAL(1, std::distance(found.first, found.second));
+      CHECK_EQUAL(2, *found.first);
+      CHECK(not_found.first == not_found.second);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_keys_are_not_valid)
+    {
+      static constexpr Data data{1, 2, 3, 2};
+
+      static constexpr bool is_valid = data.is_valid();
+
+      CHECK_FALSE(is_valid);
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      static constexpr Data data{1, 2, 3};
+
+      const IData& idata = data;
+
+      CHECK_EQUAL(3U, idata.size());
+      CHECK(idata.contains(3));
+      CHECK_FALSE(idata.contains(4));
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_keys)
+    {
+      using Set = etl::const_unordered_set<etl::string_view, 4, etl::constexpr_hash<etl::string_view>, etl::equal_to<>>;
+
+      static constexpr Set data{etl::string_view("red"), etl::string_view("green"), etl::string_view("blue"), etl::string_view("black")};
+
+      static constexpr bool is_valid = data.is_valid();
+      static constexpr bool has_blue = data.contains(etl::string_view("blue"));
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(has_blue);
+      CHECK_TRUE(data.contains("black"));
+      CHECK_FALSE(data.contains("white"));
+    }
+
+    //*************************************************************************
+    TEST(test_large_set)
+    {
+      // Large enough to exceed the default template instantiation depth, if
+      // the element list was expanded recursively.
+      static constexpr const auto& data = LargeSet<etl::make_index_sequence<2000>>::data;
+
+      static constexpr bool is_valid = data.is_valid();
+
+      CHECK_TRUE(is_valid);
+
+      for (size_t i = 0U; i < 2000U; ++i)
+      {
+        CHECK(data.contains(int(i * 7919U)));
+        CHECK_FALSE(data.contains(int(i * 7919U) + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      static constexpr Data data1{1, 2, 3};
+      static constexpr Data data2{3, 1, 2};
+      static constexpr Data data3{3, 1, 4};
+
+      static constexpr bool equal     = (data1 == data2);
+      static constexpr bool not_equal = (data1 != data3);
+
+      CHECK_TRUE(equal);
+      CHECK_TRUE(not_equal);
+    }
+
+  #if ETL_USING_CPP17
+    //*************************************************************************
+    TEST(test_cpp17_deduced_constructor)
+    {
+      static constexpr etl::const_unordered_set data{1, 2, 3};
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK(data.contains(2));
+    }
+  #endif
+  }
+} // namespace
+
+#endif
@@ -316,5 +316,94 @@ namespace
       uint16_t crc3 = etl::crc16_kermit_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table sizes 2048 and 4096, slicing by 8 and 16
+    //*************************************************************************
+    TEST(test_crc16_kermit_slicing)
+    {
+      std::string data("123456789");
+
+      uint16_t crc2048 = etl::crc16_kermit_t2048(data.c_str(), data.c_str() + data.size());
+      uint16_t crc4096 = etl::crc16_kermit_t4096(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0x2189U, crc2048);
+      CHECK_EQUAL(0x2189U, crc4096);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc16_kermit_slicing_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint16_t crc2048 = etl::crc16_kermit_t2048(data, data + 9);
+      constexpr uint16_t crc4096 = etl::crc16_kermit_t4096(data, data + 9);
+
+      CHECK_EQUAL(0x2189U, crc2048);
+      CHECK_EQUAL(0x2189U, crc4096);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc16_kermit_slicing_add_range_blocks)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc16_kermit_t256 expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint16_t crc2048 = etl::crc16_kermit_t2048(begin, begin + length);
+          uint16_t crc4096 = etl::crc16_kermit_t4096(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc2048);
+          CHECK_EQUAL(expected.value(), crc4096);
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc16_kermit_combine)
+    {
+      std::string data("123456789");
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint16_t crc1 = etl::crc16_kermit(data.c_str(), data.c_str() + split);
+        uint16_t crc2 = etl::crc16_kermit(data.c_str() + split, data.c_str() + data.size());
+        uint16_t crc  = etl::crc16_kermit::combine(crc1, crc2, data.size() - split);
+
+        CHECK_EQUAL(0x2189U, crc);
+      }
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc16_kermit_combine_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint16_t crc1   = etl::crc16_kermit(data, data + 4);
+      constexpr uint16_t crc2   = etl::crc16_kermit(data + 4, data + 9);
+      constexpr uint16_t crc    = etl::crc16_kermit::combine(crc1, crc2, 5U);
+
+      CHECK_EQUAL(0x2189U, crc);
+    }
+#endif
   }
 } // namespace
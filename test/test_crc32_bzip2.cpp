@@ -316,5 +316,94 @@ namespace
       uint32_t crc3 = etl::crc32_bzip2_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table sizes 2048 and 4096, slicing by 8 and 16
+    //*************************************************************************
+    TEST(test_crc32_bzip2_slicing)
+    {
+      std::string data("123456789");
+
+      uint32_t crc2048 = etl::crc32_bzip2_t2048(data.c_str(), data.c_str() + data.size());
+      uint32_t crc4096 = etl::crc32_bzip2_t4096(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0xFC891918UL, crc2048);
+      CHECK_EQUAL(0xFC891918UL, crc4096);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc32_bzip2_slicing_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc2048 = etl::crc32_bzip2_t2048(data, data + 9);
+      constexpr uint32_t crc4096 = etl::crc32_bzip2_t4096(data, data + 9);
+
+      CHECK_EQUAL(0xFC891918UL, crc2048);
+      CHECK_EQUAL(0xFC891918UL, crc4096);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_bzip2_slicing_add_range_blocks)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc32_bzip2_t256 expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint32_t crc2048 = etl::crc32_bzip2_t2048(begin, begin + length);
+          uint32_t crc4096 = etl::crc32_bzip2_t4096(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc2048);
+          CHECK_EQUAL(expected.value(), crc4096);
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc32_bzip2_combine)
+    {
+      std::string data("123456789");
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint32_t crc1 = etl::crc32_bzip2(data.c_str(), data.c_str() + split);
+        uint32_t crc2 = etl::crc32_bzip2(data.c_str() + split, data.c_str() + data.size());
+        uint32_t crc  = etl::crc32_bzip2::combine(crc1, crc2, data.size() - split);
+
+        CHECK_EQUAL(0xFC891918UL, crc);
+      }
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc32_bzip2_combine_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc1   = etl::crc32_bzip2(data, data + 4);
+      constexpr uint32_t crc2   = etl::crc32_bzip2(data + 4, data + 9);
+      constexpr uint32_t crc    = etl::crc32_bzip2::combine(crc1, crc2, 5U);
+
+      CHECK_EQUAL(0xFC891918UL, crc);
+    }
+#endif
   }
 } // namespace
@@ -135,6 +135,44 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc32_c_add_range_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 300UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc32_c expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint32_t crc = etl::crc32_c(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc);
+        }
+      }
+
+      etl::crc32_c expected(data.begin(), data.end());
+
+      etl::crc32_c crc_calculator;
+      crc_calculator.add(data.data(), data.data() + 333U);
+      crc_calculator.add(data.data() + 333U, data.data() + data.size());
+
+      CHECK_EQUAL(expected.value(), crc_calculator.value());
+    }
+
     //*************************************************************************
     // Table size 16
     //*************************************************************************
@@ -135,6 +135,44 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc64_ecma_add_range_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 300UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc64_ecma expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint64_t crc = etl::crc64_ecma(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc);
+        }
+      }
+
+      etl::crc64_ecma expected(data.begin(), data.end());
+
+      etl::crc64_ecma crc_calculator;
+      crc_calculator.add(data.data(), data.data() + 333U);
+      crc_calculator.add(data.data() + 333U, data.data() + data.size());
+
+      CHECK_EQUAL(expected.value(), crc_calculator.value());
+    }
+
     //*************************************************************************
     // Table size 16
     //*************************************************************************
@@ -316,5 +354,94 @@ namespace
       uint64_t crc3 = etl::crc64_ecma_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table sizes 2048 and 4096, slicing by 8 and 16
+    //*************************************************************************
+    TEST(test_crc64_ecma_slicing)
+    {
+      std::string data("123456789");
+
+      uint64_t crc2048 = etl::crc64_ecma_t2048(data.c_str(), data.c_str() + data.size());
+      uint64_t crc4096 = etl::crc64_ecma_t4096(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc2048);
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc4096);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc64_ecma_slicing_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint64_t crc2048 = etl::crc64_ecma_t2048(data, data + 9);
+      constexpr uint64_t crc4096 = etl::crc64_ecma_t4096(data, data + 9);
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc2048);
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc4096);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_slicing_add_range_blocks)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc64_ecma_t256 expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint64_t crc2048 = etl::crc64_ecma_t2048(begin, begin + length);
+          uint64_t crc4096 = etl::crc64_ecma_t4096(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc2048);
+          CHECK_EQUAL(expected.value(), crc4096);
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc64_ecma_combine)
+    {
+      std::string data("123456789");
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint64_t crc1 = etl::crc64_ecma(data.c_str(), data.c_str() + split);
+        uint64_t crc2 = etl::crc64_ecma(data.c_str() + split, data.c_str() + data.size());
+        uint64_t crc  = etl::crc64_ecma::combine(crc1, crc2, data.size() - split);
+
+        CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+      }
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc64_ecma_combine_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint64_t crc1   = etl::crc64_ecma(data, data + 4);
+      constexpr uint64_t crc2   = etl::crc64_ecma(data + 4, data + 9);
+      constexpr uint64_t crc    = etl::crc64_ecma::combine(crc1, crc2, 5U);
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+#endif
   }
 } // namespace
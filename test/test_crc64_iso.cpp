@@ -316,5 +316,94 @@ namespace
       uint64_t crc3 = etl::crc64_iso_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table sizes 2048 and 4096, slicing by 8 and 16
+    //*************************************************************************
+    TEST(test_crc64_iso_slicing)
+    {
+      std::string data("123456789");
+
+      uint64_t crc2048 = etl::crc64_iso_t2048(data.c_str(), data.c_str() + data.size());
+      uint64_t crc4096 = etl::crc64_iso_t4096(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0xB90956C775A41001ULL, crc2048);
+      CHECK_EQUAL(0xB90956C775A41001ULL, crc4096);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc64_iso_slicing_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint64_t crc2048 = etl::crc64_iso_t2048(data, data + 9);
+      constexpr uint64_t crc4096 = etl::crc64_iso_t4096(data, data + 9);
+
+      CHECK_EQUAL(0xB90956C775A41001ULL, crc2048);
+      CHECK_EQUAL(0xB90956C775A41001ULL, crc4096);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc64_iso_slicing_add_range_blocks)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 193U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        for (size_t offset = 0UL; offset < 3UL; ++offset)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          etl::crc64_iso_t256 expected;
+
+          for (size_t i = 0UL; i < length; ++i)
+          {
+            expected.add(begin[i]);
+          }
+
+          uint64_t crc2048 = etl::crc64_iso_t2048(begin, begin + length);
+          uint64_t crc4096 = etl::crc64_iso_t4096(begin, begin + length);
+
+          CHECK_EQUAL(expected.value(), crc2048);
+          CHECK_EQUAL(expected.value(), crc4096);
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc64_iso_combine)
+    {
+      std::string data("123456789");
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint64_t crc1 = etl::crc64_iso(data.c_str(), data.c_str() + split);
+        uint64_t crc2 = etl::crc64_iso(data.c_str() + split, data.c_str() + data.size());
+        uint64_t crc  = etl::crc64_iso::combine(crc1, crc2, data.size() - split);
+
+        CHECK_EQUAL(0xB90956C775A41001ULL, crc);
+      }
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc64_iso_combine_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint64_t crc1   = etl::crc64_iso(data, data + 4);
+      constexpr uint64_t crc2   = etl::crc64_iso(data + 4, data + 9);
+      constexpr uint64_t crc    = etl::crc64_iso::combine(crc1, crc2, 5U);
+
+      CHECK_EQUAL(0xB90956C775A41001ULL, crc);
+    }
+#endif
   }
 } // namespace
@@ -0,0 +1,120 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "etl/crc_parallel.h"
+#include "etl/crc32.h"
+#include "etl/crc64_iso.h"
+#include "etl/crc8_ccitt.h"
+
+#if ETL_USING_STL && ETL_USING_CPP11
+
+namespace
+{
+  //***************************************************************************
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = static_cast<uint8_t>((i * 31U) + (i >> 9U));
+    }
+
+    return data;
+  }
+
+  SUITE(test_crc_parallel)
+  {
+    //*************************************************************************
+    TEST(test_crc_parallel_empty)
+    {
+      const uint8_t data[1] = {0U};
+
+      CHECK_EQUAL(etl::crc32().value(), (etl::crc_parallel<etl::crc32, 4U>(data, data)));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_parallel_small_block)
+    {
+      std::vector<uint8_t> data = make_data(1000U);
+
+      const uint8_t* begin = data.data();
+      const uint8_t* end   = data.data() + data.size();
+
+      CHECK_EQUAL(etl::crc32(begin, end).value(), (etl::crc_parallel<etl::crc32, 4U>(begin, end)));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_parallel_large_blocks)
+    {
+      std::vector<uint8_t> data = make_data(1000003U);
+
+      const size_t lengths[] = {65536U, 131071U, 131072U, 200000U, 300001U, 1000003U};
+
+      for (size_t i = 0UL; i < (sizeof(lengths) / sizeof(lengths[0])); ++i)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* end   = data.data() + lengths[i];
+
+        CHECK_EQUAL(etl::crc32(begin, end).value(), (etl::crc_parallel<etl::crc32, 4U>(begin, end)));
+        CHECK_EQUAL(etl::crc32_t4096(begin, end).value(), (etl::crc_parallel<etl::crc32_t4096, 3U>(begin, end)));
+        CHECK_EQUAL(etl::crc8_ccitt(begin, end).value(), (etl::crc_parallel<etl::crc8_ccitt, 2U>(begin, end)));
+        CHECK_EQUAL(etl::crc64_iso(begin, end).value(), (etl::crc_parallel<etl::crc64_iso, 7U>(begin, end)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc_parallel_char_pointers)
+    {
+      std::vector<uint8_t> data = make_data(500000U);
+
+      const char* begin = reinterpret_cast<const char*>(data.data());
+      const char* end   = begin + data.size();
+
+      CHECK_EQUAL(etl::crc64_iso(begin, end).value(), (etl::crc_parallel<etl::crc64_iso, 4U>(begin, end)));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_parallel_one_thread)
+    {
+      std::vector<uint8_t> data = make_data(500000U);
+
+      const uint8_t* begin = data.data();
+      const uint8_t* end   = data.data() + data.size();
+
+      CHECK_EQUAL(etl::crc32(begin, end).value(), (etl::crc_parallel<etl::crc32, 1U>(begin, end)));
+    }
+  }
+} // namespace
+
+#endif
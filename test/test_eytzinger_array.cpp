@@ -0,0 +1,245 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "etl/eytzinger_array.h"
+
+namespace
+{
+  using Data         = etl::eytzinger_array<int, 100>;
+  using IData        = etl::ieytzinger_array<int>;
+  using Compare_Data = std::set<int>;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(const T1& data, const T2& compare)
+  {
+    return (data.size() == compare.size()) && std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  //*************************************************************************
+  std::vector<int> make_sorted(size_t size)
+  {
+    std::vector<int> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(int(i) * 2);
+    }
+
+    return values;
+  }
+
+  SUITE(test_eytzinger_array)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK_EQUAL(100U, data.capacity());
+      CHECK_EQUAL(100U, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_breadth_first_layout)
+    {
+      const int sorted[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+      const int bfs[]    = {7, 4, 9, 2, 6, 8, 10, 1, 3, 5};
+
+      Data data(std::begin(sorted), std::end(sorted));
+
+      CHECK_EQUAL(10U, data.size());
+      CHECK(std::equal(std::begin(bfs), std::end(bfs), data.data()));
+    }
+
+    //*************************************************************************
+    TEST(test_against_reference)
+    {
+      // Every shape of tree from empty to a full capacity.
+      for (size_t size = 0U; size <= 100U; ++size)
+      {
+        std::vector<int> values = make_sorted(size);
+
+        Data         data(values.begin(), values.end());
+        Compare_Data compare(values.begin(), values.end());
+
+        CHECK(Check_Equal(data, compare));
+        CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+        for (int key = -1; key <= int(size * 2U); ++key)
+        {
+          Compare_Data::const_iterator lower = compare.lower_bound(key);
+          Compare_Data::const_iterator upper = compare.upper_bound(key);
+
+          CHECK_EQUAL(std::distance(compare.begin(), lower), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), upper), std::distance(data.begin(), data.upper_bound(key)));
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(compare.count(key) != 0U, data.contains(key));
+          CHECK_EQUAL(compare.find(key) == compare.end(), data.find(key) == data.end());
+
+          if (data.find(key) != data.end())
+          {
+            CHECK_EQUAL(key, *data.find(key));
+          }
+
+          ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range(key);
+          CHECK(range.first == data.lower_bound(key));
+          CHECK(range.second == data.upper_bound(key));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      const int sorted[] = {1, 2, 3, 4, 5, 6};
+
+      Data data(std::begin(sorted), std::end(sorted));
+
+      Data::const_iterator itr = data.end();
+      --itr;
+      CHECK_EQUAL(6, *itr);
+
+      Data::const_iterator old = itr--;
+      CHECK_EQUAL(6, *old);
+      CHECK_EQUAL(5, *itr);
+
+      old = itr++;
+      CHECK_EQUAL(5, *old);
+      CHECK_EQUAL(6, *itr);
+
+      ++itr;
+      CHECK(itr == data.end());
+      CHECK_EQUAL(1, *data.cbegin());
+      CHECK_EQUAL(6, *data.crbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<int> values = make_sorted(11U);
+
+      etl::eytzinger_array<int, 10> data;
+
+      CHECK_THROW(data.assign(values.begin(), values.end()), etl::eytzinger_array_full);
+
+      data.assign(values.begin(), values.end() - 1);
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+    }
+
+    //*************************************************************************
+    TEST(test_unsorted)
+    {
+      const int unsorted[]   = {1, 3, 2};
+      const int duplicates[] = {1, 2, 2};
+
+      Data data;
+
+      CHECK_THROW(data.assign(std::begin(unsorted), std::end(unsorted)), etl::eytzinger_array_unsorted);
+      CHECK_THROW(data.assign(std::begin(duplicates), std::end(duplicates)), etl::eytzinger_array_unsorted);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      Data  data = {1, 2, 3, 4};
+      Data  copy(data);
+      Data  other = {1, 2, 3};
+      IData& iother = other;
+
+      CHECK(copy == data);
+      CHECK(other != data);
+
+      iother = data;
+      CHECK(other == data);
+      CHECK_EQUAL(4U, other.size());
+      CHECK_EQUAL(4, *other.find(4));
+    }
+
+    //*************************************************************************
+    TEST(test_greater)
+    {
+      const int sorted[] = {9, 7, 5, 3, 1};
+
+      etl::eytzinger_array<int, 10, etl::greater<int> > data(std::begin(sorted), std::end(sorted));
+
+      CHECK(std::equal(data.begin(), data.end(), std::begin(sorted)));
+      CHECK_EQUAL(5, *data.lower_bound(6));
+      CHECK_EQUAL(3, *data.upper_bound(5));
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_string_values)
+    {
+      std::set<std::string> compare;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        compare.insert(std::to_string(i));
+      }
+
+      etl::eytzinger_array<std::string, 50> data(compare.begin(), compare.end());
+
+      CHECK(Check_Equal(data, compare));
+      CHECK_EQUAL(std::string("25"), *data.find(std::string("25")));
+      CHECK(data.find(std::string("x")) == data.end());
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      etl::uninitialized_buffer_of<int, 20> buffer;
+
+      std::vector<int> values = make_sorted(20U);
+
+      etl::eytzinger_array_ext<int> data(values.begin(), values.end(), buffer.begin(), 20U);
+
+      CHECK(data.full());
+      CHECK_EQUAL(20, *data.lower_bound(19));
+      CHECK_EQUAL(38, *data.rbegin());
+    }
+  }
+} // namespace
@@ -825,6 +825,88 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_with_existing)
+    {
+      etl::flat_map<int, int, 200> data;
+      std::map<int, int>           compare_data;
+      uint32_t                    seed = 12345U;
+      int                         order = 0;
+
+      for (int batch = 0; batch < 10; ++batch)
+      {
+        std::vector<ElementInt> values;
+
+        for (int i = 0; i < 20; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          values.push_back(ElementInt(int((seed >> 16) % 300U), order++));
+        }
+
+        data.insert(values.begin(), values.end());
+        compare_data.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_with_duplicates_when_nearly_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(ElementInt(i, i));
+      }
+
+      // Twelve values, but only two new keys.
+      std::vector<ElementInt> values;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        values.push_back(ElementInt(i, 100 + i));
+      }
+
+      values.push_back(ElementInt(9, 9));
+      values.push_back(ElementInt(8, 8));
+      values.push_back(ElementInt(9, 109));
+      values.push_back(ElementInt(8, 108));
+
+      CHECK_NO_THROW(data.insert(values.begin(), values.end()));
+
+      CHECK_EQUAL(SIZE, data.size());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(i, data[i]);
+      }
+
+      values.push_back(ElementInt(10, 10));
+
+      CHECK_THROW(data.insert(values.begin(), values.end()), etl::flat_map_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(etl::sorted_unique_t(), compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.assign(etl::sorted_unique_t(), compare_data.begin(), std::next(compare_data.begin(), 3));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      CHECK_THROW(data.assign(etl::sorted_unique_t(), excess_data.begin(), excess_data.end()), etl::flat_map_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
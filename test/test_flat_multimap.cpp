@@ -581,6 +581,50 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_with_existing)
+    {
+      etl::flat_multimap<int, int, 200> data;
+      std::multimap<int, int>           compare_data;
+      uint32_t                    seed = 12345U;
+      int                         order = 0;
+
+      for (int batch = 0; batch < 10; ++batch)
+      {
+        std::vector<ElementInt> values;
+
+        for (int i = 0; i < 20; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          values.push_back(ElementInt(int((seed >> 16) % 50U), order++));
+        }
+
+        data.insert(values.begin(), values.end());
+        compare_data.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_sorted_equivalent)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(etl::sorted_equivalent_t(), compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.assign(etl::sorted_equivalent_t(), compare_data.begin(), std::next(compare_data.begin(), 3));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      CHECK_THROW(data.assign(etl::sorted_equivalent_t(), excess_data.begin(), excess_data.end()), etl::flat_multimap_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
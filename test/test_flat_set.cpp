@@ -614,6 +614,76 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_with_existing)
+    {
+      etl::flat_set<int, 200> data;
+      std::set<int>           compare_data;
+      uint32_t                seed = 12345U;
+
+      for (int batch = 0; batch < 10; ++batch)
+      {
+        std::vector<int> values;
+
+        for (int i = 0; i < 20; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          values.push_back(int((seed >> 16) % 300U));
+        }
+
+        data.insert(values.begin(), values.end());
+        compare_data.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_with_duplicates_when_nearly_full)
+    {
+      const int current_count = NDC::get_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.begin() + 8);
+
+        // Twelve values, but only two new ones.
+        std::vector<NDC> values(initial_data.begin(), initial_data.begin() + 8);
+        values.push_back(N9);
+        values.push_back(N8);
+        values.push_back(N9);
+        values.push_back(N8);
+
+        CHECK_NO_THROW(data.insert(values.begin(), values.end()));
+        CHECK_EQUAL(current_count + int(SIZE + values.size()), NDC::get_instance_count());
+
+        Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+        CHECK_EQUAL(SIZE, data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(etl::sorted_unique_t(), compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.assign(etl::sorted_unique_t(), compare_data.begin(), std::next(compare_data.begin(), 3));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      CHECK_THROW(data.assign(etl::sorted_unique_t(), excess_data.begin(), excess_data.end()), etl::flat_set_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_default_value)
     {
@@ -1269,5 +1339,60 @@ namespace
       CHECK(data.contains(Key(N5)));
       CHECK(!data.contains(Key(NX)));
     }
+
+    //*************************************************************************
+    TEST(test_set_operations)
+    {
+      typedef etl::flat_set<int, 100> Set;
+
+      Set large;
+      Set medium;
+      Set small;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        large.insert(i * 3);
+      }
+
+      for (int i = 0; i < 40; ++i)
+      {
+        medium.insert(i * 5);
+      }
+
+      small.insert(-1);
+      small.insert(150);
+      small.insert(151);
+      small.insert(400);
+
+      const Set* sets[] = {&large, &medium, &small};
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+          const Set& lhs = *sets[i];
+          const Set& rhs = *sets[j];
+
+          std::vector<int> expected;
+          std::vector<int> result;
+
+          std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+          lhs.set_intersection(rhs, std::back_inserter(result));
+          CHECK(expected == result);
+
+          expected.clear();
+          result.clear();
+          std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+          lhs.set_union(rhs, std::back_inserter(result));
+          CHECK(expected == result);
+
+          expected.clear();
+          result.clear();
+          std::set_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+          lhs.set_difference(rhs, std::back_inserter(result));
+          CHECK(expected == result);
+        }
+      }
+    }
   }
 } // namespace
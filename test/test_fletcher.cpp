@@ -0,0 +1,219 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <iterator>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "etl/fletcher.h"
+
+namespace
+{
+  //***************************************************************************
+  /// Sums little endian words of Word_Size bytes, padding a partial word.
+  //***************************************************************************
+  template <size_t Word_Size>
+  uint64_t reference_fletcher(const uint8_t* begin, const uint8_t* end)
+  {
+    const uint64_t modulus = (uint64_t(1U) << (8U * Word_Size)) - 1U;
+
+    uint64_t s1 = 0U;
+    uint64_t s2 = 0U;
+
+    while (begin != end)
+    {
+      uint64_t word = 0U;
+
+      for (size_t i = 0U; (i < Word_Size) && (begin != end); ++i)
+      {
+        word |= uint64_t(*begin++) << (8U * i);
+      }
+
+      s1 = (s1 + word) % modulus;
+      s2 = (s2 + s1) % modulus;
+    }
+
+    return (s2 << (8U * Word_Size)) | s1;
+  }
+
+  //***************************************************************************
+  /// Checks blocks added through pointers against the reference.
+  //***************************************************************************
+  template <typename TFletcher, size_t Word_Size>
+  bool check_blocks(const std::vector<uint8_t>& data)
+  {
+    // Pointer ranges may be added in blocks.
+    for (size_t first = 0U; first < 4U; ++first)
+    {
+      for (size_t length = 0U; length < (data.size() - first); length += 61U)
+      {
+        const uint8_t* begin = data.data() + first;
+
+        // Start with a partial word.
+        const size_t split = (length < 3U) ? length : 3U;
+
+        TFletcher fletcher_calculator;
+
+        fletcher_calculator.add(begin, begin + split);
+        fletcher_calculator.add(begin + split, begin + length);
+
+        if (uint64_t(fletcher_calculator.value()) != reference_fletcher<Word_Size>(begin, begin + length))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  std::vector<uint8_t> make_data()
+  {
+    std::vector<uint8_t> data(1000U);
+
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      data[i] = static_cast<uint8_t>((i * 7U) + 3U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_fletcher)
+  {
+    //*************************************************************************
+    TEST(test_fletcher16_constructor)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8F0U, etl::fletcher16(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x2057U, etl::fletcher16(data2.begin(), data2.end()).value());
+      CHECK_EQUAL(0x0627U, etl::fletcher16(data3.begin(), data3.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32_constructor)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xF04FC729UL, etl::fletcher32(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x56502D2AUL, etl::fletcher32(data2.begin(), data2.end()).value());
+      CHECK_EQUAL(0xEBE19591UL, etl::fletcher32(data3.begin(), data3.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher64_constructor)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8C6C527646362C6ULL, etl::fletcher64(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0xC8C72B276463C8C6ULL, etl::fletcher64(data2.begin(), data2.end()).value());
+      CHECK_EQUAL(0x312E2B28CCCAC8C6ULL, etl::fletcher64(data3.begin(), data3.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32_add_values)
+    {
+      std::string data("abcde");
+
+      etl::fletcher32 fletcher_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        fletcher_calculator.add(static_cast<uint8_t>(data[i]));
+      }
+
+      uint32_t sum = fletcher_calculator;
+
+      CHECK_EQUAL(0xF04FC729UL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher64_add_range_via_iterator)
+    {
+      std::string data("abcde");
+
+      etl::fletcher64 fletcher_calculator;
+
+      std::copy(data.begin(), data.end(), fletcher_calculator.input());
+
+      uint64_t sum = fletcher_calculator.value();
+
+      CHECK_EQUAL(0xC8C6C527646362C6ULL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher_reset)
+    {
+      std::string data("abcde");
+
+      etl::fletcher64 fletcher_calculator;
+
+      // Leave a partial word, which the reset must discard.
+      fletcher_calculator.add(data.begin(), data.begin() + 3);
+      fletcher_calculator.reset();
+      fletcher_calculator.add(data.begin(), data.end());
+
+      CHECK_EQUAL(0xC8C6C527646362C6ULL, fletcher_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher_add_range_blocks)
+    {
+      std::vector<uint8_t> data = make_data();
+
+      CHECK((check_blocks<etl::fletcher16, 1U>(data)));
+      CHECK((check_blocks<etl::fletcher32, 2U>(data)));
+      CHECK((check_blocks<etl::fletcher64, 4U>(data)));
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher_add_range_long_blocks)
+    {
+      // All 0xFF gives the largest sums, and is longer than one SIMD block.
+      std::vector<uint8_t> data(100001U, 0xFFU);
+
+      const uint8_t* begin = data.data();
+      const uint8_t* end   = data.data() + data.size();
+
+      CHECK_EQUAL(reference_fletcher<1U>(begin, end), etl::fletcher16(begin, end).value());
+      CHECK_EQUAL(reference_fletcher<2U>(begin, end), etl::fletcher32(begin, end).value());
+      CHECK_EQUAL(reference_fletcher<4U>(begin, end), etl::fletcher64(begin, end).value());
+    }
+  }
+} // namespace
@@ -37,6 +37,7 @@ SOFTWARE.
 #include <forward_list>
 #include <functional>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -1144,6 +1145,36 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_sort_large_is_stable)
+    {
+      typedef etl::forward_list<ItemNDC, 1000> Data;
+
+      std::unique_ptr<Data> data(new Data);
+      std::list<ItemNDC>    compare_data;
+      uint32_t              seed = 12345U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        ItemNDC item(std::to_string((seed >> 16) % 50U), i);
+
+        data->push_front(item);
+        compare_data.push_front(item);
+      }
+
+      compare_data.sort();
+      data->sort();
+
+      CHECK_EQUAL(compare_data.size(), data->size());
+      CHECK(std::equal(data->begin(), data->end(), compare_data.begin(), ItemNDC::are_identical));
+
+      data->sort(std::greater<ItemNDC>());
+      compare_data.sort(std::greater<ItemNDC>());
+
+      CHECK(std::equal(data->begin(), data->end(), compare_data.begin(), ItemNDC::are_identical));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_sort_empty)
     {
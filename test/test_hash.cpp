@@ -303,6 +303,34 @@ namespace
       CHECK_EQUAL(expectedHash, hash);
     }
 
+    //*************************************************************************
+    TEST(test_hash_mix_integral)
+    {
+      // Every bit of the value should affect the low bits of the hash.
+      size_t hash0 = etl::private_hash::mix_integral(0x5AA555AAUL);
+
+      for (int bit = 0; bit < 32; ++bit)
+      {
+        size_t hash1 = etl::private_hash::mix_integral(0x5AA555AAUL ^ (1UL << bit));
+
+        CHECK((hash0 & 0xFFU) != (hash1 & 0xFFU));
+      }
+
+      // Sequential values should be spread out.
+      std::vector<size_t> buckets(16U, 0U);
+
+      for (unsigned int i = 0U; i < 1600U; ++i)
+      {
+        ++buckets[etl::private_hash::mix_integral(i) % 16U];
+      }
+
+      for (size_t i = 0U; i < buckets.size(); ++i)
+      {
+        CHECK(buckets[i] > 50U);
+        CHECK(buckets[i] < 150U);
+      }
+    }
+
     //*************************************************************************
     TEST(test_hash_poisoned)
     {
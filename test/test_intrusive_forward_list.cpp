@@ -1077,6 +1077,40 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_sort_large_is_stable)
+    {
+      InitialDataNDC items;
+      uint32_t       seed = 12345U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        items.push_back(ItemNDCNode(std::to_string((seed >> 16) % 50U), i));
+      }
+
+      std::list<ItemNDCNode> compare_data(items.begin(), items.end());
+      DataNDC0               data(items.begin(), items.end());
+
+      compare_data.sort();
+      data.sort();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin(), EqualItemNDCNode()));
+
+      std::list<ItemNDCNode>::const_iterator citr = compare_data.begin();
+
+      for (DataNDC0::const_iterator ditr = data.begin(); ditr != data.end(); ++ditr, ++citr)
+      {
+        CHECK_EQUAL(citr->data.index, ditr->data.index);
+      }
+
+      data.sort(std::greater<ItemNDCNode>());
+      compare_data.sort(std::greater<ItemNDCNode>());
+
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin(), EqualItemNDCNode()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_sort_compare)
     {
@@ -0,0 +1,312 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "etl/circular_buffer.h"
+#include "etl/kway_merge.h"
+#include "etl/vector.h"
+
+namespace
+{
+  //*************************************************************************
+  /// The value is compared. The run shows where an element came from.
+  //*************************************************************************
+  struct Item
+  {
+    Item()
+      : value(0)
+      , run(0)
+    {
+    }
+
+    Item(int value_, int run_)
+      : value(value_)
+      , run(run_)
+    {
+    }
+
+    int value;
+    int run;
+  };
+
+  bool operator<(const Item& lhs, const Item& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  bool operator==(const Item& lhs, const Item& rhs)
+  {
+    return (lhs.value == rhs.value) && (lhs.run == rhs.run);
+  }
+
+  typedef std::vector<Item>::const_iterator             Iterator;
+  typedef std::pair<Iterator, Iterator>                 Range;
+  typedef etl::kway_merger<Iterator, 64>                Merger;
+
+  //*************************************************************************
+  std::vector<std::vector<Item> > make_runs(size_t n_runs, uint32_t seed)
+  {
+    std::vector<std::vector<Item> > runs(n_runs);
+
+    for (size_t r = 0U; r < n_runs; ++r)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+
+      const size_t size = (seed >> 16) % 50U;
+
+      for (size_t i = 0U; i < size; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        runs[r].push_back(Item(int((seed >> 16) % 40U), int(r)));
+      }
+
+      std::sort(runs[r].begin(), runs[r].end());
+    }
+
+    return runs;
+  }
+
+  //*************************************************************************
+  /// The expected result of a stable merge.
+  //*************************************************************************
+  std::vector<Item> expected_merge(const std::vector<std::vector<Item> >& runs)
+  {
+    std::vector<Item> expected;
+
+    for (size_t r = 0U; r < runs.size(); ++r)
+    {
+      expected.insert(expected.end(), runs[r].begin(), runs[r].end());
+    }
+
+    std::stable_sort(expected.begin(), expected.end());
+
+    return expected;
+  }
+
+  SUITE(test_kway_merge)
+  {
+    //*************************************************************************
+    TEST(test_merge_k)
+    {
+      for (size_t n_runs = 0U; n_runs <= 64U; ++n_runs)
+      {
+        std::vector<std::vector<Item> > runs = make_runs(n_runs, uint32_t(n_runs));
+        std::vector<Range>              ranges;
+
+        for (size_t r = 0U; r < runs.size(); ++r)
+        {
+          ranges.push_back(Range(runs[r].begin(), runs[r].end()));
+        }
+
+        std::vector<Item> result;
+        etl::merge_k<64>(ranges.begin(), ranges.end(), std::back_inserter(result));
+
+        CHECK(expected_merge(runs) == result);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_k_span_and_compare)
+    {
+      int run1[] = {9, 7, 7, 1};
+      int run2[] = {8, 7, 2};
+      int run3[] = {10, 0};
+
+      typedef std::pair<int*, int*> IntRange;
+
+      IntRange ranges[] = {IntRange(std::begin(run1), std::end(run1)), IntRange(std::begin(run2), std::end(run2)), IntRange(std::begin(run3), std::end(run3))};
+
+      int expected[] = {10, 9, 8, 7, 7, 7, 2, 1, 0};
+      int result[9];
+
+      int* end = etl::merge_k<3>(etl::span<IntRange>(ranges), result, std::greater<int>());
+
+      CHECK_EQUAL(9, std::distance(result, end));
+      CHECK_ARRAY_EQUAL(expected, result, 9);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_k_from_etl_containers)
+    {
+      etl::vector<int, 10>          vector1;
+      etl::vector<int, 10>          vector2;
+      etl::circular_buffer<int, 10> buffer1;
+
+      vector1.push_back(1);
+      vector1.push_back(4);
+      vector2.push_back(2);
+      vector2.push_back(5);
+
+      // The buffer wraps around.
+      for (int i = 0; i < 12; ++i)
+      {
+        buffer1.push(i - 9);
+      }
+
+      std::vector<int> result;
+
+      etl::kway_merger<etl::circular_buffer<int, 10>::const_iterator, 1> merger1;
+      merger1.add_run(buffer1.cbegin(), buffer1.cend());
+
+      std::vector<int> from_buffer;
+      merger1.merge(std::back_inserter(from_buffer));
+      from_buffer.erase(std::remove_if(from_buffer.begin(), from_buffer.end(), [](int i) { return (i < 0) || (i > 2); }), from_buffer.end());
+
+      typedef std::pair<const int*, const int*> IntRange;
+
+      IntRange ranges[] = {IntRange(vector1.data(), vector1.data() + vector1.size()), IntRange(vector2.data(), vector2.data() + vector2.size()),
+                           IntRange(from_buffer.data(), from_buffer.data() + from_buffer.size())};
+
+      etl::merge_k<4>(std::begin(ranges), std::end(ranges), std::back_inserter(result));
+
+      std::vector<int> expected = {0, 1, 1, 2, 2, 4, 5};
+
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(test_kway_merger_front_pop)
+    {
+      std::vector<std::vector<Item> > runs = make_runs(10U, 99U);
+      Merger                          merger;
+
+      for (size_t r = 0U; r < runs.size(); ++r)
+      {
+        merger.add_run(runs[r].begin(), runs[r].end());
+      }
+
+      std::vector<Item> result;
+
+      while (!merger.empty())
+      {
+        result.push_back(merger.front());
+        merger.pop();
+      }
+
+      CHECK(expected_merge(runs) == result);
+      CHECK_EQUAL(0U, merger.size());
+    }
+
+    //*************************************************************************
+    TEST(test_kway_merger_add_runs_while_merging)
+    {
+      // Runs arrive over time and overlap the few runs before them.
+      // Enough elements are held back that each new run only holds values
+      // that are not less than those already merged.
+      std::vector<std::vector<int> > runs(200U);
+      std::vector<int>               expected;
+      std::vector<int>               result;
+
+      etl::kway_merger<std::vector<int>::const_iterator, 8> merger;
+
+      for (size_t r = 0U; r < runs.size(); ++r)
+      {
+        for (int i = 0; i < 5; ++i)
+        {
+          runs[r].push_back(int(2U * r) + (i * 3));
+        }
+
+        expected.insert(expected.end(), runs[r].begin(), runs[r].end());
+
+        merger.add_run(runs[r].begin(), runs[r].end());
+        CHECK(merger.size() <= 8U);
+
+        if (r >= 3U)
+        {
+          merger.merge(std::back_inserter(result), 5U);
+        }
+      }
+
+      merger.merge(std::back_inserter(result));
+
+      std::sort(expected.begin(), expected.end());
+
+      CHECK(merger.empty());
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(test_kway_merger_full)
+    {
+      int run1[] = {1, 2, 3};
+      int run2[] = {4, 5, 6};
+
+      etl::kway_merger<int*, 2> merger;
+
+      CHECK_EQUAL(2U, merger.max_size());
+
+      merger.add_run(std::begin(run1), std::end(run1));
+      merger.add_run(std::begin(run2), std::end(run2));
+      CHECK(merger.full());
+
+      CHECK_THROW(merger.add_run(std::begin(run1), std::end(run1)), etl::kway_merger_full);
+
+      // Empty runs are ignored.
+      merger.add_run(std::begin(run1), std::begin(run1));
+
+      // A used up run makes space for a new one.
+      merger.pop();
+      merger.pop();
+      merger.pop();
+      CHECK_EQUAL(1U, merger.size());
+      CHECK(!merger.full());
+
+      merger.add_run(std::begin(run1) + 1, std::end(run1));
+      CHECK_EQUAL(2U, merger.size());
+
+      int expected[] = {2, 3, 4, 5, 6};
+      int result[5];
+      CHECK_EQUAL(5, std::distance(result, merger.merge(result)));
+      CHECK_ARRAY_EQUAL(expected, result, 5);
+    }
+
+    //*************************************************************************
+    TEST(test_kway_merger_clear)
+    {
+      int run[] = {1, 2, 3};
+
+      etl::kway_merger<int*, 4> merger;
+
+      CHECK(merger.empty());
+
+      merger.add_run(std::begin(run), std::end(run));
+      CHECK(!merger.empty());
+      CHECK_EQUAL(1, merger.front());
+
+      merger.clear();
+      CHECK(merger.empty());
+      CHECK_EQUAL(0U, merger.size());
+    }
+  }
+} // namespace
@@ -36,6 +36,8 @@ SOFTWARE.
 #include <array>
 #include <functional>
 #include <list>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace
@@ -1464,6 +1466,39 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_sort_large_is_stable)
+    {
+      typedef etl::list<ItemNDC, 1000> Data;
+
+      std::unique_ptr<Data> data(new Data);
+      CompareData           compare_data;
+      uint32_t              seed = 12345U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        ItemNDC item(std::to_string((seed >> 16) % 50U), i);
+
+        data->push_back(item);
+        compare_data.push_back(item);
+      }
+
+      compare_data.sort();
+      data->sort();
+
+      CHECK_EQUAL(compare_data.size(), data->size());
+      CHECK(std::equal(data->begin(), data->end(), compare_data.begin(), ItemNDC::are_identical));
+
+      // The previous links are intact.
+      CHECK(std::equal(data->rbegin(), data->rend(), compare_data.rbegin(), ItemNDC::are_identical));
+
+      data->sort(std::greater<ItemNDC>());
+      compare_data.sort(std::greater<ItemNDC>());
+
+      CHECK(std::equal(data->begin(), data->end(), compare_data.begin(), ItemNDC::are_identical));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_sort_trivial)
     {
@@ -1649,5 +1649,122 @@ namespace
 
       } while (std::next_permutation(permutation.begin(), permutation.end()));
     }
+
+    //*************************************************************************
+    TEST(test_construct_sorted_unique)
+    {
+      std::vector<std::pair<int, int>> sorted;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sorted.push_back(std::make_pair(i * 2, i));
+      }
+
+      etl::map<int, int, 100> data(etl::sorted_unique_t(), sorted.begin(), sorted.end());
+      std::map<int, int>      compare(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+      // The tree must still balance correctly after being built.
+      for (int i = 0; i < 100; i += 3)
+      {
+        data.erase(i * 2);
+        compare.erase(i * 2);
+      }
+
+      for (int i = 0; i < 33; ++i)
+      {
+        data.insert(std::make_pair((i * 6) + 1, i));
+        compare.insert(std::make_pair((i * 6) + 1, i));
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_sorted_unique)
+    {
+      std::vector<std::pair<int, int>> sorted;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        sorted.push_back(std::make_pair(i, i * 10));
+      }
+
+      etl::map<int, int, 10> data;
+      data[50] = 50;
+
+      data.assign(etl::sorted_unique_t(), sorted.begin(), sorted.end());
+
+      std::map<int, int> compare(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(10U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted)
+    {
+      etl::map<int, int, 100> data;
+      std::map<int, int>      compare;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(std::make_pair(i * 2, i));
+        compare.insert(std::make_pair(i * 2, i));
+      }
+
+      // Interleaved, overlapping, with a run past the end and a repeated key.
+      std::vector<std::pair<int, int>> batch;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        batch.push_back(std::make_pair(i + 20, -i));
+      }
+
+      batch.insert(batch.begin() + 10, batch[10]);
+
+      data.insert_sorted(batch.begin(), batch.end());
+      compare.insert(batch.begin(), batch.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+      for (int i = 0; i < 70; i += 2)
+      {
+        CHECK_EQUAL(compare.erase(i), data.erase(i));
+      }
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      etl::map<int, int, 10> data;
+      data[1] = 1;
+      data[3] = 3;
+
+      std::vector<std::pair<int, int>> batch;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        batch.push_back(std::make_pair(i, i));
+      }
+
+      CHECK_THROW(data.insert_sorted(batch.begin(), batch.end()), etl::map_full);
+
+      // The values before the overflow are kept and the map remains valid.
+      CHECK(data.full());
+      CHECK_EQUAL(0, data.begin()->first);
+      CHECK_EQUAL(9, data.rbegin()->first);
+      CHECK_EQUAL(1U, data.erase(5));
+      CHECK(data.insert(std::make_pair(15, 15)).second);
+    }
   }
 } // namespace
@@ -1691,5 +1691,72 @@ namespace
 
       } while (std::next_permutation(permutation.begin(), permutation.end()));
     }
+
+    //*************************************************************************
+    TEST(test_construct_sorted_equivalent)
+    {
+      std::vector<std::pair<int, int>> sorted;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sorted.push_back(std::make_pair(i / 3, i));
+      }
+
+      etl::multimap<int, int, 100> data(etl::sorted_equivalent_t(), sorted.begin(), sorted.end());
+      std::multimap<int, int>      compare(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK_EQUAL(3U, data.count(10));
+
+      // The tree must still balance correctly after being built.
+      for (int i = 0; i < 33; i += 2)
+      {
+        data.erase(i);
+        compare.erase(i);
+      }
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(std::make_pair(i * 5, i));
+        compare.insert(std::make_pair(i * 5, i));
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted)
+    {
+      std::vector<std::pair<int, int>> sorted;
+      sorted.push_back(std::make_pair(1, 10));
+      sorted.push_back(std::make_pair(2, 20));
+      sorted.push_back(std::make_pair(2, 21));
+      sorted.push_back(std::make_pair(7, 70));
+
+      etl::multimap<int, int, 10> data;
+      std::multimap<int, int>     compare;
+
+      data.insert(std::make_pair(2, 0));
+      data.insert(std::make_pair(7, 0));
+      compare.insert(std::make_pair(2, 0));
+      compare.insert(std::make_pair(7, 0));
+
+      data.insert_sorted(sorted.begin(), sorted.end());
+      compare.insert(sorted.begin(), sorted.end());
+
+      // New values follow the existing equivalent values.
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      data.assign(etl::sorted_equivalent_t(), sorted.begin(), sorted.end());
+      CHECK_EQUAL(4U, data.size());
+
+      data.insert_sorted(sorted.begin(), sorted.end());
+      CHECK_THROW(data.insert_sorted(sorted.begin(), sorted.end()), etl::multimap_full);
+      CHECK(data.full());
+    }
   }
 } // namespace
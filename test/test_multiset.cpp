@@ -1396,9 +1396,13 @@ namespace
         if ((compare.lower_bound(i) == compare.end()) == (data.lower_bound(i) == data.end()))
         {
           // if both are not end
-          if ((data.lower_bound(i) != data.end()) && (compare.lower_bound(i) != compare.end()))
+          // Dereference the iterator that was tested, so that GCC can see that it is
+          // not end() at -O1.
+          auto data_itr = data.lower_bound(i);
+
+          if ((data_itr != data.end()) && (compare.lower_bound(i) != compare.end()))
           {
-            CHECK((*compare.lower_bound(i)) == (*data.lower_bound(i)));
+            CHECK((*compare.lower_bound(i)) == (*data_itr));
           }
 
           ETL_OR_STD::pair<Compare_Data::const_iterator, Compare_Data::const_iterator> stlret = compare.equal_range(i);
@@ -1422,9 +1426,13 @@ namespace
         if ((compare.upper_bound(i) == compare.end()) == (data.upper_bound(i) == data.end()))
         {
           // if both are not end
-          if ((data.upper_bound(i) != data.end()) && (compare.upper_bound(i) != compare.end()))
+          // Dereference the iterator that was tested, so that GCC can see that it is
+          // not end() at -O1.
+          auto data_itr = data.upper_bound(i);
+
+          if ((data_itr != data.end()) && (compare.upper_bound(i) != compare.end()))
           {
-            CHECK((*compare.upper_bound(i)) == (*data.upper_bound(i)));
+            CHECK((*compare.upper_bound(i)) == (*data_itr));
           }
         }
       }
@@ -1458,9 +1466,13 @@ namespace
         if ((compare.lower_bound(i) == compare.end()) == (data.lower_bound(i) == data.end()))
         {
           // if both are not end
-          if ((data.lower_bound(i) != data.end()) && (compare.lower_bound(i) != compare.end()))
+          // Dereference the iterator that was tested, so that GCC can see that it is
+          // not end() at -O1.
+          auto data_itr = data.lower_bound(i);
+
+          if ((data_itr != data.end()) && (compare.lower_bound(i) != compare.end()))
           {
-            CHECK((*compare.lower_bound(i)) == (*data.lower_bound(i)));
+            CHECK((*compare.lower_bound(i)) == (*data_itr));
           }
 
           ETL_OR_STD::pair<CSet::const_iterator, CSet::const_iterator> stlret = compare.equal_range(i);
@@ -1484,9 +1496,13 @@ namespace
         if ((compare.upper_bound(i) == compare.end()) == (data.upper_bound(i) == data.end()))
         {
           // if both are not end
-          if ((data.upper_bound(i) != data.end()) && (compare.upper_bound(i) != compare.end()))
+          // Dereference the iterator that was tested, so that GCC can see that it is
+          // not end() at -O1.
+          auto data_itr = data.upper_bound(i);
+
+          if ((data_itr != data.end()) && (compare.upper_bound(i) != compare.end()))
           {
-            CHECK((*compare.upper_bound(i)) == (*data.upper_bound(i)));
+            CHECK((*compare.upper_bound(i)) == (*data_itr));
           }
         }
       }
@@ -1629,5 +1645,68 @@ namespace
 
       } while (std::next_permutation(permutation.begin(), permutation.end()));
     }
+
+    //*************************************************************************
+    TEST(test_construct_sorted_equivalent)
+    {
+      std::vector<int> sorted;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sorted.push_back(i / 3);
+      }
+
+      etl::multiset<int, 100> data(etl::sorted_equivalent_t(), sorted.begin(), sorted.end());
+      std::multiset<int>      compare(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK_EQUAL(3U, data.count(10));
+
+      // The tree must still balance correctly after being built.
+      for (int i = 0; i < 33; i += 2)
+      {
+        data.erase(i);
+        compare.erase(i);
+      }
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(i * 5);
+        compare.insert(i * 5);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted)
+    {
+      const int sorted[] = {1, 2, 2, 3, 7, 7, 7, 9};
+
+      etl::multiset<int, 20> data;
+      std::multiset<int>     compare;
+
+      data.insert(2);
+      data.insert(7);
+      compare.insert(2);
+      compare.insert(7);
+
+      data.insert_sorted(std::begin(sorted), std::end(sorted));
+      compare.insert(std::begin(sorted), std::end(sorted));
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK_EQUAL(4U, data.count(7));
+
+      data.assign(etl::sorted_equivalent_t(), std::begin(sorted), std::end(sorted));
+      CHECK(std::equal(data.begin(), data.end(), std::begin(sorted)));
+
+      data.insert_sorted(std::begin(sorted), std::end(sorted));
+      CHECK_THROW(data.insert_sorted(std::begin(sorted), std::end(sorted)), etl::multiset_full);
+      CHECK(data.full());
+    }
   }
 } // namespace
@@ -142,5 +142,34 @@ namespace
       CHECK_EQUAL(hash1, hash2);
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_range_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 7U) + 3U);
+      }
+
+      // Pointer ranges may be added in blocks.
+      for (size_t first = 0U; first < 4U; ++first)
+      {
+        for (size_t length = 0U; length < (data.size() - first); length += 61U)
+        {
+          const uint8_t* begin = data.data() + first;
+
+          etl::parity_checksum<uint8_t> calculator;
+
+          for (size_t i = 0U; i < length; ++i)
+          {
+            calculator.add(begin[i]);
+          }
+
+          CHECK_EQUAL(int(calculator.value()), int(etl::parity_checksum<uint8_t>(begin, begin + length).value()));
+        }
+      }
+    }
   }
 } // namespace
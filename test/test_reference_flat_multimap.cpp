@@ -336,6 +336,63 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_with_existing)
+    {
+      typedef ETL_OR_STD::pair<const int, int> Element;
+
+      std::vector<Element> values;
+      uint32_t             seed = 12345U;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        values.push_back(Element(int((seed >> 16) % 50U), i));
+      }
+
+      etl::reference_flat_multimap<int, int, 200> data;
+      std::multimap<int, int>                     compare_data;
+
+      for (size_t batch = 0U; batch < 10U; ++batch)
+      {
+        data.insert(values.begin() + int(batch * 20U), values.begin() + int((batch + 1U) * 20U));
+        compare_data.insert(values.begin() + int(batch * 20U), values.begin() + int((batch + 1U) * 20U));
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      // Equivalent values are referenced in the order in which they were inserted.
+      for (etl::reference_flat_multimap<int, int, 200>::iterator itr = data.begin(); std::next(itr) != data.end(); ++itr)
+      {
+        if (!(itr->first < std::next(itr)->first))
+        {
+          CHECK(&*itr < &*std::next(itr));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_sorted_equivalent)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      std::vector<ElementNDC> sorted_data(compare_data.begin(), compare_data.end());
+
+      DataNDC data(etl::sorted_equivalent_t(), sorted_data.begin(), sorted_data.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(&*data.begin() == &sorted_data.front());
+
+      data.assign(etl::sorted_equivalent_t(), sorted_data.begin(), sorted_data.begin() + 3);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      CHECK_THROW(data.assign(etl::sorted_equivalent_t(), excess_data.begin(), excess_data.end()), etl::flat_multimap_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
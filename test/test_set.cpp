@@ -1442,5 +1442,97 @@ namespace
 
       } while (std::next_permutation(permutation.begin(), permutation.end()));
     }
+
+    //*************************************************************************
+    TEST(test_construct_sorted_unique)
+    {
+      std::vector<int> sorted;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sorted.push_back(i * 2);
+      }
+
+      etl::set<int, 100> data(etl::sorted_unique_t(), sorted.begin(), sorted.end());
+      std::set<int>      compare(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      // The tree must still balance correctly after being built.
+      for (int i = 0; i < 100; i += 3)
+      {
+        data.erase(i * 2);
+        compare.erase(i * 2);
+      }
+
+      for (int i = 0; i < 33; ++i)
+      {
+        data.insert((i * 6) + 1);
+        compare.insert((i * 6) + 1);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_sorted_unique)
+    {
+      const int sorted[] = {1, 2, 3, 5, 8, 13};
+
+      etl::set<int, 10> data;
+      data.insert(4);
+
+      data.assign(etl::sorted_unique_t(), std::begin(sorted), std::end(sorted));
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), std::begin(sorted)));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted)
+    {
+      etl::set<int, 100> data;
+      std::set<int>      compare;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(i * 2);
+        compare.insert(i * 2);
+      }
+
+      std::vector<int> batch;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        batch.push_back(i + 20);
+      }
+
+      batch.insert(batch.begin() + 10, batch[10]);
+
+      data.insert_sorted(batch.begin(), batch.end());
+      compare.insert(batch.begin(), batch.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      const int sorted[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+      etl::set<int, 10> data;
+      data.insert(3);
+
+      CHECK_THROW(data.insert_sorted(std::begin(sorted), std::end(sorted)), etl::set_full);
+
+      CHECK(data.full());
+      CHECK_EQUAL(0, *data.begin());
+      CHECK_EQUAL(9, *data.rbegin());
+    }
   }
 } // namespace
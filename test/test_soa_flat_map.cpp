@@ -0,0 +1,347 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/soa_flat_map.h"
+
+namespace
+{
+  using Data         = etl::soa_flat_map<int, std::string, 100>;
+  using IData        = etl::isoa_flat_map<int, std::string>;
+  using Compare_Data = std::map<int, std::string>;
+
+  using ItemM = TestDataM<int>;
+  using DataM = etl::soa_flat_map<int, ItemM, 10>;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(const T1& data, const T2& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    typename T1::const_iterator itr = data.begin();
+
+    for (typename T2::const_iterator c = compare.begin(); c != compare.end(); ++c, ++itr)
+    {
+      if ((itr->first != c->first) || (itr->second != c->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_soa_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Data data;
+
+      CHECK(data.insert(std::make_pair(2, std::string("2"))).second);
+      CHECK(data.insert(std::make_pair(1, std::string("1"))).second);
+      CHECK(!data.insert(std::make_pair(2, std::string("X"))).second);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("1"), data.find(1)->second);
+      CHECK_EQUAL(std::string("2"), data.at(2));
+      CHECK(data.find(3) == data.end());
+      CHECK(data.contains(2));
+      CHECK_EQUAL(1U, data.count(1));
+
+      // The keys and values are held in parallel arrays.
+      CHECK_EQUAL(1, data.keys()[0]);
+      CHECK_EQUAL(std::string("2"), data.values()[1]);
+
+      CHECK_EQUAL(1U, data.erase(1));
+      CHECK_EQUAL(0U, data.erase(1));
+      CHECK_EQUAL(1U, data.size());
+      CHECK_THROW(data.at(1), etl::soa_flat_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data[5] = "5";
+      data[3] = "3";
+      data[5] += "5";
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("55"), data[5]);
+      CHECK_EQUAL(std::string(""), data[4]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      etl::soa_flat_map<int, int, 4> data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      CHECK(data.full());
+      CHECK(!data.insert(std::make_pair(2, 2)).second);
+      CHECK_THROW(data.insert(std::make_pair(5, 5)), etl::soa_flat_map_full);
+      CHECK_THROW(data[6], etl::soa_flat_map_full);
+      CHECK_THROW(data.emplace(7, 7), etl::soa_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_against_reference)
+    {
+      Data         data;
+      Compare_Data compare;
+      uint32_t     seed = 13579U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed          = (seed * 1103515245U) + 12345U;
+        const int key = int((seed >> 8) % 150U);
+
+        if (((seed >> 4) & 1U) == 0U)
+        {
+          if ((compare.size() < data.max_size()) || (compare.count(key) != 0U))
+          {
+            CHECK_EQUAL(compare.insert(std::make_pair(key, std::to_string(i))).second, data.insert(std::make_pair(key, std::to_string(i))).second);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+
+      for (int key = -1; key <= 150; ++key)
+      {
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+
+        ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(key);
+        CHECK_EQUAL(compare.count(key), size_t(range.second - range.first));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data data = {{3, "3"}, {1, "1"}, {2, "2"}};
+
+      Data::iterator itr = data.begin();
+      CHECK_EQUAL(1, (*itr).first);
+      CHECK_EQUAL(std::string("2"), itr[1].second);
+
+      itr += 2;
+      CHECK_EQUAL(3, itr->first);
+      CHECK(itr - data.begin() == 2);
+      CHECK(data.begin() < itr);
+
+      itr->second = "three";
+      CHECK_EQUAL(std::string("three"), data.at(3));
+
+      Data::const_iterator citr = itr;
+      CHECK(citr == itr);
+
+      Data::reverse_iterator ritr = data.rbegin();
+      CHECK_EQUAL(3, (*ritr).first);
+      ++ritr;
+      CHECK_EQUAL(2, (*ritr).first);
+
+      ETL_OR_STD::pair<int, std::string> copy = *data.begin();
+      CHECK_EQUAL(1, copy.first);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_and_range)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      Data::iterator itr = data.erase(data.find(10));
+      CHECK_EQUAL(11, itr->first);
+
+      itr = data.erase(data.find(20), data.find(80));
+      CHECK_EQUAL(80, itr->first);
+      CHECK_EQUAL(39U, data.size());
+      CHECK_EQUAL(std::string("81"), data.at(81));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_compare)
+    {
+      Data data = {{3, "3"}, {1, "1"}, {2, "2"}};
+      Data copy(data);
+
+      CHECK(copy == data);
+
+      IData& icopy = copy;
+      icopy[4]     = "4";
+      CHECK(copy != data);
+
+      icopy = data;
+      CHECK(copy == data);
+
+      Data moved(std::move(copy));
+      CHECK(moved == data);
+      CHECK(copy.empty());
+
+      auto made = etl::make_soa_flat_map<int, std::string>(std::make_pair(5, std::string("5")), std::make_pair(4, std::string("4")));
+      CHECK_EQUAL(2U, made.max_size());
+      CHECK_EQUAL(4, made.begin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_move_only)
+    {
+      DataM data;
+
+      data.emplace(2, 20);
+      data.emplace(1, 10);
+      data.insert(std::make_pair(3, ItemM(30)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1).value);
+      CHECK_EQUAL(30, data.at(3).value);
+
+      data.erase(1);
+      CHECK_EQUAL(20, data.begin()->second.value);
+      CHECK(data.begin()->second.valid);
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      etl::soa_flat_map<std::string, int, 10, etl::less<>> data;
+
+      data["b"] = 2;
+      data["a"] = 1;
+
+      CHECK_EQUAL(1, data.at("a"));
+      CHECK(data.contains("b"));
+      CHECK_EQUAL(1U, data.erase("a"));
+      CHECK(data.find("a") == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      using Map_Ext = etl::soa_flat_map_ext<int, std::string>;
+
+      etl::uninitialized_buffer_of<int, 20>         keys;
+      etl::uninitialized_buffer_of<std::string, 20> values;
+
+      Map_Ext data(keys.begin(), values.begin(), 20U);
+
+      for (int i = 20; i > 0; --i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(1, data.begin()->first);
+      CHECK_EQUAL(std::string("20"), data.rbegin()->second);
+      CHECK_THROW(data[21], etl::soa_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_sorted_unique)
+    {
+      Compare_Data compare;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        compare[i * 3] = std::to_string(i);
+      }
+
+      Data data(etl::sorted_unique_t(), compare.begin(), compare.end());
+
+      CHECK(Check_Equal(data, compare));
+
+      etl::soa_flat_map<int, std::string, 10> small;
+
+      CHECK_THROW(small.assign(etl::sorted_unique_t(), compare.begin(), compare.end()), etl::soa_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_ext_adopt_sorted_buffers)
+    {
+      using Map_Ext = etl::soa_flat_map_ext<int, std::string>;
+
+      etl::uninitialized_buffer_of<int, 20>         keys;
+      etl::uninitialized_buffer_of<std::string, 20> values;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        ::new (keys.begin() + i) int(i * 2);
+        ::new (values.begin() + i) std::string(std::to_string(i * 2));
+      }
+
+      Map_Ext data(etl::sorted_unique_t(), keys.begin(), values.begin(), 10U, 20U);
+
+      CHECK_EQUAL(10U, data.size());
+      CHECK(&data.keys()[0] == keys.begin());
+      CHECK_EQUAL(std::string("8"), data.at(8));
+
+      data.insert(std::make_pair(5, std::string("5")));
+      CHECK_EQUAL(11U, data.size());
+      CHECK_EQUAL(5, data.keys()[3]);
+    }
+  }
+} // namespace
@@ -3815,6 +3815,45 @@ namespace
       CHECK_EQUAL(TextL::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_rfind_repetitive_text)
+    {
+      TextSTD compare_haystack;
+
+      for (size_t i = 0UL; i < 20UL; ++i)
+      {
+        compare_haystack.append(i * 5UL, STR('a'));
+        compare_haystack.push_back(STR('b'));
+      }
+
+      etl::string<1000> haystack(compare_haystack.c_str());
+
+      for (size_t length = 1UL; length < 100UL; length += 7UL)
+      {
+        TextSTD needle(length, STR('a'));
+        needle.push_back(STR('b'));
+
+        CHECK_EQUAL(compare_haystack.find(needle), haystack.find(needle.c_str()));
+        CHECK_EQUAL(compare_haystack.find(needle, 10UL), haystack.find(needle.c_str(), 10UL));
+        CHECK_EQUAL(compare_haystack.find(needle, 500UL), haystack.find(needle.c_str(), 500UL));
+        CHECK_EQUAL(compare_haystack.rfind(needle), haystack.rfind(needle.c_str()));
+
+        // etl::string::rfind finds the last match that ends at or before the position.
+        CHECK_EQUAL(compare_haystack.rfind(needle, 600UL - needle.size()), haystack.rfind(needle.c_str(), 600UL));
+      }
+
+      TextSTD periodic_needle;
+
+      for (size_t i = 0UL; i < 8UL; ++i)
+      {
+        periodic_needle.append(5UL, STR('a'));
+        periodic_needle.push_back(STR('b'));
+      }
+
+      CHECK_EQUAL(compare_haystack.find(periodic_needle), haystack.find(periodic_needle.c_str()));
+      CHECK_EQUAL(compare_haystack.rfind(periodic_needle), haystack.rfind(periodic_needle.c_str()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_contains_string)
     {
@@ -4583,6 +4622,29 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_of_all_character_values)
+    {
+      TextSTD compare_text;
+
+      for (int i = 255; i > 0; --i)
+      {
+        compare_text.push_back(static_cast<value_t>(i));
+      }
+
+      etl::string<255> text(compare_text.c_str());
+
+      const value_t characters[] = {static_cast<value_t>(0x80), static_cast<value_t>(0xFF), static_cast<value_t>(0x01), static_cast<value_t>(0x7F), 0};
+
+      for (size_t position = 0UL; position < text.size(); position += 17UL)
+      {
+        CHECK_EQUAL(compare_text.find_first_of(characters, position), text.find_first_of(characters, position));
+        CHECK_EQUAL(compare_text.find_last_of(characters, position), text.find_last_of(characters, position));
+        CHECK_EQUAL(compare_text.find_first_not_of(characters, position), text.find_first_not_of(characters, position));
+        CHECK_EQUAL(compare_text.find_last_not_of(characters, position), text.find_last_not_of(characters, position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_last_of_string_position)
     {
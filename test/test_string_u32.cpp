@@ -4655,6 +4655,25 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_of_wide_characters)
+    {
+      const value_t the_text[] = STR("a\u00E9b\u1234c\U0001F600d\u00E9\u1234");
+
+      TextSTD compare_text(the_text);
+      TextL   text(the_text);
+
+      const value_t* characters = STR("\U0001F600\u1234z");
+
+      for (size_t position = 0UL; position <= text.size(); ++position)
+      {
+        CHECK_EQUAL(compare_text.find_first_of(characters, position), text.find_first_of(characters, position));
+        CHECK_EQUAL(compare_text.find_last_of(characters, position), text.find_last_of(characters, position));
+        CHECK_EQUAL(compare_text.find_first_not_of(characters, position), text.find_first_not_of(characters, position));
+        CHECK_EQUAL(compare_text.find_last_not_of(characters, position), text.find_last_not_of(characters, position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_last_of_string_position)
     {
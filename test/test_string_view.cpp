@@ -881,6 +881,76 @@ namespace
       CHECK(View::npos == view.rfind(s4, 0, 11));
     }
 
+    //*************************************************************************
+    TEST(test_find_rfind_repetitive_text)
+    {
+      std::string compare_text;
+
+      for (size_t i = 0U; i < 20U; ++i)
+      {
+        compare_text.append(i * 5U, 'a');
+        compare_text.push_back('b');
+      }
+
+      View view(compare_text.data(), compare_text.size());
+
+      for (size_t length = 1U; length < 100U; length += 7U)
+      {
+        std::string needle(length, 'a');
+        needle.push_back('b');
+
+        View needle_view(needle.data(), needle.size());
+
+        CHECK_EQUAL(compare_text.find(needle), view.find(needle_view));
+        CHECK_EQUAL(compare_text.find(needle, 500U), view.find(needle_view, 500U));
+        CHECK_EQUAL(compare_text.rfind(needle), view.rfind(needle_view));
+      }
+
+      CHECK_EQUAL(View::npos, view.find("b", view.size() + 1U));
+      CHECK_EQUAL(View::npos, view.rfind("bb", 5U));
+    }
+
+    //*************************************************************************
+    TEST(test_find_rfind_match_just_outside_view)
+    {
+      // The view is not null terminated and sits inside a larger buffer, with
+      // the character that would complete each match just outside it.
+      std::string buffer(202U, 'a');
+      buffer[0U]   = 'b';
+      buffer[201U] = 'b';
+
+      View view(buffer.data() + 1U, 200U);
+
+      std::string find_needle(20U, 'a');
+      find_needle.push_back('b');
+
+      std::string rfind_needle(1U, 'b');
+      rfind_needle.append(20U, 'a');
+
+      CHECK_EQUAL(View::npos, view.find(View(find_needle.data(), find_needle.size())));
+      CHECK_EQUAL(View::npos, view.rfind(View(rfind_needle.data(), rfind_needle.size())));
+      CHECK_EQUAL(0U, view.find(View(find_needle.data(), 20U)));
+      CHECK_EQUAL(180U, view.rfind(View(rfind_needle.data() + 1U, 20U)));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr_find)
+    {
+      constexpr View view("aaaabaaaaaaaaab, xyz");
+
+      constexpr size_t position1 = view.find("aaaaaaaaab");
+      constexpr size_t position2 = view.rfind("aaab");
+      constexpr size_t position3 = view.find_first_of(",z");
+      constexpr size_t position4 = view.find_last_not_of("xyz");
+
+      CHECK_EQUAL(5U, position1);
+      CHECK_EQUAL(11U, position2);
+      CHECK_EQUAL(15U, position3);
+      CHECK_EQUAL(16U, position4);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_find_first_of)
     {
@@ -0,0 +1,639 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/unordered_flat_map.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), size_t(0));
+    }
+  };
+
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator()(const char* s) const
+    {
+      size_t sum    = 0U;
+      size_t length = etl::strlen(s);
+
+      return std::accumulate(s, s + length, sum);
+    }
+
+    size_t operator()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), size_t(0));
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct colliding_hash
+  {
+    size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  using DC  = TestDataDC<std::string>;
+  using NDC = TestDataNDC<std::string>;
+
+  using ElementNDC = ETL_OR_STD::pair<std::string, NDC>;
+
+  SUITE(test_unordered_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    using DataNDC            = etl::unordered_flat_map<std::string, NDC, SIZE, SIZE + 2, simple_hash>;
+    using DataDC             = etl::unordered_flat_map<std::string, DC, SIZE, SIZE + 2, simple_hash>;
+    using IDataNDC           = etl::iunordered_flat_map<std::string, NDC, simple_hash>;
+    using DataNDCTransparent = etl::unordered_flat_map<std::string, NDC, SIZE, SIZE + 2, transparent_hash, etl::equal_to<>>;
+    using DataInt            = etl::unordered_flat_map<int, int, 100>;
+    using DataIntExt         = etl::unordered_flat_map_ext<int, int>;
+
+    NDC N0 = NDC("A");
+    NDC N1 = NDC("B");
+    NDC N2 = NDC("C");
+    NDC N3 = NDC("D");
+    NDC N4 = NDC("E");
+    NDC N5 = NDC("F");
+    NDC N6 = NDC("G");
+    NDC N7 = NDC("H");
+    NDC N8 = NDC("I");
+    NDC N9 = NDC("J");
+
+    std::string K0 = "FF";
+    std::string K1 = "FG";
+    std::string K2 = "FH";
+    std::string K3 = "FI";
+    std::string K4 = "FJ";
+    std::string K5 = "FK";
+    std::string K6 = "FL";
+    std::string K7 = "FM";
+    std::string K8 = "FN";
+    std::string K9 = "FO";
+    std::string K10 = "FP";
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] = {ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+                          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9)};
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n), std::end(n));
+        excess_data.push_back(ElementNDC(K10, N0));
+      }
+    };
+
+    //*************************************************************************
+    template <typename TMap, typename TReference>
+    bool is_equal(const TMap& data, const TReference& reference)
+    {
+      if (data.size() != reference.size())
+      {
+        return false;
+      }
+
+      size_t n = 0U;
+
+      for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        typename TReference::const_iterator ref = reference.find(itr->first);
+
+        if ((ref == reference.end()) || (ref->second != itr->second))
+        {
+          return false;
+        }
+
+        ++n;
+      }
+
+      return n == reference.size();
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(data.size(), size_t(0));
+      CHECK(data.empty());
+      CHECK_EQUAL(data.max_size(), SIZE);
+      CHECK_EQUAL(data.bucket_count(), SIZE + 2);
+      CHECK(data.begin() == data.end());
+    }
+
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_cpp17_deduced_constructor)
+    {
+      etl::unordered_flat_map data{ETL_OR_STD::pair<int, int>{0, 1}, ETL_OR_STD::pair<int, int>{2, 3}, ETL_OR_STD::pair<int, int>{4, 5}};
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(1, data[0]);
+      CHECK_EQUAL(3, data[2]);
+      CHECK_EQUAL(5, data[4]);
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_make_unordered_flat_map)
+    {
+      auto data = etl::make_unordered_flat_map<int, int>(ETL_OR_STD::pair<int, int>{0, 1}, ETL_OR_STD::pair<int, int>{2, 3});
+
+      CHECK_EQUAL(2U, data.max_size());
+      CHECK_EQUAL(1, data.at(0));
+      CHECK_EQUAL(3, data.at(2));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(is_equal(data, std::map<std::string, NDC>(initial_data.begin(), initial_data.end())));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(data1);
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      using Item = TestDataM<int>;
+      using Data = etl::unordered_flat_map<int, Item, SIZE>;
+
+      Data data1;
+      data1.insert(ETL_OR_STD::make_pair(1, Item(1)));
+      data1.insert(ETL_OR_STD::make_pair(2, Item(2)));
+
+      Data data2(std::move(data1));
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.at(1).value);
+      CHECK_EQUAL(2, data2.at(2).value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_destruct_via_iunordered_flat_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+      CHECK_EQUAL(current_count + int(initial_data.size()), NDC::get_instance_count());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      data2 = data1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_assignment)
+    {
+      using Item = TestDataM<int>;
+      using Data = etl::unordered_flat_map<int, Item, SIZE>;
+
+      Data data1;
+      data1.insert(ETL_OR_STD::make_pair(1, Item(1)));
+      data1.insert(ETL_OR_STD::make_pair(2, Item(2)));
+
+      Data data2;
+      data2.insert(ETL_OR_STD::make_pair(3, Item(3)));
+
+      data2 = std::move(data1);
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.at(1).value);
+      CHECK_EQUAL(2, data2.at(2).value);
+      CHECK(!data2.contains(3));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      etl::unordered_flat_map<std::string, DC, SIZE, SIZE + 2, simple_hash> data;
+
+      data[K0] = DC("A");
+      data[K1] = DC("B");
+
+      CHECK(data[K0] == DC("A"));
+      CHECK(data[K1] == DC("B"));
+      CHECK_EQUAL(2U, data.size());
+
+      data[K0] = DC("C");
+      CHECK(data[K0] == DC("C"));
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC       data(initial_data.begin(), initial_data.end());
+      const DataNDC cdata(initial_data.begin(), initial_data.end());
+
+      CHECK(data.at(K0) == N0);
+      CHECK(data.at(K9) == N9);
+      CHECK(cdata.at(K5) == N5);
+      CHECK_THROW(data.at(K10), etl::unordered_flat_map_out_of_range);
+      CHECK_THROW(cdata.at(K10), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_transparent_lookup)
+    {
+      DataNDCTransparent data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.at("FF") == N0);
+      CHECK(data.contains("FJ"));
+      CHECK(!data.contains("ZZ"));
+      CHECK_EQUAL(1U, data.count("FG"));
+      CHECK(data.find("FH") != data.end());
+      CHECK_EQUAL(1U, data.erase("FH"));
+      CHECK(data.find("FH") == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(DataNDC::value_type(K0, N0));
+      CHECK(result.second);
+      CHECK(result.first->first == K0);
+      CHECK(result.first->second == N0);
+
+      result = data.insert(DataNDC::value_type(K0, N1));
+      CHECK(!result.second);
+      CHECK(result.first->second == N0);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(DataNDC::value_type(K10, N0)), etl::unordered_flat_map_full);
+
+      // Existing keys may still be found when full.
+      CHECK(!data.insert(DataNDC::value_type(K0, N1)).second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::unordered_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K5));
+      CHECK_EQUAL(0U, data.erase(K5));
+      CHECK_EQUAL(SIZE - 1, data.size());
+      CHECK(data.find(K5) == data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+      compare.erase(K5);
+
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single_iterator)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.find(K3);
+      data.erase(itr);
+
+      CHECK_EQUAL(SIZE - 1, data.size());
+      CHECK(!data.contains(K3));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_while_iterating)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i;
+      }
+
+      DataInt::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if ((itr->first % 2) == 0)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(50U, data.size());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(((i % 2) == 0) ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range_all)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.erase(data.cbegin(), data.cend());
+
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> result = data.equal_range(K2);
+      CHECK(result.first->first == K2);
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+
+      result = data.equal_range(K10);
+      CHECK(result.first == data.end());
+      CHECK(result.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(initial_data.rbegin(), initial_data.rend());
+
+      CHECK(data1 == data2);
+
+      data2.erase(K1);
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_load_factor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_CLOSE(float(SIZE) / float(SIZE + 2), data.load_factor(), 0.0001f);
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes)
+    {
+      etl::unordered_flat_map<int, int, 40, 40, colliding_hash> data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      for (int i = 0; i < 40; i += 3)
+      {
+        data.erase(i);
+      }
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL(((i % 3) == 0) ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase_against_reference)
+    {
+      DataInt            data;
+      std::map<int, int> compare;
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed      = (seed * 1103515245U) + 12345U;
+        int key   = int((seed >> 16) % 300U);
+        bool add  = ((seed >> 8) & 1U) == 0U;
+
+        if (add)
+        {
+          if (compare.find(key) != compare.end())
+          {
+            data[key]    = i;
+            compare[key] = i;
+          }
+          else if (!data.full())
+          {
+            data.insert(DataInt::value_type(key, i));
+            compare[key] = i;
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(is_equal(data, compare));
+
+      for (int key = 0; key < 300; ++key)
+      {
+        CHECK_EQUAL(compare.count(key), data.count(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      static const size_t Slots = 20U;
+
+      etl::uninitialized_buffer_of<DataIntExt::value_type, Slots> slot_buffer;
+      uint8_t control_buffer[etl::unordered_flat_map_control_size<Slots>::value];
+
+      DataIntExt data(slot_buffer, control_buffer, Slots);
+
+      CHECK_EQUAL(Slots, data.max_size());
+
+      for (int i = 0; i < int(Slots); ++i)
+      {
+        data[i] = -i;
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data[int(Slots)], etl::unordered_flat_map_full);
+
+      for (int i = 0; i < int(Slots); ++i)
+      {
+        CHECK_EQUAL(-i, data.at(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_portable_group)
+    {
+      using Group = etl::private_unordered_flat_map::portable_group<uint64_t>;
+      using Ctrl  = etl::private_unordered_flat_map::control;
+
+      uint8_t control[8] = {0x12, Ctrl::Empty, 0x05, Ctrl::Deleted, 0x12, Ctrl::Sentinel, 0x7F, Ctrl::Empty};
+
+      Group group(control);
+
+      Group::mask_type match = group.match(0x12);
+      CHECK(match.any());
+      CHECK_EQUAL(0U, match.lowest());
+      match.remove_lowest();
+      CHECK_EQUAL(4U, match.lowest());
+      match.remove_lowest();
+      CHECK(!match.any());
+
+      Group::mask_type empty = group.match_empty();
+      CHECK_EQUAL(1U, empty.lowest());
+      empty.remove_lowest();
+      CHECK_EQUAL(7U, empty.lowest());
+      empty.remove_lowest();
+      CHECK(!empty.any());
+
+      Group::mask_type empty_or_deleted = group.match_empty_or_deleted();
+      CHECK_EQUAL(1U, empty_or_deleted.lowest());
+      empty_or_deleted.remove_lowest();
+      CHECK_EQUAL(3U, empty_or_deleted.lowest());
+      empty_or_deleted.remove_lowest();
+      CHECK_EQUAL(7U, empty_or_deleted.lowest());
+
+      Group::mask_type full = group.match_full();
+      size_t           count = 0U;
+
+      while (full.any())
+      {
+        ++count;
+        full.remove_lowest();
+      }
+
+      CHECK_EQUAL(4U, count);
+    }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      DataInt data;
+      data[1] = 1;
+
+      CHECK(data.contains(1));
+      CHECK(!data.contains(2));
+    }
+  };
+} // namespace
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/hash.h"
+#include "etl/span.h"
 #include "etl/unordered_map.h"
 
 namespace
@@ -1416,5 +1417,173 @@ namespace
       CHECK_TRUE(data.contains("FF"));
       CHECK_FALSE(data.contains(not_inserted));
     }
+
+    //*************************************************************************
+    TEST(test_find_batch)
+    {
+      typedef etl::unordered_map<int, int, 64, 32> Data;
+
+      Data data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(std::make_pair(i, i * 10));
+      }
+
+      // More keys than are resolved in one batch, half of which are missing.
+      int keys[80];
+
+      for (int i = 0; i < 80; ++i)
+      {
+        keys[i] = (i * 37) % 80;
+      }
+
+      Data::iterator       results[80];
+      Data::const_iterator const_results[80];
+      const Data&          const_data = data;
+
+      data.find_batch(etl::span<const int>(keys), etl::span<Data::iterator>(results));
+      const_data.find_batch(etl::span<const int>(keys), etl::span<Data::const_iterator>(const_results));
+
+      for (int i = 0; i < 80; ++i)
+      {
+        CHECK(results[i] == data.find(keys[i]));
+        CHECK(const_results[i] == const_data.find(keys[i]));
+
+        if (keys[i] < 40)
+        {
+          CHECK_EQUAL(keys[i] * 10, results[i]->second);
+        }
+        else
+        {
+          CHECK(results[i] == data.end());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_contains_batch_count_batch)
+    {
+      typedef etl::unordered_map<int, int, 64, 32> Data;
+
+      Data data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(std::make_pair(i, i * 10));
+      }
+
+      int keys[50];
+
+      for (int i = 0; i < 50; ++i)
+      {
+        keys[i] = 49 - i;
+      }
+
+      bool   found[50];
+      size_t counts[50];
+
+      data.contains_batch(etl::span<const int>(keys), etl::span<bool>(found));
+      data.count_batch(etl::span<const int>(keys), etl::span<size_t>(counts));
+
+      for (int i = 0; i < 50; ++i)
+      {
+        CHECK_EQUAL(keys[i] < 40, found[i]);
+        CHECK_EQUAL(data.count(keys[i]), counts[i]);
+      }
+
+      CHECK_EQUAL(0U, counts[0]);  // 49
+      CHECK_EQUAL(1U, counts[46]); // 3
+    }
+
+    //*************************************************************************
+    TEST(test_find_batch_results_too_small)
+    {
+      typedef etl::unordered_map<int, int, 64, 32> Data;
+
+      Data data;
+
+      int  keys[4] = {1, 2, 3, 4};
+      bool found[3];
+
+      CHECK_THROW(data.contains_batch(etl::span<const int>(keys), etl::span<bool>(found)), etl::unordered_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_sparse_iteration_erase_and_clear)
+    {
+      typedef etl::unordered_map<int, int, 16, 4096> Data;
+
+      Data data;
+
+      const int keys[] = {4095, 3, 1500, 700, 4000, 2048};
+
+      for (size_t i = 0U; i < ETL_OR_STD17::size(keys); ++i)
+      {
+        data.insert(std::make_pair(keys[i], keys[i]));
+      }
+
+      // Iteration visits the occupied buckets in order.
+      std::vector<int> visited;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        visited.push_back(itr->first);
+      }
+
+      const int expected[] = {3, 700, 1500, 2048, 4000, 4095};
+      CHECK_EQUAL(ETL_OR_STD17::size(expected), visited.size());
+      CHECK_ARRAY_EQUAL(expected, visited.data(), visited.size());
+
+      // Sweep, erasing every other element.
+      bool erase = true;
+
+      for (Data::iterator itr = data.begin(); itr != data.end();)
+      {
+        itr   = erase ? data.erase(itr) : ++itr;
+        erase = !erase;
+      }
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(3U, size_t(std::distance(data.begin(), data.end())));
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      // The buckets are all free again.
+      for (size_t i = 0U; i < ETL_OR_STD17::size(keys); ++i)
+      {
+        data.insert(std::make_pair(keys[i], keys[i]));
+      }
+
+      CHECK_EQUAL(ETL_OR_STD17::size(keys), size_t(std::distance(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_from_last_bucket_leaving_a_node)
+    {
+      typedef etl::unordered_map<int, int, 8, 8> Data;
+
+      Data data;
+
+      // 7 and 15 share the last bucket.
+      data.insert(std::make_pair(1, 1));
+      data.insert(std::make_pair(7, 7));
+      data.insert(std::make_pair(15, 15));
+
+      data.erase(15);
+
+      std::vector<int> visited;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        visited.push_back(itr->first);
+      }
+
+      CHECK_EQUAL(2U, visited.size());
+      CHECK_EQUAL(1, visited[0]);
+      CHECK_EQUAL(7, visited[1]);
+    }
   }
 } // namespace
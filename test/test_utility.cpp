@@ -874,13 +874,17 @@ namespace
       using seq0    = etl::make_index_sequence<0U>;
       using seq1    = etl::make_index_sequence<1U>;
       using seq4    = etl::make_index_sequence<4U>;
+      using seq7    = etl::make_index_sequence<7U>;
       using expect0 = etl::index_sequence<>;
       using expect1 = etl::index_sequence<0U>;
       using expect4 = etl::index_sequence<0U, 1U, 2U, 3U>;
+      using expect7 = etl::index_sequence<0U, 1U, 2U, 3U, 4U, 5U, 6U>;
 
       CHECK_TRUE((std::is_same<seq0, expect0>::value));
       CHECK_TRUE((std::is_same<seq1, expect1>::value));
       CHECK_TRUE((std::is_same<seq4, expect4>::value));
+      CHECK_TRUE((std::is_same<seq7, expect7>::value));
+      CHECK_EQUAL(5000U, etl::make_index_sequence<5000U>::size());
     }
 
     //*********************************
@@ -0,0 +1,273 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the 'Software'), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <list>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "etl/wyhash.h"
+
+namespace
+{
+  //*************************************************************************
+  // The 'C' reference implementation, final version 4, default secret.
+  //*************************************************************************
+  void wymum(uint64_t* A, uint64_t* B)
+  {
+    uint64_t ha = *A >> 32, hb = *B >> 32, la = (uint32_t)*A, lb = (uint32_t)*B, hi, lo;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+    lo = t + (rm1 << 32);
+    c += lo < t;
+    hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *A = lo;
+    *B = hi;
+  }
+
+  uint64_t wymix(uint64_t A, uint64_t B)
+  {
+    wymum(&A, &B);
+    return A ^ B;
+  }
+
+  uint64_t wyr8(const uint8_t* p)
+  {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+  }
+
+  uint64_t wyr4(const uint8_t* p)
+  {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+  }
+
+  uint64_t wyr3(const uint8_t* p, size_t k)
+  {
+    return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+  }
+
+  uint64_t reference_wyhash(const void* key, size_t len, uint64_t seed)
+  {
+    static const uint64_t secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+    const uint8_t* p = (const uint8_t*)key;
+    seed ^= wymix(seed ^ secret[0], secret[1]);
+    uint64_t a, b;
+
+    if (len <= 16)
+    {
+      if (len >= 4)
+      {
+        a = (wyr4(p) << 32) | wyr4(p + ((len >> 3) << 2));
+        b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - ((len >> 3) << 2));
+      }
+      else if (len > 0)
+      {
+        a = wyr3(p, len);
+        b = 0;
+      }
+      else
+      {
+        a = b = 0;
+      }
+    }
+    else
+    {
+      size_t i = len;
+      if (i >= 48)
+      {
+        uint64_t see1 = seed, see2 = seed;
+        do
+        {
+          seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+          see1 = wymix(wyr8(p + 16) ^ secret[2], wyr8(p + 24) ^ see1);
+          see2 = wymix(wyr8(p + 32) ^ secret[3], wyr8(p + 40) ^ see2);
+          p += 48;
+          i -= 48;
+        } while (i >= 48);
+        seed ^= see1 ^ see2;
+      }
+      while (i > 16)
+      {
+        seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+        i -= 16;
+        p += 16;
+      }
+      a = wyr8(p + i - 16);
+      b = wyr8(p + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    wymum(&a, &b);
+    return wymix(a ^ secret[0] ^ len, b ^ secret[1]);
+  }
+
+  //*************************************************************************
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0UL; i < length; ++i)
+    {
+      data[i] = uint8_t((i * 131U) + 7U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_test_vectors)
+    {
+      const char* text[] = {"",
+                            "a",
+                            "abc",
+                            "message digest",
+                            "abcdefghijklmnopqrstuvwxyz",
+                            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+                            "12345678901234567890123456789012345678901234567890123456789012345678901234567890"};
+
+      const uint64_t expected[] = {0x0409638EE2BDE459ULL, 0xA8412D091B5FE0A9ULL, 0x32DD92E4B2915153ULL, 0x8619124089A3A16BULL,
+                                   0x7A43AFB61D7F5F40ULL, 0xFF42329B90E50D58ULL, 0xC39CAB13B115AAD3ULL};
+
+      for (size_t i = 0UL; i < 7UL; ++i)
+      {
+        uint64_t hash = etl::wyhash(text[i], text[i] + strlen(text[i]), i);
+
+        CHECK_EQUAL(expected[i], hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_constructor)
+    {
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        uint64_t hash    = etl::wyhash(data.data(), data.data() + data.size());
+        uint64_t compare = reference_wyhash(data.data(), data.size(), 0U);
+
+        CHECK_EQUAL(compare, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_values)
+    {
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> data = make_data(length);
+
+        etl::wyhash wyhash_calculator(12345U);
+
+        for (size_t i = 0UL; i < data.size(); ++i)
+        {
+          wyhash_calculator.add(data[i]);
+        }
+
+        uint64_t hash    = wyhash_calculator;
+        uint64_t compare = reference_wyhash(data.data(), data.size(), 12345U);
+
+        CHECK_EQUAL(compare, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_range_split)
+    {
+      std::vector<uint8_t> data    = make_data(150UL);
+      uint64_t             compare = reference_wyhash(data.data(), data.size(), 0U);
+
+      // Split the data at every point, and at every pair of points.
+      for (size_t first = 0UL; first <= data.size(); ++first)
+      {
+        for (size_t second = first; second <= data.size(); second += 7UL)
+        {
+          etl::wyhash wyhash_calculator;
+
+          wyhash_calculator.add(data.data(), data.data() + first);
+          wyhash_calculator.add(data.data() + first, data.data() + second);
+          wyhash_calculator.add(data.data() + second, data.data() + data.size());
+
+          CHECK_EQUAL(compare, wyhash_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_range_non_contiguous)
+    {
+      std::vector<uint8_t> data = make_data(100UL);
+      std::list<char>      text(data.begin(), data.end());
+
+      etl::wyhash wyhash_calculator;
+      wyhash_calculator.add(text.begin(), text.end());
+
+      CHECK_EQUAL(reference_wyhash(data.data(), data.size(), 0U), wyhash_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_reset)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      etl::wyhash wyhash_calculator(1U);
+
+      wyhash_calculator.add(data.begin(), data.end());
+      uint64_t hash1 = wyhash_calculator.value();
+
+      wyhash_calculator.reset();
+      wyhash_calculator.add(data.begin(), data.end());
+      uint64_t hash2 = wyhash_calculator.value();
+
+      CHECK_EQUAL(hash1, hash2);
+      CHECK_EQUAL(reference_wyhash(data.data(), data.size(), 1U), hash1);
+      CHECK(hash1 != etl::wyhash(data.begin(), data.end(), 2U).value());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_after_finalised)
+    {
+      std::string data("123456789");
+
+      etl::wyhash wyhash_calculator(data.begin(), data.end());
+      wyhash_calculator.value();
+
+      CHECK_THROW(wyhash_calculator.add(uint8_t(0U)), etl::hash_finalised);
+    }
+  }
+} // namespace